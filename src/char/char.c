@@ -22,6 +22,7 @@
 #include "int_storage.h"
 #include "int_status.h"
 #include "char.h"
+#include "char_bin.h"
 
 #include <sys/types.h>
 #include <time.h>
@@ -116,6 +117,7 @@ int char_id_count = START_CHAR_NUM;
 struct character_data *char_dat;
 
 int char_num, char_max;
+bool char_bin_enable = false; // use the binary store (char_bin.c) instead of the text files
 int max_connect_user = 0;
 int gm_allow_level = 99;
 int autosave_interval = DEFAULT_AUTOSAVE_INTERVAL;
@@ -373,24 +375,124 @@ int char_log(char *fmt, ...)
 }
 
 
-/// Find all characters for given session and update the session character cache.
-int char_find_characters(struct char_session_data* sd)
+//-----------------------------------------------------
+// Account index
+//-----------------------------------------------------
+
+struct char_account_index {
+	int count;
+	int index[MAX_CHARS]; // positions in char_dat
+};
+
+static DBMap* char_account_db; // int account_id -> struct char_account_index*
+
+static void* create_char_account_index(DBKey key, va_list args)
 {
-	int i, found_num = 0;
+	struct char_account_index* ai;
+	CREATE(ai, struct char_account_index, 1);
+	return ai;
+}
+
+/// Adds char_dat[index] to the account index.
+static void char_index_add(int index)
+{
+	struct char_account_index* ai = (struct char_account_index*)idb_ensure(char_account_db, char_dat[index].status.account_id, create_char_account_index);
+
+	if( ai->count < MAX_CHARS )
+		ai->index[ai->count++] = index;
+}
+
+/// Changes the position of an indexed character from 'from' to 'to'.
+/// A negative 'to' removes the character from the index.
+static void char_index_move(int account_id, int from, int to)
+{
+	struct char_account_index* ai = (struct char_account_index*)idb_get(char_account_db, account_id);
+	int i;
+
+	if( ai == NULL )
+		return;
+
+	ARR_FIND( 0, ai->count, i, ai->index[i] == from );
+	if( i == ai->count )
+		return;
+
+	if( to >= 0 )
+		ai->index[i] = to;
+	else
+	{
+		memmove(&ai->index[i], &ai->index[i+1], (ai->count-i-1)*sizeof(ai->index[0]));
+		ai->count--;
+	}
+}
+
+/// Returns the position of the character in char_dat, or -1 if not found.
+static int char_index_find(int account_id, int char_id)
+{
+	struct char_account_index* ai = (struct char_account_index*)idb_get(char_account_db, account_id);
+	int i;
+
+	if( ai == NULL )
+		return -1;
+
+	ARR_FIND( 0, ai->count, i, char_dat[ai->index[i]].status.char_id == char_id );
+	return ( i < ai->count ) ? ai->index[i] : -1;
+}
 
-	for( i = 0; i < char_num; i++ )
-	{// find character entries and save them
-		if( char_dat[i].status.account_id == sd->account_id )
+/// Removes char_dat[index], moving the last entry into its place.
+/// Keeps the account index and the character list caches of connected sessions in sync.
+static void char_dat_remove(int index)
+{
+	int last = char_num-1;
+
+	charbin_mark(char_dat[index].status.char_id);
+	char_index_move(char_dat[index].status.account_id, index, -1);
+
+	if( index != last )
+	{
+		int s, c;
+
+		memcpy(&char_dat[index], &char_dat[last], sizeof(struct character_data));
+		char_index_move(char_dat[index].status.account_id, last, index);
+
+		// scan currently online accounts, if the moved character
+		// entry requires an update of the cached character list
+		for( s = 0; s < fd_max; s++ )
 		{
-			sd->found_char[found_num++] = i;
+			struct char_session_data* osd;
 
-			if( found_num >= MAX_CHARS )
+			if( session[s] && ( osd = (struct char_session_data*)session[s]->session_data ) != NULL && osd->account_id == char_dat[index].status.account_id )
 			{
+				for( c = 0; c < MAX_CHARS; c++ )
+				{
+					if( osd->found_char[c] == last )
+					{
+						osd->found_char[c] = index;
+						break;
+					}
+				}
 				break;
 			}
 		}
 	}
 
+	// wipe the last entry
+	memset(&char_dat[last], 0, sizeof(struct character_data));
+	char_num--;
+}
+
+
+/// Find all characters for given session and update the session character cache.
+int char_find_characters(struct char_session_data* sd)
+{
+	struct char_account_index* ai = (struct char_account_index*)idb_get(char_account_db, sd->account_id);
+	int i, found_num = 0;
+
+	if( ai != NULL )
+	{// copy the indexed character entries
+		for( found_num = 0; found_num < ai->count; found_num++ )
+			sd->found_char[found_num] = ai->index[found_num];
+	}
+
 	for( i = found_num; i < MAX_CHARS; i++ )
 	{// fill remaining blanks
 		sd->found_char[i] = -1;
@@ -417,12 +519,9 @@ struct mmo_charstatus* search_session_character(struct char_session_data* sd, in
 //Search character data from the aid/cid givem
 struct mmo_charstatus* search_character(int aid, int cid)
 {
-	int i;
-	for (i = 0; i < char_num; i++) {
-		if (char_dat[i].status.char_id == cid && char_dat[i].status.account_id == aid)
-			return &char_dat[i].status;
-	}
-	return NULL;
+	int i = char_index_find(aid, cid);
+	if (i == -1) return NULL;
+	return &char_dat[i].status;
 }
 	
 struct mmo_charstatus* search_character_byname(char* character_name)
@@ -1065,6 +1164,26 @@ int mmo_char_init(void)
 	char_num = 0;
 	char_max = 0;
 	char_dat = NULL;
+	char_account_db = idb_alloc(DB_OPT_RELEASE_DATA);
+
+	if( char_bin_enable )
+	{
+		int i;
+
+		if( !charbin_init(&char_dat, &char_num, &char_max, &char_id_count) )
+		{
+			ShowFatalError("mmo_char_init: unable to open the character store %s.\n", char_bin);
+			char_log("mmo_char_init: unable to open the character store %s.\n", char_bin);
+			exit(EXIT_FAILURE);
+		}
+		for( i = 0; i < char_num; i++ )
+			char_index_add(i);
+
+		ShowStatus("mmo_char_init: %d characters read in %s.\n", char_num, char_bin);
+		char_log("mmo_char_init: %d characters read in %s.\n", char_num, char_bin);
+		char_log("Id for the next created character: %d.\n", char_id_count);
+		return 0;
+	}
 
 	fp = fopen(char_txt, "r");
 
@@ -1111,6 +1230,7 @@ int mmo_char_init(void)
 		if (ret > 0) { // negative value or zero for errors
 			if (char_dat[char_num].status.char_id >= char_id_count)
 				char_id_count = char_dat[char_num].status.char_id + 1;
+			char_index_add(char_num);
 			char_num++;
 		} else {
 			ShowError("mmo_char_init: in characters file, unable to read the line #%d.\n", line_count);
@@ -1162,17 +1282,34 @@ int mmo_char_init(void)
 	return 0;
 }
 
+/// qsort comparator for char_dat positions, by account id and slot.
+static int mmo_char_sync_cmp(const void* a, const void* b)
+{
+	const struct mmo_charstatus* p1 = &char_dat[*(const int*)a].status;
+	const struct mmo_charstatus* p2 = &char_dat[*(const int*)b].status;
+
+	if( p1->account_id != p2->account_id )
+		return ( p1->account_id < p2->account_id ) ? -1 : 1;
+	return (int)p1->slot - (int)p2->slot;
+}
+
 //---------------------------------------------------------
 // Function to save characters in files (speed up by [Yor])
 //---------------------------------------------------------
 void mmo_char_sync(void)
 {
 	char line[65536],f_line[1024];
-	int i, j, k;
+	int i;
 	int lock;
 	FILE *fp,*f_fp;
 	int* id;
 
+	if( char_bin_enable )
+	{// only the changed characters are written
+		charbin_sync(char_dat, char_num, char_id_count);
+		return;
+	}
+
 	if( char_num == 0 )
 	{// nothing to do
 		return;
@@ -1181,20 +1318,9 @@ void mmo_char_sync(void)
 	id = (int*)aCalloc(sizeof(int), char_num);
 
 	// Sorting before save (by [Yor])
-	for(i = 0; i < char_num; i++) {
+	for(i = 0; i < char_num; i++)
 		id[i] = i;
-		for(j = 0; j < i; j++) {
-			if ((char_dat[i].status.account_id < char_dat[id[j]].status.account_id) ||
-			    // if same account id, we sort by slot.
-			    (char_dat[i].status.account_id == char_dat[id[j]].status.account_id &&
-			     char_dat[i].status.slot < char_dat[id[j]].status.slot)) {
-				for(k = i; k > j; k--)
-					id[k] = id[k-1];
-				id[j] = i; // id[i]
-				break;
-			}
-		}
-	}
+	qsort(id, char_num, sizeof(int), mmo_char_sync_cmp);
 
 	// Data save
 	fp = lock_fopen(char_txt, &lock);
@@ -1296,6 +1422,7 @@ int check_char_name(char * name)
 int make_new_char(struct char_session_data* sd, char* name_, int str, int agi, int vit, int int_, int dex, int luk, int slot, int hair_color, int hair_style)
 {
 	char name[NAME_LENGTH];
+	struct char_account_index* ai;
 	int i, flag;
 	
 	safestrncpy(name, name_, NAME_LENGTH);
@@ -1321,9 +1448,12 @@ int make_new_char(struct char_session_data* sd, char* name_, int str, int agi, i
 	}
 
 	// check char slot
-	ARR_FIND( 0, char_num, i, char_dat[i].status.account_id == sd->account_id && char_dat[i].status.slot == slot );
-	if( i < char_num )
-		return -2; // slot already in use
+	if( ( ai = (struct char_account_index*)idb_get(char_account_db, sd->account_id) ) != NULL )
+	{
+		ARR_FIND( 0, ai->count, i, char_dat[ai->index[i]].status.slot == slot );
+		if( i < ai->count )
+			return -2; // slot already in use
+	}
 
 	if (char_num >= char_max) {
 		char_max += 256;
@@ -1385,6 +1515,8 @@ int make_new_char(struct char_session_data* sd, char* name_, int str, int agi, i
 	char_dat[i].status.head_bottom = 0;
 	memcpy(&char_dat[i].status.last_point, &start_point, sizeof(start_point));
 	memcpy(&char_dat[i].status.save_point, &start_point, sizeof(start_point));
+	char_index_add(i);
+	charbin_mark(char_dat[i].status.char_id);
 	char_num++;
 
 	ShowInfo("Created char: account: %d, char: %d, slot: %d, name: %s\n", sd->account_id, i, slot, name);
@@ -1927,6 +2059,8 @@ int char_divorce(struct mmo_charstatus *cs)
 					if (cs->inventory[j].nameid == WEDDING_RING_M || cs->inventory[j].nameid == WEDDING_RING_F)
 						memset(&cs->inventory[j], 0, sizeof(cs->inventory[0]));
 				}
+				charbin_mark(cs->char_id);
+				charbin_mark(char_dat[i].status.char_id);
 				return 0;
 			}
 		}
@@ -2275,13 +2409,15 @@ int parse_fromlogin(int fd)
 			if( acc > 0 )
 			{// TODO: Is this even possible?
 				struct auth_node* node = (struct auth_node*)idb_get(auth_db, acc);
+				struct char_account_index* ai = (struct char_account_index*)idb_get(char_account_db, acc);
 				if( node != NULL )
 					node->sex = sex;
 
-				ARR_FIND( 0, char_num, i, char_dat[i].status.account_id == acc );
-				if( i < char_num )
+				if( ai != NULL && ai->count > 0 )
 				{
-					int jobclass = char_dat[i].status.class_;
+					int jobclass;
+					i = ai->index[0];
+					jobclass = char_dat[i].status.class_;
 					char_dat[i].status.sex = sex;
 					if (jobclass == JOB_BARD || jobclass == JOB_DANCER ||
 					    jobclass == JOB_CLOWN || jobclass == JOB_GYPSY ||
@@ -2324,6 +2460,7 @@ int parse_fromlogin(int fd)
 
 					if (char_dat[i].status.guild_id)	//If there is a guild, update the guild_member data [Skotlex]
 						inter_guild_sex_changed(char_dat[i].status.guild_id, acc, char_dat[i].status.char_id, sex);
+					charbin_mark(char_dat[i].status.char_id);
 				}
 				// disconnect player if online on char-server
 				disconnect_player(acc);
@@ -2506,11 +2643,8 @@ int save_accreg2(unsigned char* buf, int len)
 int char_parse_Registry(int account_id, int char_id, unsigned char *buf, int buf_len)
 {
 	int i,j,p,len;
-	for (i = 0; i < char_num; i++) {
-		if (char_dat[i].status.account_id == account_id && char_dat[i].status.char_id == char_id)
-			break;
-	}
-	if(i >= char_num) //Character not found?
+	i = char_index_find(account_id, char_id);
+	if(i < 0) //Character not found?
 		return 1;
 	for(j=0,p=0;j<GLOBAL_REG_NUM && p<buf_len;j++){
 		sscanf((char*)WBUFP(buf,p), "%31c%n",char_dat[i].global[j].str,&len);
@@ -2521,6 +2655,7 @@ int char_parse_Registry(int account_id, int char_id, unsigned char *buf, int buf
 		p +=len+1;
 	}
 	char_dat[i].global_num = j;
+	charbin_mark(char_id);
 	return 0;
 }
 
@@ -2533,11 +2668,8 @@ int char_account_reg_reply(int fd,int account_id,int char_id)
 	WFIFOL(fd,4)=account_id;
 	WFIFOL(fd,8)=char_id;
 	WFIFOB(fd,12)=3; //Type 3: char acc reg.
-	for (i = 0;i < char_num; i++) {
-		if (char_dat[i].status.account_id == account_id && char_dat[i].status.char_id	== char_id)
-			break;
-	}
-	if(i >= char_num){ //Character not found? Sent empty packet.
+	i = char_index_find(account_id, char_id);
+	if(i < 0){ //Character not found? Sent empty packet.
 		WFIFOW(fd,2)=13;
 	}else{
 		for (p=13,j = 0; j < char_dat[i].global_num; j++) {
@@ -2921,6 +3053,7 @@ int parse_frommap(int fd)
 			{
 				memcpy(cs, RFIFOP(fd,13), sizeof(struct mmo_charstatus));
 				storage_save(cs->account_id, &cs->storage);
+				charbin_mark(cid);
 			}
 
 			if (RFIFOB(fd,12))
@@ -3007,6 +3140,7 @@ int parse_frommap(int fd)
 				char_data->last_point.x = RFIFOW(fd,20);
 				char_data->last_point.y = RFIFOW(fd,22);
 				char_data->sex = RFIFOB(fd,30);
+				charbin_mark(char_data->char_id);
 
 				// create temporary auth entry
 				CREATE(node, struct auth_node, 1);
@@ -3519,6 +3653,7 @@ static void char_delete2_req(int fd, struct char_session_data* sd)
 
 	// success
 	cs->delete_date = time(NULL)+char_del_delay;
+	charbin_mark(cs->char_id);
 
 	char_delete2_ack(fd, char_id, 1, cs->delete_date);
 }
@@ -3577,36 +3712,7 @@ static void char_delete2_accept(int fd, struct char_session_data* sd)
 	char_delete(cs);
 
 	// drop character entry
-	if( --char_num > 0 && sd->found_char[i] != char_num )
-	{
-		int s, c;
-
-		// move the last entry to the place of the deleted character
-		memcpy(&char_dat[sd->found_char[i]], &char_dat[char_num], sizeof(struct mmo_charstatus));
-
-		// scan currently online accounts, if the moved character
-		// entry requires an update of the cached character list
-		for( s = 0; s < fd_max; s++ )
-		{
-			struct char_session_data* osd;
-
-			if( session[s] && ( osd = (struct char_session_data*)session[s]->session_data ) != NULL && osd->account_id == char_dat[char_num].status.account_id )
-			{
-				for( c = 0; c < MAX_CHARS; c++ )
-				{
-					if( osd->found_char[c] == char_num )
-					{
-						osd->found_char[c] = sd->found_char[i];
-						break;
-					}
-				}
-				break;
-			}
-		}
-
-		// wipe the last entry
-		memset(&char_dat[char_num], 0, sizeof(struct mmo_charstatus));
-	}
+	char_dat_remove(sd->found_char[i]);
 
 	// refresh character list cache
 	char_find_characters(sd);
@@ -3634,6 +3740,7 @@ static void char_delete2_cancel(int fd, struct char_session_data* sd)
 	// queued for deletion, as the client prints an error message by
 	// itself, if it was not the case (@see char_delete2_cancel_ack)
 	cs->delete_date = 0;
+	charbin_mark(cs->char_id);
 
 	char_delete2_cancel_ack(fd, char_id, 1);
 }
@@ -4017,25 +4124,7 @@ int parse_char(int fd)
 			}
 
 			char_delete(cs);
-			if (sd->found_char[i] != char_num - 1) {
-				int j, k;
-				struct char_session_data *sd2;
-				memcpy(&char_dat[sd->found_char[i]], &char_dat[char_num-1], sizeof(struct mmo_charstatus));
-				// Correct moved character reference in the character's owner
-				for (j = 0; j < fd_max; j++) {
-					if (session[j] && (sd2 = (struct char_session_data*)session[j]->session_data) &&
-						sd2->account_id == char_dat[char_num-1].status.account_id) {
-						for (k = 0; k < MAX_CHARS; k++) {
-							if (sd2->found_char[k] == char_num-1) {
-								sd2->found_char[k] = sd->found_char[i];
-								break;
-							}
-						}
-						break;
-					}
-				}
-			}
-			char_num--;
+			char_dat_remove(sd->found_char[i]);
 
 			// remove char from list and compact it
 			for(ch = i; ch < MAX_CHARS-1; ch++)
@@ -4185,12 +4274,20 @@ int parse_console(const char* command)
 		runflag = SERVER_STATE_STOP;
 	else if( strcmpi("alive", command) == 0 || strcmpi("status", command) == 0 )
 		ShowInfo(CL_CYAN"Console: "CL_BOLD"I'm Alive."CL_RESET"\n");
+	else if( strcmpi("memory", command) == 0 )
+		malloc_report(20);
+	else if( strcmpi("sockets", command) == 0 )
+		socket_report(20);
 	else if( strcmpi("help", command) == 0 )
 	{
 		ShowInfo("To shutdown the server:\n");
 		ShowInfo("  'shutdown|exit|quit|end'\n");
 		ShowInfo("To know if server is alive:\n");
 		ShowInfo("  'alive|status'\n");
+		ShowInfo("To show the allocations by size class and call site:\n");
+		ShowInfo("  'memory'\n");
+		ShowInfo("To show the bytes, packets and send calls of the connections:\n");
+		ShowInfo("  'sockets'\n");
 	}
 
 	return 0;
@@ -4530,7 +4627,15 @@ int char_config_read(const char *cfgName)
 			safestrncpy(friends_txt, w2, sizeof(friends_txt));
 		} else if (strcmpi(w1, "hotkeys_txt") == 0) { //By davidsiaw
 			safestrncpy(hotkeys_txt, w2, sizeof(hotkeys_txt));
+		} else if (strcmpi(w1, "char_bin") == 0) {
+			safestrncpy(char_bin, w2, sizeof(char_bin));
 #ifndef TXT_SQL_CONVERT
+		} else if (strcmpi(w1, "char_bin_enable") == 0) {
+			char_bin_enable = (bool)config_switch(w2);
+		} else if (strcmpi(w1, "char_bin_compact") == 0) {
+			char_bin_compact = atoi(w2);
+			if (char_bin_compact < 1)
+				char_bin_compact = 1;
 		} else if (strcmpi(w1, "max_connect_user") == 0) {
 			max_connect_user = atoi(w2);
 			if (max_connect_user < 0)
@@ -4643,7 +4748,10 @@ void do_final(void)
 {
 	ShowStatus("Terminating...\n");
 
-	mmo_char_sync();
+	if( char_bin_enable )
+		charbin_final(char_dat, char_num, char_id_count);
+	else
+		mmo_char_sync();
 	inter_save();
 	set_all_offline(-1);
 	flush_fifos();
@@ -4657,6 +4765,7 @@ void do_final(void)
 
 	online_char_db->destroy(online_char_db, NULL);
 	auth_db->destroy(auth_db, NULL);
+	char_account_db->destroy(char_account_db, NULL);
 	
 	if(char_dat) aFree(char_dat);
 	
@@ -0,0 +1,560 @@
+// Copyright (c) Athena Dev Teams - Licensed under GNU GPL
+// For more information, see LICENCE in the main folder
+
+#define _FILE_OFFSET_BITS 64 // slot offsets go past 2GB with a few thousand characters
+
+#include "../common/cbasetypes.h"
+#include "../common/db.h"
+#include "../common/malloc.h"
+#include "../common/mmo.h"
+#include "../common/showmsg.h"
+#include "../common/utils.h"
+#include "char.h"
+#include "char_bin.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+#define charbin_fseek(fp,ofs) _fseeki64((fp),(__int64)(ofs),SEEK_SET)
+#else
+#include <sys/types.h>
+#define charbin_fseek(fp,ofs) fseeko((fp),(off_t)(ofs),SEEK_SET)
+#endif
+
+/// Binary character store, an alternative to char_txt/friends_txt/hotkeys_txt.
+///
+/// <char_bin>          snapshot: header followed by one fixed-size slot per character
+///                     (a struct character_data, status.char_id 0 marks a free slot)
+/// <char_bin>.journal  header followed by the characters changed or deleted since
+///                     the last compaction, appended in order
+///
+/// A sync only appends the characters marked with charbin_mark() to the journal.
+/// Compaction writes the journaled characters into their snapshot slots in place
+/// and starts a new journal, so neither depends on the total amount of characters.
+/// Startup loads the snapshot and replays the journal on top of it.
+
+#define CHARBIN_MAGIC 0x42434165 // "eACB"
+#define CHARBIN_VERSION 1
+
+enum charbin_op
+{
+	CHARBIN_OP_SAVE = 1,
+	CHARBIN_OP_DELETE = 2,
+};
+
+struct charbin_header
+{
+	uint32 magic;
+	uint32 version;
+	uint32 slot_size; // sizeof(struct character_data) of the build that wrote the file
+	uint32 slot_count; // amount of slots in the snapshot (0 in the journal)
+	int next_char_id;
+};
+
+/// Journal entry, for saves followed by the status and global_num registry entries.
+struct charbin_entry
+{
+	int op;
+	int char_id;
+	int global_num;
+};
+
+char char_bin[1024] = "save/athena.bin";
+int char_bin_compact = 1000; // journal entries that trigger a compaction
+
+static char journal_path[1024+8];
+static FILE* snapshot_fp = NULL;
+static FILE* journal_fp = NULL;
+static int journal_entries = 0;
+static int64 journal_size = 0; // bytes of complete entries in the journal
+
+static DBMap* slot_db = NULL; // int char_id -> snapshot slot + 1
+static DBMap* dirty_db = NULL; // int char_id -> marked since the last sync
+static DBMap* pending_db = NULL; // int char_id -> journaled since the last compaction
+
+static uint32 slot_count = 0;
+static int* free_slots = NULL;
+static int free_num = 0, free_max = 0;
+
+// scratch record, too big for the stack
+static struct character_data charbin_tmp;
+
+
+static bool charbin_read_header(FILE* fp, const char* path, struct charbin_header* h)
+{
+	if( fread(h, sizeof(*h), 1, fp) != 1 || h->magic != CHARBIN_MAGIC || h->version != CHARBIN_VERSION )
+	{
+		ShowError("charbin: '%s' is not a character store of version %d.\n", path, CHARBIN_VERSION);
+		return false;
+	}
+	if( h->slot_size != sizeof(struct character_data) )
+	{
+		ShowError("charbin: '%s' was written with a different character layout (record size %u, expected %u).\n", path, h->slot_size, (unsigned int)sizeof(struct character_data));
+		ShowError("         Convert the text files again with the char-converter.\n");
+		return false;
+	}
+	return true;
+}
+
+
+static bool charbin_write_header(FILE* fp, uint32 slots, int next_char_id)
+{
+	struct charbin_header h;
+
+	h.magic = CHARBIN_MAGIC;
+	h.version = CHARBIN_VERSION;
+	h.slot_size = sizeof(struct character_data);
+	h.slot_count = slots;
+	h.next_char_id = next_char_id;
+
+	if( charbin_fseek(fp, 0) != 0 )
+		return false;
+	return ( fwrite(&h, sizeof(h), 1, fp) == 1 );
+}
+
+
+/// Creates an empty snapshot and drops the journal that belonged to the previous one.
+FILE* charbin_create(const char* filename)
+{
+	char path[1024+8];
+	FILE* fp;
+
+	if( ( fp = fopen(filename, "w+b") ) == NULL )
+		return NULL;
+	if( !charbin_write_header(fp, 0, START_CHAR_NUM) )
+	{
+		fclose(fp);
+		return NULL;
+	}
+
+	sprintf(path, "%s.journal", filename);
+	remove(path);
+	return fp;
+}
+
+
+/// Writes a character into the given snapshot slot.
+bool charbin_write(FILE* fp, int slot, const struct character_data* cd)
+{
+	if( charbin_fseek(fp, sizeof(struct charbin_header) + (int64)slot*sizeof(struct character_data)) != 0 )
+		return false;
+	return ( fwrite(cd, sizeof(*cd), 1, fp) == 1 );
+}
+
+
+/// Finalizes a snapshot created with charbin_create.
+/// Returns false if the snapshot could not be completed.
+bool charbin_close(FILE* fp, int slots, int next_char_id)
+{
+	bool ok = charbin_write_header(fp, (uint32)slots, next_char_id);
+
+	if( fclose(fp) != 0 )
+		ok = false;
+	return ok;
+}
+
+
+/// Returns the snapshot slot of a character, assigning one if it has none yet.
+static int charbin_slot(int char_id)
+{
+	int slot = (int)(intptr)idb_get(slot_db, char_id) - 1;
+
+	if( slot < 0 )
+	{
+		slot = ( free_num > 0 ) ? free_slots[--free_num] : (int)slot_count++;
+		idb_put(slot_db, char_id, (void*)(intptr)(slot+1));
+	}
+	return slot;
+}
+
+
+static void charbin_free_slot(int slot)
+{
+	if( free_num >= free_max )
+	{
+		free_max += 256;
+		RECREATE(free_slots, int, free_max);
+	}
+	free_slots[free_num++] = slot;
+}
+
+
+/// Starts a new, empty journal.
+static bool charbin_journal_reset(int next_char_id)
+{
+	if( journal_fp != NULL )
+		fclose(journal_fp);
+
+	if( ( journal_fp = fopen(journal_path, "wb") ) == NULL )
+	{
+		ShowError("charbin: unable to open the journal '%s'.\n", journal_path);
+		return false;
+	}
+	if( !charbin_write_header(journal_fp, 0, next_char_id) || fflush(journal_fp) != 0 )
+	{
+		ShowError("charbin: unable to write the journal '%s'.\n", journal_path);
+		fclose(journal_fp);
+		journal_fp = NULL;
+		return false;
+	}
+	journal_entries = 0;
+	journal_size = sizeof(struct charbin_header);
+	return true;
+}
+
+
+/// Appends a save entry to the journal.
+static bool charbin_journal_save(const struct character_data* cd)
+{
+	struct charbin_entry e;
+
+	e.op = CHARBIN_OP_SAVE;
+	e.char_id = cd->status.char_id;
+	e.global_num = cap_value(cd->global_num, 0, GLOBAL_REG_NUM);
+	if( fwrite(&e, sizeof(e), 1, journal_fp) != 1 ||
+		fwrite(&cd->status, sizeof(cd->status), 1, journal_fp) != 1 ||
+		fwrite(cd->global, sizeof(cd->global[0]), e.global_num, journal_fp) != (size_t)e.global_num )
+		return false;
+	journal_size += sizeof(e) + sizeof(cd->status) + e.global_num*sizeof(cd->global[0]);
+	return true;
+}
+
+
+/// Appends a delete entry to the journal.
+static bool charbin_journal_delete(int char_id)
+{
+	struct charbin_entry e;
+
+	e.op = CHARBIN_OP_DELETE;
+	e.char_id = char_id;
+	e.global_num = 0;
+	if( fwrite(&e, sizeof(e), 1, journal_fp) != 1 )
+		return false;
+	journal_size += sizeof(e);
+	return true;
+}
+
+
+/// Folds the journal into the snapshot.
+/// Only the slots of journaled characters are rewritten.
+/// If anything fails, the journal and the pending characters are kept so the next compaction retries.
+static bool charbin_compact(const struct character_data* dat, int num, int next_char_id)
+{
+	static const struct character_data empty;
+	DBIterator* iter;
+	DBKey key;
+	bool ok = true;
+	int i, left;
+
+	// pending characters still in the array are marked with 2, the rest was deleted
+	left = pending_db->size(pending_db);
+	for( i = 0; i < num && left > 0; ++i )
+	{
+		int char_id = dat[i].status.char_id;
+
+		if( !idb_exists(pending_db, char_id) )
+			continue;
+		idb_put(pending_db, char_id, (void*)2);
+		--left;
+		if( !charbin_write(snapshot_fp, charbin_slot(char_id), &dat[i]) )
+		{
+			ShowError("charbin: failed to write character %d to '%s'.\n", char_id, char_bin);
+			ok = false;
+		}
+	}
+
+	iter = db_iterator(pending_db);
+	for( iter->first(iter, &key); dbi_exists(iter); iter->next(iter, &key) )
+	{
+		int slot;
+
+		if( idb_get(pending_db, key.i) == (void*)2 )
+			continue;
+		slot = (int)(intptr)idb_get(slot_db, key.i) - 1;
+		if( slot < 0 )
+			continue; // created and deleted within the same journal
+		if( !charbin_write(snapshot_fp, slot, &empty) )
+		{
+			ShowError("charbin: failed to clear the slot of deleted character %d in '%s'.\n", key.i, char_bin);
+			ok = false;
+			continue;
+		}
+		idb_remove(slot_db, key.i);
+		charbin_free_slot(slot);
+	}
+	dbi_destroy(iter);
+
+	if( ok && ( !charbin_write_header(snapshot_fp, slot_count, next_char_id) || fflush(snapshot_fp) != 0 ) )
+	{
+		ShowError("charbin: failed to update the header of '%s'.\n", char_bin);
+		ok = false;
+	}
+
+	if( !ok )
+	{// keep everything journaled, the snapshot slots are rewritten on the next try
+		iter = db_iterator(pending_db);
+		for( iter->first(iter, &key); dbi_exists(iter); iter->next(iter, &key) )
+			idb_put(pending_db, key.i, (void*)1);
+		dbi_destroy(iter);
+		ShowError("charbin: compaction failed, keeping the journal '%s'.\n", journal_path);
+		return false;
+	}
+
+	// the snapshot is now up-to-date
+	db_clear(pending_db);
+	if( !charbin_journal_reset(next_char_id) )
+		ShowError("charbin: no journal, changed characters are written straight into '%s' until one can be started.\n", char_bin);
+	return true;
+}
+
+
+/// Loads the snapshot and replays the journal into the character array.
+/// Creates an empty store if none exists yet.
+bool charbin_init(struct character_data** dat, int* num, int* max, int* next_char_id)
+{
+	struct charbin_header h;
+	DBMap* index; // int char_id -> position in *dat + 1
+	FILE* fp;
+	uint32 i;
+
+	sprintf(journal_path, "%s.journal", char_bin);
+	journal_size = sizeof(struct charbin_header);
+	slot_db = idb_alloc(DB_OPT_BASE);
+	dirty_db = idb_alloc(DB_OPT_BASE);
+	pending_db = idb_alloc(DB_OPT_BASE);
+
+	if( ( snapshot_fp = fopen(char_bin, "r+b") ) == NULL )
+	{
+		ShowNotice("charbin: '%s' not found, creating an empty character store.\n", char_bin);
+		if( ( snapshot_fp = charbin_create(char_bin) ) == NULL )
+		{
+			ShowError("charbin: unable to create '%s'.\n", char_bin);
+			return false;
+		}
+		h.slot_count = 0;
+		h.next_char_id = *next_char_id;
+	}
+	else if( !charbin_read_header(snapshot_fp, char_bin, &h) )
+		return false;
+
+	if( *next_char_id < h.next_char_id )
+		*next_char_id = h.next_char_id;
+
+	index = idb_alloc(DB_OPT_BASE);
+	for( i = 0; i < h.slot_count; ++i )
+	{
+		struct character_data* cd;
+
+		if( *num >= *max )
+		{
+			*max += 256;
+			RECREATE(*dat, struct character_data, *max);
+		}
+		cd = &(*dat)[*num];
+		if( fread(cd, sizeof(*cd), 1, snapshot_fp) != 1 )
+		{
+			ShowError("charbin: '%s' is truncated after %u of %u slots.\n", char_bin, i, h.slot_count);
+			break;
+		}
+		if( cd->status.char_id == 0 )
+		{// free slot
+			charbin_free_slot(i);
+			continue;
+		}
+		idb_put(slot_db, cd->status.char_id, (void*)(intptr)(i+1));
+		idb_put(index, cd->status.char_id, (void*)(intptr)(*num+1));
+		if( *next_char_id <= cd->status.char_id )
+			*next_char_id = cd->status.char_id + 1;
+		(*num)++;
+	}
+	slot_count = i;
+
+	// replay the journal
+	if( ( fp = fopen(journal_path, "rb") ) != NULL )
+	{
+		if( charbin_read_header(fp, journal_path, &h) )
+		{
+			struct charbin_entry e;
+
+			while( fread(&e, sizeof(e), 1, fp) == 1 )
+			{
+				int pos = (int)(intptr)idb_get(index, e.char_id) - 1;
+
+				if( e.op == CHARBIN_OP_SAVE )
+				{
+					memset(&charbin_tmp, 0, sizeof(charbin_tmp));
+					if( e.global_num < 0 || e.global_num > GLOBAL_REG_NUM ||
+						fread(&charbin_tmp.status, sizeof(charbin_tmp.status), 1, fp) != 1 ||
+						fread(charbin_tmp.global, sizeof(charbin_tmp.global[0]), e.global_num, fp) != (size_t)e.global_num )
+						break; // incomplete last entry
+					charbin_tmp.global_num = e.global_num;
+					journal_size += sizeof(charbin_tmp.status) + e.global_num*sizeof(charbin_tmp.global[0]);
+
+					if( pos < 0 )
+					{
+						if( *num >= *max )
+						{
+							*max += 256;
+							RECREATE(*dat, struct character_data, *max);
+						}
+						pos = (*num)++;
+						idb_put(index, e.char_id, (void*)(intptr)(pos+1));
+					}
+					memcpy(&(*dat)[pos], &charbin_tmp, sizeof(charbin_tmp));
+				}
+				else if( e.op == CHARBIN_OP_DELETE )
+				{
+					if( pos >= 0 )
+					{// move the last entry into the hole
+						idb_remove(index, e.char_id);
+						if( pos != --(*num) )
+						{
+							memcpy(&(*dat)[pos], &(*dat)[*num], sizeof(struct character_data));
+							idb_put(index, (*dat)[pos].status.char_id, (void*)(intptr)(pos+1));
+						}
+					}
+				}
+				else
+					break; // garbage
+
+				idb_put(pending_db, e.char_id, (void*)1);
+				journal_entries++;
+				journal_size += sizeof(e);
+				if( *next_char_id <= e.char_id )
+					*next_char_id = e.char_id + 1;
+			}
+			if( !feof(fp) )
+				ShowWarning("charbin: ignoring the incomplete tail of '%s' after %d entries.\n", journal_path, journal_entries);
+			else if( journal_entries > 0 )
+				ShowStatus("charbin: replayed %d journal entries from '%s'.\n", journal_entries, journal_path);
+		}
+		fclose(fp);
+	}
+	db_destroy(index);
+
+	if( journal_entries == 0 )
+		charbin_journal_reset(*next_char_id);
+	else if( !charbin_compact(*dat, *num, *next_char_id) )
+	{// keep appending to the old journal until a compaction succeeds
+		if( ( journal_fp = fopen(journal_path, "r+b") ) == NULL || charbin_fseek(journal_fp, journal_size) != 0 )
+		{
+			ShowError("charbin: unable to open the journal '%s'.\n", journal_path);
+			return false;
+		}
+	}
+
+	return ( journal_fp != NULL );
+}
+
+
+/// Closes the store, leaving an up-to-date snapshot and an empty journal.
+void charbin_final(const struct character_data* dat, int num, int next_char_id)
+{
+	if( snapshot_fp == NULL )
+		return;
+
+	charbin_sync(dat, num, next_char_id);
+	if( journal_entries > 0 )
+		charbin_compact(dat, num, next_char_id);
+
+	fclose(snapshot_fp);
+	snapshot_fp = NULL;
+	if( journal_fp != NULL )
+		fclose(journal_fp);
+	journal_fp = NULL;
+
+	db_destroy(slot_db);
+	db_destroy(dirty_db);
+	db_destroy(pending_db);
+	if( free_slots != NULL )
+		aFree(free_slots);
+	free_slots = NULL;
+	free_num = free_max = 0;
+}
+
+
+/// Marks a character as changed (or deleted) so the next sync writes it.
+void charbin_mark(int char_id)
+{
+	if( dirty_db != NULL )
+		idb_put(dirty_db, char_id, (void*)1);
+}
+
+
+/// Appends all marked characters to the journal.
+/// Marked characters that are no longer in the array are journaled as deleted.
+/// If the journal can't be written, the characters stay marked for the next sync.
+void charbin_sync(const struct character_data* dat, int num, int next_char_id)
+{
+	DBIterator* iter;
+	DBKey key;
+	int64 start;
+	bool ok = true;
+	int i, left;
+
+	if( dirty_db == NULL || dirty_db->size(dirty_db) == 0 )
+		return;
+
+	if( journal_fp == NULL && !charbin_journal_reset(next_char_id) )
+	{// the last compaction left no journal (the snapshot is up-to-date), write the changes into the snapshot instead
+		iter = db_iterator(dirty_db);
+		for( iter->first(iter, &key); dbi_exists(iter); iter->next(iter, &key) )
+			idb_put(pending_db, key.i, (void*)1);
+		dbi_destroy(iter);
+		if( charbin_compact(dat, num, next_char_id) )
+			db_clear(dirty_db);
+		else
+			ShowError("charbin: %d changed characters could not be saved, retrying on the next save.\n", dirty_db->size(dirty_db));
+		return;
+	}
+
+	start = journal_size;
+
+	// marked characters still in the array are marked with 2, the rest was deleted
+	left = dirty_db->size(dirty_db);
+	for( i = 0; ok && i < num && left > 0; ++i )
+	{
+		if( !idb_exists(dirty_db, dat[i].status.char_id) )
+			continue;
+		idb_put(dirty_db, dat[i].status.char_id, (void*)2);
+		--left;
+		ok = charbin_journal_save(&dat[i]);
+	}
+
+	iter = db_iterator(dirty_db);
+	for( iter->first(iter, &key); ok && dbi_exists(iter); iter->next(iter, &key) )
+		if( idb_get(dirty_db, key.i) != (void*)2 )
+			ok = charbin_journal_delete(key.i);
+	dbi_destroy(iter);
+
+	if( ok && fflush(journal_fp) != 0 )
+		ok = false;
+
+	iter = db_iterator(dirty_db);
+	for( iter->first(iter, &key); dbi_exists(iter); iter->next(iter, &key) )
+	{
+		if( ok )
+		{
+			idb_put(pending_db, key.i, (void*)1);
+			journal_entries++;
+		}
+		else
+			idb_put(dirty_db, key.i, (void*)1);
+	}
+	dbi_destroy(iter);
+
+	if( !ok )
+	{// the next append overwrites whatever part of this sync made it into the file
+		ShowError("charbin: failed to write to the journal '%s', retrying on the next save.\n", journal_path);
+		clearerr(journal_fp);
+		journal_size = start;
+		charbin_fseek(journal_fp, start);
+		return;
+	}
+	db_clear(dirty_db);
+
+	if( journal_entries >= char_bin_compact )
+		charbin_compact(dat, num, next_char_id);
+}
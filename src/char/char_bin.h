@@ -0,0 +1,26 @@
+// Copyright (c) Athena Dev Teams - Licensed under GNU GPL
+// For more information, see LICENCE in the main folder
+
+#ifndef _CHAR_BIN_H_
+#define _CHAR_BIN_H_
+
+#include "../common/cbasetypes.h"
+#include <stdio.h>
+
+struct character_data;
+
+extern char char_bin[1024];
+extern int char_bin_compact;
+
+// server interface
+bool charbin_init(struct character_data** dat, int* num, int* max, int* next_char_id);
+void charbin_final(const struct character_data* dat, int num, int next_char_id);
+void charbin_mark(int char_id);
+void charbin_sync(const struct character_data* dat, int num, int next_char_id);
+
+// snapshot creation (used by the converter)
+FILE* charbin_create(const char* filename);
+bool charbin_write(FILE* fp, int slot, const struct character_data* cd);
+bool charbin_close(FILE* fp, int slots, int next_char_id);
+
+#endif /* _CHAR_BIN_H_ */
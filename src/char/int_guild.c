@@ -23,6 +23,7 @@ char castle_txt[1024] = "save/castle.txt";
 
 #ifndef TXT_SQL_CONVERT
 static DBMap* guild_db; // int guild_id -> struct guild*
+static DBMap* guild_name_db; // char* guild name -> struct guild* (case-insensitive)
 static DBMap* castle_db; // int castle_id -> struct guild_castle*
 
 static int guild_newid = 10000;
@@ -400,6 +401,7 @@ int inter_guild_init()
 	inter_guild_readdb();
 
 	guild_db = idb_alloc(DB_OPT_RELEASE_DATA);
+	guild_name_db = stridb_alloc(DB_OPT_BASE, NAME_LENGTH);
 	castle_db = idb_alloc(DB_OPT_RELEASE_DATA);
 
 	if ((fp = fopen(guild_txt,"r")) == NULL)
@@ -422,6 +424,7 @@ int inter_guild_init()
 			if (g->guild_id >= guild_newid)
 				guild_newid = g->guild_id + 1;
 			idb_put(guild_db, g->guild_id, g);
+			strdb_put(guild_name_db, g->name, g);
 			guild_check_empty(g);
 			guild_calcinfo(g);
 		} else {
@@ -479,6 +482,7 @@ int inter_guild_init()
 void inter_guild_final()
 {
 	castle_db->destroy(castle_db, NULL);
+	guild_name_db->destroy(guild_name_db, NULL);
 	guild_db->destroy(guild_db, NULL);
 	return;
 }
@@ -538,18 +542,15 @@ int inter_guild_save()
 // Mh
 struct guild* search_guildname(char *str)
 {
-	DBIterator* iter;
-	struct guild* g;
-
-	iter = guild_db->iterator(guild_db);
-	for( g = (struct guild*)iter->first(iter,NULL); iter->exists(iter); g = (struct guild*)iter->next(iter,NULL) )
-	{
-		if (strcmpi(g->name, str) == 0)
-			break;
-	}
-	iter->destroy(iter);
+	return (struct guild*)strdb_get(guild_name_db, str);
+}
 
-	return g;
+// Removes the guild from memory
+static void guild_remove(struct guild* g)
+{
+	if( search_guildname(g->name) == g )
+		strdb_remove(guild_name_db, g->name);
+	idb_remove(guild_db, g->guild_id);
 }
 
 // Mh󂩂ǂ`FbN
@@ -564,7 +565,7 @@ static bool guild_check_empty(struct guild *g)
 	guild_db->foreach(guild_db, guild_break_sub, g->guild_id);
 	inter_guild_storage_delete(g->guild_id);
 	mapif_guild_broken(g->guild_id, 0);
-	idb_remove(guild_db, g->guild_id);
+	guild_remove(g);
 	return true;
 }
 
@@ -1009,6 +1010,7 @@ int mapif_parse_CreateGuild(int fd, int account_id, char *name, struct guild_mem
 		g->skill[i].id=i + GD_SKILLBASE;
 
 	idb_put(guild_db, g->guild_id, g);
+	strdb_put(guild_name_db, g->name, g);
 
 	mapif_guild_created(fd, account_id, g);
 	mapif_guild_info(fd, g);
@@ -1179,7 +1181,7 @@ int mapif_parse_BreakGuild(int fd, int guild_id)
 	if(log_inter)
 		inter_log("guild %s (id=%d) broken\n", g->name, guild_id);
 
-	idb_remove(guild_db, guild_id);
+	guild_remove(g);
 	return 0;
 }
 
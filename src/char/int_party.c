@@ -27,6 +27,7 @@ struct party_data {
 };
 
 static DBMap* party_db; // int party_id -> struct party_data*
+static DBMap* party_name_db; // char* party name -> struct party_data* (case-insensitive)
 static int party_newid = 100;
 
 int mapif_party_broken(int party_id, int flag);
@@ -177,6 +178,7 @@ int inter_party_init() {
 	int i, j;
 
 	party_db = idb_alloc(DB_OPT_RELEASE_DATA);
+	party_name_db = stridb_alloc(DB_OPT_BASE, NAME_LENGTH);
 
 	if ((fp = fopen(party_txt, "r")) == NULL)
 		return 1;
@@ -200,6 +202,7 @@ int inter_party_init() {
 			if (p->party.party_id >= party_newid)
 				party_newid = p->party.party_id + 1;
 			idb_put(party_db, p->party.party_id, p);
+			strdb_put(party_name_db, p->party.name, p);
 			party_check_empty(&p->party);
 		} else {
 			ShowError("int_party: broken data [%s] line %d\n", party_txt, c + 1);
@@ -214,6 +217,7 @@ int inter_party_init() {
 
 void inter_party_final()
 {
+	party_name_db->destroy(party_name_db, NULL);
 	party_db->destroy(party_db, NULL);
 	return;
 }
@@ -247,22 +251,19 @@ int inter_party_save() {
 // Search for the party according to its name
 struct party_data* search_partyname(char *str)
 {
-	struct DBIterator* iter;
-	struct party_data* p;
-	struct party_data* result = NULL;
+	return (struct party_data*)strdb_get(party_name_db, str);
+}
 
-	iter = party_db->iterator(party_db);
-	for( p = (struct party_data*)iter->first(iter,NULL); iter->exists(iter); p = (struct party_data*)iter->next(iter,NULL) )
-	{
-		if( strncmpi(p->party.name, str, NAME_LENGTH) == 0 )
-		{
-			result = p;
-			break;
-		}
-	}
-	iter->destroy(iter);
+// Removes the party from memory
+static void party_remove(int party_id)
+{
+	struct party_data* p = (struct party_data*)idb_get(party_db, party_id);
 
-	return result;
+	if( p == NULL )
+		return;
+	if( search_partyname(p->party.name) == p )
+		strdb_remove(party_name_db, p->party.name);
+	idb_remove(party_db, party_id);
 }
 
 // Returns whether this party can keep having exp share or not.
@@ -280,7 +281,7 @@ int party_check_empty(struct party *p) {
 		}
 	}
 	mapif_party_broken(p->party_id, 0);
-	idb_remove(party_db, p->party_id);
+	party_remove(p->party_id);
 
 	return 1;
 }
@@ -463,6 +464,7 @@ void mapif_parse_CreateParty(int fd, char* name, int item, int item2, struct par
 	p->party.member[0].leader = 1;
 	int_party_calc_state(p);
 	idb_put(party_db, p->party.party_id, p);
+	strdb_put(party_name_db, p->party.name, p);
 
 	mapif_party_info(fd, &p->party, 0);
 	mapif_party_created(fd, leader->account_id, leader->char_id, 0, p->party.party_id, p->party.name);
@@ -627,7 +629,7 @@ int mapif_parse_PartyChangeMap(int fd, int party_id, int account_id, int char_id
 // p?eBUv
 int mapif_parse_BreakParty(int fd, int party_id) {
 
-	idb_remove(party_db, party_id);
+	party_remove(party_id);
 	mapif_party_broken(fd, party_id);
 
 	return 0;
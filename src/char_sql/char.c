@@ -110,6 +110,8 @@ char char_name_letters[1024] = ""; // list of letters/symbols allowed (or not) i
 int char_per_account = 0; //Maximum charas per account (default unlimited) [Sirius]
 int char_del_level = 0; //From which level u can delete character [Lupus]
 int char_del_delay = 86400;
+bool char_select_cache = true; // keep the char-select list of each account in memory
+bool char_save_batch = true; // skip character saves superseded by a later save queued by the same map-server
 
 int log_char = 1;	// loggin char or not [devil]
 int log_inter = 1;	// loggin inter or not [devil]
@@ -198,6 +200,80 @@ struct online_char_data {
 static DBMap* online_char_db; // int account_id -> struct online_char_data*
 static int chardb_waiting_disconnect(int tid, unsigned int tick, int id, intptr_t data);
 
+//-----------------------------------------------------
+// Char-select Cache
+// Packed char-select entries of an account, as built by mmo_chars_fromsql.
+// Dropped whenever one of the account's characters changes.
+//-----------------------------------------------------
+
+#define CHAR_SELECT_CACHE_TIMEOUT 600000 // drop entries not used for 10 minutes
+
+struct char_select_data {
+	int found_char[MAX_CHARS];
+	int len;
+	uint8* buf;
+	unsigned int tick; // last use
+};
+
+static DBMap* char_select_db; // int account_id -> struct char_select_data*
+static unsigned int char_select_hits = 0;
+static unsigned int char_select_misses = 0;
+
+static void char_select_cache_release(struct char_select_data* cs)
+{
+	if( cs->buf )
+		aFree(cs->buf);
+	aFree(cs);
+}
+
+static int char_select_db_final(DBKey key, void* data, va_list ap)
+{
+	char_select_cache_release((struct char_select_data*)data);
+	return 0;
+}
+
+/// Drops the cached char-select list of an account.
+static void char_select_cache_remove(int account_id)
+{
+	struct char_select_data* cs;
+
+	if( char_select_db == NULL )
+		return;
+
+	if( (cs = (struct char_select_data*)idb_remove(char_select_db, account_id)) != NULL )
+		char_select_cache_release(cs);
+}
+
+static int char_select_cache_cleanup_sub(DBKey key, void* data, va_list ap)
+{
+	struct char_select_data* cs = (struct char_select_data*)data;
+	unsigned int tick = va_arg(ap, unsigned int);
+
+	if( DIFF_TICK(tick, cs->tick) >= CHAR_SELECT_CACHE_TIMEOUT )
+	{
+		db_remove(char_select_db, key);
+		char_select_cache_release(cs);
+	}
+	return 0;
+}
+
+/// Drops unused entries and reports the cache efficiency.
+static void char_select_cache_cleanup(unsigned int tick)
+{
+	if( char_select_db == NULL )
+		return;
+
+	char_select_db->foreach(char_select_db, char_select_cache_cleanup_sub, tick);
+
+	if( char_select_hits + char_select_misses > 0 )
+		ShowInfo("Char-select cache: %u hits, %u misses (%u%% hit rate), %d accounts cached.\n",
+			char_select_hits, char_select_misses,
+			(unsigned int)((uint64)char_select_hits * 100 / (char_select_hits + char_select_misses)),
+			char_select_db->size(char_select_db));
+	char_select_hits = 0;
+	char_select_misses = 0;
+}
+
 static void* create_online_char_data(DBKey key, va_list args)
 {
 	struct online_char_data* character;
@@ -302,6 +378,7 @@ void set_char_offline(int char_id, int account_id)
 		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `online`='0' WHERE `char_id`='%d'", char_db, char_id) )
 			Sql_ShowDebug(sql_handle);
 	}
+	inter_accreg_offline(account_id, char_id);
 
 	if ((character = (struct online_char_data*)idb_get(online_char_db, account_id)) != NULL)
 	{	//We don't free yet to avoid aCalloc/aFree spamming during char change. [Skotlex]
@@ -697,6 +774,8 @@ int mmo_char_tosql(int char_id, struct mmo_charstatus* p)
 	if (save_status[0]!='\0' && save_log)
 		ShowInfo("Saved char %d - %s:%s.\n", char_id, p->name, save_status);
 #ifndef TXT_SQL_CONVERT
+	if (save_status[0]!='\0' || errors)
+		char_select_cache_remove(p->account_id);
 	if (!errors)
 		memcpy(cp, p, sizeof(struct mmo_charstatus));
 #else
@@ -868,9 +947,22 @@ int mmo_chars_fromsql(struct char_session_data* sd, uint8* buf)
 {
 	SqlStmt* stmt;
 	struct mmo_charstatus p;
+	struct char_select_data* cs;
 	int j = 0, i;
 	char last_map[MAP_NAME_LENGTH_EXT];
 
+	memset(sd->new_name,0,sizeof(sd->new_name));
+
+	if( char_select_cache && (cs = (struct char_select_data*)idb_get(char_select_db, sd->account_id)) != NULL )
+	{// serve the list from memory
+		memcpy(sd->found_char, cs->found_char, sizeof(sd->found_char));
+		memcpy(buf, cs->buf, cs->len);
+		cs->tick = gettick();
+		char_select_hits++;
+		return cs->len;
+	}
+	char_select_misses++;
+
 	stmt = SqlStmt_Malloc(sql_handle);
 	if( stmt == NULL )
 	{
@@ -939,9 +1031,22 @@ int mmo_chars_fromsql(struct char_session_data* sd, uint8* buf)
 	for( ; i < MAX_CHARS; i++ )
 		sd->found_char[i] = -1;
 
-	memset(sd->new_name,0,sizeof(sd->new_name));
-
 	SqlStmt_Free(stmt);
+
+	if( char_select_cache )
+	{
+		CREATE(cs, struct char_select_data, 1);
+		memcpy(cs->found_char, sd->found_char, sizeof(cs->found_char));
+		cs->len = j;
+		if( j > 0 )
+		{
+			CREATE(cs->buf, uint8, j);
+			memcpy(cs->buf, buf, j);
+		}
+		cs->tick = gettick();
+		idb_put(char_select_db, sd->account_id, cs);
+	}
+
 	return j;
 }
 
@@ -1264,6 +1369,7 @@ int rename_char_sql(struct char_session_data *sd, int char_id)
 		Sql_ShowDebug(sql_handle);
 		return 3;
 	}
+	char_select_cache_remove(sd->account_id);
 
 	// Change character's name into guild_db.
 	if( char_dat.guild_id )
@@ -1385,6 +1491,7 @@ int make_new_char_sql(struct char_session_data* sd, char* name_, int str, int ag
 	}
 	//Retrieve the newly auto-generated char id
 	char_id = (int)Sql_LastInsertId(sql_handle);
+	char_select_cache_remove(sd->account_id);
 	//Give the char the default items
 	if (start_weapon > 0) { //add Start Weapon (Knife?)
 		if( SQL_ERROR == Sql_Query(sql_handle, "INSERT INTO `%s` (`char_id`,`nameid`, `amount`, `identify`) VALUES ('%d', '%d', '%d', '%d')", inventory_db, char_id, start_weapon, 1, 1) )
@@ -1558,6 +1665,7 @@ int delete_char_sql(int char_id)
 	/* delete character */
 	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `char_id`='%d'", char_db, char_id) )
 		Sql_ShowDebug(sql_handle);
+	char_select_cache_remove(account_id);
 
 	/* No need as we used inter_guild_leave [Skotlex]
 	// Also delete info from guildtables.
@@ -2071,6 +2179,7 @@ int parse_fromlogin(int fd)
 						Sql_ShowDebug(sql_handle);
 					if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `class`='%d', `weapon`='0', `shield`='0', `head_top`='0', `head_mid`='0', `head_bottom`='0' WHERE `char_id`='%d'", char_db, class_[i], char_id[i]) )
 						Sql_ShowDebug(sql_handle);
+					char_select_cache_remove(acc);
 
 					if( guild_id[i] )// If there is a guild, update the guild_member data [Skotlex]
 						inter_guild_sex_changed(guild_id[i], acc, char_id[i], sex);
@@ -2437,10 +2546,39 @@ void mapif_on_disconnect(int id)
 }
 
 
+/// Returns the amount of complete character saves (0x2b01) at the front of the fifo.
+static int mapif_queued_saves(int fd)
+{
+	size_t pos = 0;
+	int count = 0;
+
+	while( RFIFOREST(fd) >= pos + 4 && RFIFOW(fd,pos) == 0x2b01 && RFIFOW(fd,pos+2) >= 4 && RFIFOREST(fd) >= pos + RFIFOW(fd,pos+2) )
+	{
+		pos += RFIFOW(fd,pos+2);
+		count++;
+	}
+	return count;
+}
+
+/// Checks if one of the 'count' saves queued after the current one carries newer data of the same character.
+static bool mapif_save_superseded(int fd, int char_id, int count)
+{
+	size_t pos = RFIFOW(fd,2);
+
+	for( ; count > 0; --count )
+	{
+		if( RFIFOW(fd,pos+2) - 13 == sizeof(struct mmo_charstatus) && RFIFOL(fd,pos+8) == char_id )
+			return true;
+		pos += RFIFOW(fd,pos+2);
+	}
+	return false;
+}
+
 int parse_frommap(int fd)
 {
 	int i, j;
 	int id;
+	int saves_left = 0; // complete character saves left in the current run of the fifo
 
 	ARR_FIND( 0, ARRAYLENGTH(server), id, server[id].fd == fd );
 	if( id == ARRAYLENGTH(server) )
@@ -2618,27 +2756,37 @@ int parse_frommap(int fd)
 		{
 			int aid = RFIFOL(fd,4), cid = RFIFOL(fd,8), size = RFIFOW(fd,2);
 			struct online_char_data* character;
+			bool skip = false;
+
+			if( char_save_batch )
+			{// a regular save followed by another save of the same character in this run would be overwritten anyway
+				if( saves_left == 0 )
+					saves_left = mapif_queued_saves(fd);
+				skip = ( !RFIFOB(fd,12) && saves_left > 1 && mapif_save_superseded(fd, cid, saves_left - 1) );
+				--saves_left;
+			}
 
 			if (size - 13 != sizeof(struct mmo_charstatus))
 			{
 				ShowError("parse_from_map (save-char): Size mismatch! %d != %d\n", size-13, sizeof(struct mmo_charstatus));
-				RFIFOSKIP(fd,size);
-				break;
 			}
 			//Check account only if this ain't final save. Final-save goes through because of the char-map reconnect
-			if (RFIFOB(fd,12) || (
+			else if (RFIFOB(fd,12) || skip || (
 				(character = (struct online_char_data*)idb_get(online_char_db, aid)) != NULL &&
 				character->char_id == cid))
 			{
-				struct mmo_charstatus char_dat;
-				memcpy(&char_dat, RFIFOP(fd,13), sizeof(struct mmo_charstatus));
-				mmo_char_tosql(cid, &char_dat);
+				if( !skip )
+				{
+					struct mmo_charstatus char_dat;
+					memcpy(&char_dat, RFIFOP(fd,13), sizeof(struct mmo_charstatus));
+					mmo_char_tosql(cid, &char_dat);
+				}
 			} else {	//This may be valid on char-server reconnection, when re-sending characters that already logged off.
 				ShowError("parse_from_map (save-char): Received data for non-existant/offline character (%d:%d).\n", aid, cid);
 				set_char_online(id, cid, aid);
 			}
 
-			if (RFIFOB(fd,12))
+			if (size - 13 == sizeof(struct mmo_charstatus) && RFIFOB(fd,12))
 			{	//Flag, set character offline after saving. [Skotlex]
 				set_char_offline(cid, aid);
 				WFIFOHEAD(fd,10);
@@ -3302,6 +3450,7 @@ static void char_delete2_req(int fd, struct char_session_data* sd)
 		char_delete2_ack(fd, char_id, 3, 0);
 		return;
 	}
+	char_select_cache_remove(sd->account_id);
 
 	char_delete2_ack(fd, char_id, 1, delete_date);
 }
@@ -3409,6 +3558,7 @@ static void char_delete2_cancel(int fd, struct char_session_data* sd)
 		char_delete2_cancel_ack(fd, char_id, 2);
 		return;
 	}
+	char_select_cache_remove(sd->account_id);
 
 	char_delete2_cancel_ack(fd, char_id, 1);
 }
@@ -3948,12 +4098,20 @@ int parse_console(const char* command)
 		runflag = SERVER_STATE_STOP;
 	else if( strcmpi("alive", command) == 0 || strcmpi("status", command) == 0 )
 		ShowInfo(CL_CYAN"Console: "CL_BOLD"I'm Alive."CL_RESET"\n");
+	else if( strcmpi("memory", command) == 0 )
+		malloc_report(20);
+	else if( strcmpi("sockets", command) == 0 )
+		socket_report(20);
 	else if( strcmpi("help", command) == 0 )
 	{
 		ShowInfo("To shutdown the server:\n");
 		ShowInfo("  'shutdown|exit|quit|end'\n");
 		ShowInfo("To know if server is alive:\n");
 		ShowInfo("  'alive|status'\n");
+		ShowInfo("To show the allocations by size class and call site:\n");
+		ShowInfo("  'memory'\n");
+		ShowInfo("To show the bytes, packets and send calls of the connections:\n");
+		ShowInfo("  'sockets'\n");
 	}
 
 	return 0;
@@ -4148,6 +4306,7 @@ static int online_data_cleanup_sub(DBKey key, void *data, va_list ap)
 static int online_data_cleanup(int tid, unsigned int tick, int id, intptr_t data)
 {
 	online_char_db->foreach(online_char_db, online_data_cleanup_sub);
+	char_select_cache_cleanup(tick);
 	return 0;
 }
 
@@ -4410,6 +4569,10 @@ int char_config_read(const char* cfgName)
 			char_del_level = atoi(w2);
 		} else if (strcmpi(w1, "char_del_delay") == 0) {
 			char_del_delay = atoi(w2);
+		} else if (strcmpi(w1, "char_select_cache") == 0) {
+			char_select_cache = (bool)config_switch(w2);
+		} else if (strcmpi(w1, "char_save_batch") == 0) {
+			char_save_batch = (bool)config_switch(w2);
 		} else if(strcmpi(w1,"db_path")==0) {
 			safestrncpy(db_path, w2, sizeof(db_path));
 		} else if (strcmpi(w1, "console") == 0) {
@@ -4464,6 +4627,7 @@ void do_final(void)
 	char_db_->destroy(char_db_, NULL);
 	online_char_db->destroy(online_char_db, NULL);
 	auth_db->destroy(auth_db, NULL);
+	char_select_db->destroy(char_select_db, char_select_db_final);
 
 	if( char_fd != -1 )
 	{
@@ -4533,6 +4697,7 @@ int do_init(int argc, char **argv)
 	ShowInfo("Initializing char server.\n");
 	auth_db = idb_alloc(DB_OPT_RELEASE_DATA);
 	online_char_db = idb_alloc(DB_OPT_RELEASE_DATA);
+	char_select_db = idb_alloc(DB_OPT_BASE);
 	mmo_char_sql_init();
 	char_read_fame_list(); //Read fame lists.
 	ShowInfo("char server initialized.\n");
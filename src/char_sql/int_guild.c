@@ -33,6 +33,7 @@ static const char dataToHex[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9
 #ifndef TXT_SQL_CONVERT
 //Guild cache
 static DBMap* guild_db_; // int guild_id -> struct guild*
+static DBMap* guild_name_db; // char* guild name -> int guild_id (case-insensitive)
 
 struct guild_castle castles[MAX_GUILDCASTLE];
 
@@ -155,6 +156,7 @@ int inter_guild_tosql(struct guild *g,int flag)
 		else
 		{
 			g->guild_id = (int)Sql_LastInsertId(sql_handle);
+			strdb_put(guild_name_db, g->name, (void*)(intptr)g->guild_id);
 			new_guild = 1;
 		}
 	}
@@ -780,9 +782,26 @@ int inter_guild_CharOffline(int char_id, int guild_id)
 // Initialize guild sql
 int inter_guild_sql_init(void)
 {
+	char* data;
+
 	//Initialize the guild cache
 	guild_db_= idb_alloc(DB_OPT_RELEASE_DATA);
 
+	//Build the guild name index
+	guild_name_db = stridb_alloc(DB_OPT_DUP_KEY, NAME_LENGTH);
+	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT `guild_id`, `name` FROM `%s`", guild_db) )
+		Sql_ShowDebug(sql_handle);
+	while( SQL_SUCCESS == Sql_NextRow(sql_handle) )
+	{
+		char name[NAME_LENGTH];
+		int guild_id;
+
+		Sql_GetData(sql_handle, 0, &data, NULL); guild_id = atoi(data);
+		Sql_GetData(sql_handle, 1, &data, NULL); safestrncpy(name, data, sizeof(name));
+		strdb_put(guild_name_db, name, (void*)(intptr)guild_id);
+	}
+	Sql_FreeResult(sql_handle);
+
    //Read exp file
 	inter_guild_ReadEXP();
    
@@ -804,36 +823,14 @@ static int guild_db_final(DBKey key, void *data, va_list ap)
 void inter_guild_sql_final(void)
 {
 	guild_db_->destroy(guild_db_, guild_db_final);
+	guild_name_db->destroy(guild_name_db, NULL);
 	return;
 }
 
-// Get guild_id by its name. Returns 0 if not found, -1 on error.
+// Get guild_id by its name (case-insensitive). Returns 0 if not found.
 int search_guildname(char *str)
 {
-	int guild_id;
-	char esc_name[NAME_LENGTH*2+1];
-	
-	Sql_EscapeStringLen(sql_handle, esc_name, str, safestrnlen(str, NAME_LENGTH));
-	//Lookup guilds with the same name
-	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT guild_id FROM `%s` WHERE name='%s'", guild_db, esc_name) )
-	{
-		Sql_ShowDebug(sql_handle);
-		return -1;
-	}
-
-	if( SQL_SUCCESS == Sql_NextRow(sql_handle) )
-	{
-		char* data;
-
-		Sql_GetData(sql_handle, 0, &data, NULL);
-		guild_id = atoi(data);
-	}
-	else
-	{
-		guild_id = 0;
-	}
-	Sql_FreeResult(sql_handle);
-	return guild_id;
+	return (int)(intptr)strdb_get(guild_name_db, str);
 }
 
 // Check if guild is empty
@@ -1520,6 +1517,8 @@ int mapif_parse_BreakGuild(int fd,int guild_id)
 		inter_log("guild %s (id=%d) broken\n",g->name,guild_id);
 
 	//Remove the guild from memory. [Skotlex]
+	if( (int)(intptr)strdb_get(guild_name_db, g->name) == guild_id )
+		strdb_remove(guild_name_db, g->name);
 	idb_remove(guild_db_, guild_id);
 	return 0;
 }
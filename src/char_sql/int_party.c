@@ -28,6 +28,7 @@ struct party_data {
 
 static struct party_data *party_pt;
 static DBMap* party_db_; // int party_id -> struct party_data*
+static DBMap* party_name_db; // char* party name -> int party_id (case-insensitive)
 
 int mapif_party_broken(int party_id,int flag);
 int party_check_empty(struct party_data *p);
@@ -128,6 +129,8 @@ int inter_party_tosql(struct party *p, int flag, int index)
 		if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `party_id`='%d'", party_db, party_id) )
 			Sql_ShowDebug(sql_handle);
 		//Remove from memory
+		if( (int)(intptr)strdb_get(party_name_db, p->name) == party_id )
+			strdb_remove(party_name_db, p->name);
 		idb_remove(party_db_, party_id);
 		return 1;
 	}
@@ -144,6 +147,7 @@ int inter_party_tosql(struct party *p, int flag, int index)
 			return 0;
 		}
 		party_id = p->party_id = (int)Sql_LastInsertId(sql_handle);
+		strdb_put(party_name_db, p->name, (void*)(intptr)party_id);
 #else
 		//During conversion, you want to specify the id, and allow overwriting
 		//(in case someone is re-running the process.
@@ -268,6 +272,8 @@ struct party_data *inter_party_fromsql(int party_id)
 
 int inter_party_sql_init(void)
 {
+	char* data;
+
 	//memory alloc
 	party_db_ = idb_alloc(DB_OPT_RELEASE_DATA);
 	party_pt = (struct party_data*)aCalloc(sizeof(struct party_data), 1);
@@ -276,6 +282,21 @@ int inter_party_sql_init(void)
 		exit(EXIT_FAILURE);
 	}
 
+	// build the party name index
+	party_name_db = stridb_alloc(DB_OPT_DUP_KEY, NAME_LENGTH);
+	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT `party_id`, `name` FROM `%s`", party_db) )
+		Sql_ShowDebug(sql_handle);
+	while( SQL_SUCCESS == Sql_NextRow(sql_handle) )
+	{
+		char name[NAME_LENGTH];
+		int party_id;
+
+		Sql_GetData(sql_handle, 0, &data, NULL); party_id = atoi(data);
+		Sql_GetData(sql_handle, 1, &data, NULL); safestrncpy(name, data, sizeof(name));
+		strdb_put(party_name_db, name, (void*)(intptr)party_id);
+	}
+	Sql_FreeResult(sql_handle);
+
 	/* Uncomment the following if you want to do a party_db cleanup (remove parties with no members) on startup.[Skotlex]
 	ShowStatus("cleaning party table...\n");
 	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` USING `%s` LEFT JOIN `%s` ON `%s`.leader_id =`%s`.account_id AND `%s`.leader_char = `%s`.char_id WHERE `%s`.account_id IS NULL",
@@ -288,28 +309,15 @@ int inter_party_sql_init(void)
 void inter_party_sql_final(void)
 {
 	party_db_->destroy(party_db_, NULL);
+	party_name_db->destroy(party_name_db, NULL);
 	aFree(party_pt);
 	return;
 }
 
-// Search for the party according to its name
-struct party_data* search_partyname(char* str)
+// Get party_id by its name (case-insensitive). Returns 0 if not found.
+int search_partyname(char* str)
 {
-	char esc_name[NAME_LENGTH*2+1];
-	char* data;
-	struct party_data* p = NULL;
-
-	Sql_EscapeStringLen(sql_handle, esc_name, str, safestrnlen(str, NAME_LENGTH));
-	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT `party_id` FROM `%s` WHERE `name`='%s'", party_db, esc_name) )
-		Sql_ShowDebug(sql_handle);
-	else if( SQL_SUCCESS == Sql_NextRow(sql_handle) )
-	{
-		Sql_GetData(sql_handle, 0, &data, NULL);
-		p = inter_party_fromsql(atoi(data));
-	}
-	Sql_FreeResult(sql_handle);
-
-	return p;
+	return (int)(intptr)strdb_get(party_name_db, str);
 }
 
 // Returns whether this party can keep having exp share or not.
@@ -464,7 +472,7 @@ static void mapif_parse_CreateParty(int fd, char* name, int item, int item2, str
 {
 	struct party_data *p;
 	int i;
-	if( (p=search_partyname(name))!=NULL){
+	if( search_partyname(name) != 0 ){
 		mapif_party_created(fd, leader->account_id, leader->char_id, 1, 0, "");
 		return;
 	}
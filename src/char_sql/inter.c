@@ -66,13 +66,109 @@ static DBMap* wis_db = NULL; // int wis_id -> struct WisData*
 static int wis_dellist[WISDELLIST_MAX], wis_delnum;
 
 #endif //TXT_SQL_CONVERT
+#ifndef TXT_SQL_CONVERT
+//--------------------------------------------------------
+// Registry snapshots
+// Registry values as last read from/written to sql, so that a save only
+// has to write the values that changed. Stored packed as "str\0value\0"
+// pairs, dropped when the owner goes offline.
+
+struct accreg_snapshot {
+	int reg_num;
+	char* data;
+};
+
+static DBMap* accreg_char_db; // int char_id -> struct accreg_snapshot* (type 3)
+static DBMap* accreg_account_db; // int account_id -> struct accreg_snapshot* (type 2)
+
+static unsigned int accreg_save_count = 0; // mapif_parse_Registry calls
+static unsigned int accreg_row_count = 0; // rows deleted or written by them
+
+static void accreg_snapshot_free(struct accreg_snapshot* snap)
+{
+	aFree(snap->data);
+	aFree(snap);
+}
+
+static int accreg_snapshot_db_final(DBKey key, void* data, va_list ap)
+{
+	accreg_snapshot_free((struct accreg_snapshot*)data);
+	return 0;
+}
+
+static DBMap* accreg_snapshot_db(int type)
+{
+	return ( type == 3 ) ? accreg_char_db : accreg_account_db;
+}
+
+/// Drops the snapshot of an owner (char_id for type 3, account_id for type 2).
+static void accreg_snapshot_remove(int type, int owner_id)
+{
+	struct accreg_snapshot* snap = (struct accreg_snapshot*)idb_remove(accreg_snapshot_db(type), owner_id);
+	if( snap != NULL )
+		accreg_snapshot_free(snap);
+}
+
+/// Replaces the snapshot of an owner with the non-empty values of reg.
+static void accreg_snapshot_set(int type, int owner_id, const struct accreg* reg)
+{
+	struct accreg_snapshot* snap;
+	size_t size = 1;
+	char* p;
+	int i;
+
+	accreg_snapshot_remove(type, owner_id);
+
+	for( i = 0; i < reg->reg_num; ++i )
+		if( reg->reg[i].str[0] != '\0' && reg->reg[i].value[0] != '\0' )
+			size += strnlen(reg->reg[i].str, sizeof(reg->reg[i].str)) + strnlen(reg->reg[i].value, sizeof(reg->reg[i].value)) + 2;
+
+	CREATE(snap, struct accreg_snapshot, 1);
+	CREATE(snap->data, char, size);
+	for( i = 0, p = snap->data; i < reg->reg_num; ++i )
+	{
+		const struct global_reg* r = &reg->reg[i];
+		size_t len;
+
+		if( r->str[0] == '\0' || r->value[0] == '\0' )
+			continue;
+		len = strnlen(r->str, sizeof(r->str));
+		memcpy(p, r->str, len); p += len; *p++ = '\0';
+		len = strnlen(r->value, sizeof(r->value));
+		memcpy(p, r->value, len); p += len; *p++ = '\0';
+		snap->reg_num++;
+	}
+	idb_put(accreg_snapshot_db(type), owner_id, snap);
+}
+
+/// Called when a character (char_id) or a whole account (char_id -1) goes offline.
+void inter_accreg_offline(int account_id, int char_id)
+{
+	if( char_id != -1 )
+		accreg_snapshot_remove(3, char_id);
+	accreg_snapshot_remove(2, account_id);
+}
+#endif //TXT_SQL_CONVERT
+
 //--------------------------------------------------------
 // Save registry to sql
+// Only the values that differ from the last saved snapshot are written:
+// removed values are deleted and new/changed values go into a single
+// multi-row REPLACE. Without a snapshot all of the owner's values are replaced.
 int inter_accreg_tosql(int account_id, int char_id, struct accreg* reg, int type)
 {
-	struct global_reg* r;
-	SqlStmt* stmt;
-	int i;
+	const char* old_str[MAX_REG_NUM];
+	const char* old_val[MAX_REG_NUM];
+	bool old_kept[MAX_REG_NUM];
+	int old_num = 0;
+	bool have_old = false;
+	int owner_id;
+	int deleted = 0, written = 0;
+	bool error = false;
+	StringBuf del, ins;
+	char esc_str[sizeof(reg->reg[0].str)*2+1];
+	char esc_val[sizeof(reg->reg[0].value)*2+1];
+	int i, j;
 
 	if( account_id <= 0 )
 		return 0;
@@ -83,14 +179,12 @@ int inter_accreg_tosql(int account_id, int char_id, struct accreg* reg, int type
 	switch( type )
 	{
 	case 3: //Char Reg
-		if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `type`=3 AND `char_id`='%d'", reg_db, char_id) )
-			Sql_ShowDebug(sql_handle);
 		account_id = 0;
+		owner_id = char_id;
 		break;
 	case 2: //Account Reg
-		if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `type`=2 AND `account_id`='%d'", reg_db, account_id) )
-			Sql_ShowDebug(sql_handle);
 		char_id = 0;
+		owner_id = account_id;
 		break;
 	case 1: //Account2 Reg
 		ShowError("inter_accreg_tosql: Char server shouldn't handle type 1 registry values (##). That is the login server's work!\n");
@@ -100,27 +194,114 @@ int inter_accreg_tosql(int account_id, int char_id, struct accreg* reg, int type
 		return 0;
 	}
 
-	if( reg->reg_num <= 0 )
-		return 0;
+#ifndef TXT_SQL_CONVERT
+	{
+		struct accreg_snapshot* snap = (struct accreg_snapshot*)idb_get(accreg_snapshot_db(type), owner_id);
+		if( snap != NULL )
+		{
+			const char* p = snap->data;
+			for( old_num = 0; old_num < snap->reg_num && old_num < MAX_REG_NUM; ++old_num )
+			{
+				old_str[old_num] = p; p += strlen(p) + 1;
+				old_val[old_num] = p; p += strlen(p) + 1;
+				old_kept[old_num] = false;
+			}
+			have_old = true;
+		}
+	}
+#endif
+
+	StringBuf_Init(&del);
+	StringBuf_Init(&ins);
+
+	if( !have_old )
+	{// no snapshot, replace everything
+		if( type == 3 )
+			StringBuf_Printf(&del, "DELETE FROM `%s` WHERE `type`=3 AND `char_id`='%d'", reg_db, char_id);
+		else
+			StringBuf_Printf(&del, "DELETE FROM `%s` WHERE `type`=2 AND `account_id`='%d'", reg_db, account_id);
+	}
 
-	stmt = SqlStmt_Malloc(sql_handle);
-	if( SQL_ERROR == SqlStmt_Prepare(stmt, "INSERT INTO `%s` (`type`, `account_id`, `char_id`, `str`, `value`) VALUES ('%d','%d','%d',?,?)", reg_db, type, account_id, char_id) )
-		SqlStmt_ShowDebug(stmt);
 	for( i = 0; i < reg->reg_num; ++i )
 	{
-		r = &reg->reg[i];
-		if( r->str[0] != '\0' && r->value != '\0' )
+		struct global_reg* r = &reg->reg[i];
+
+		if( r->str[0] == '\0' || r->value[0] == '\0' )
+			continue;
+
+		if( have_old )
+		{
+			// values usually come back in the same order
+			if( i < old_num && !old_kept[i] && strncmp(old_str[i], r->str, sizeof(r->str)) == 0 )
+				j = i;
+			else
+				ARR_FIND(0, old_num, j, !old_kept[j] && strncmp(old_str[j], r->str, sizeof(r->str)) == 0);
+
+			if( j < old_num )
+			{
+				old_kept[j] = true;
+				if( strncmp(old_val[j], r->value, sizeof(r->value)) == 0 )
+					continue; // unchanged
+			}
+		}
+
+		Sql_EscapeStringLen(sql_handle, esc_str, r->str, strnlen(r->str, sizeof(r->str)));
+		Sql_EscapeStringLen(sql_handle, esc_val, r->value, strnlen(r->value, sizeof(r->value)));
+		if( written == 0 )
+			StringBuf_Printf(&ins, "REPLACE INTO `%s` (`type`, `account_id`, `char_id`, `str`, `value`) VALUES ", reg_db);
+		else
+			StringBuf_AppendStr(&ins, ",");
+		StringBuf_Printf(&ins, "('%d','%d','%d','%s','%s')", type, account_id, char_id, esc_str, esc_val);
+		written++;
+	}
+
+	for( j = 0; j < old_num; ++j )
+	{// values that are gone
+		if( old_kept[j] )
+			continue;
+		Sql_EscapeStringLen(sql_handle, esc_str, old_str[j], strlen(old_str[j]));
+		if( deleted == 0 )
 		{
-			// str
-			SqlStmt_BindParam(stmt, 0, SQLDT_STRING, r->str, strnlen(r->str, sizeof(r->str)));
-			// value
-			SqlStmt_BindParam(stmt, 1, SQLDT_STRING, r->value, strnlen(r->value, sizeof(r->value)));
+			if( type == 3 )
+				StringBuf_Printf(&del, "DELETE FROM `%s` WHERE `type`=3 AND `char_id`='%d' AND `str` IN (", reg_db, char_id);
+			else
+				StringBuf_Printf(&del, "DELETE FROM `%s` WHERE `type`=2 AND `account_id`='%d' AND `str` IN (", reg_db, account_id);
+		}
+		else
+			StringBuf_AppendStr(&del, ",");
+		StringBuf_Printf(&del, "'%s'", esc_str);
+		deleted++;
+	}
+	if( deleted > 0 )
+		StringBuf_AppendStr(&del, ")");
 
-			if( SQL_ERROR == SqlStmt_Execute(stmt) )
-				SqlStmt_ShowDebug(stmt);
+	// on error the snapshot is dropped below, so the next save rewrites all values
+	if( StringBuf_Length(&del) > 0 )
+	{
+		if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&del)) )
+		{
+			Sql_ShowDebug(sql_handle);
+			error = true;
 		}
+		else
+			deleted = (int)Sql_AffectedRows(sql_handle);
 	}
-	SqlStmt_Free(stmt);
+	if( !error && StringBuf_Length(&ins) > 0 && SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&ins)) )
+	{
+		Sql_ShowDebug(sql_handle);
+		error = true;
+	}
+
+	StringBuf_Destroy(&del);
+	StringBuf_Destroy(&ins);
+
+#ifndef TXT_SQL_CONVERT
+	accreg_row_count += deleted + written;
+	if( error )
+		accreg_snapshot_remove(type, owner_id); // unknown state, rewrite everything next time
+	else
+		accreg_snapshot_set(type, owner_id, reg);
+#endif
 	return 1;
 }
 #ifndef TXT_SQL_CONVERT
@@ -170,6 +351,8 @@ int inter_accreg_fromsql(int account_id,int char_id, struct accreg *reg, int typ
 	}
 	reg->reg_num = i;
 	Sql_FreeResult(sql_handle);
+
+	accreg_snapshot_set(type, ( type == 3 ) ? char_id : account_id, reg);
 	return 1;
 }
 
@@ -177,6 +360,8 @@ int inter_accreg_fromsql(int account_id,int char_id, struct accreg *reg, int typ
 int inter_accreg_sql_init(void)
 {
 	CREATE(accreg_pt, struct accreg, 1);
+	accreg_char_db = idb_alloc(DB_OPT_BASE);
+	accreg_account_db = idb_alloc(DB_OPT_BASE);
 	return 0;
 
 }
@@ -326,6 +511,10 @@ void inter_final(void)
 	inter_auction_sql_final();
 	
 	if (accreg_pt) aFree(accreg_pt);
+	accreg_char_db->destroy(accreg_char_db, accreg_snapshot_db_final);
+	accreg_account_db->destroy(accreg_account_db, accreg_snapshot_db_final);
+	if( accreg_save_count > 0 )
+		ShowInfo("Registry saves: %u, rows written: %u (%.2f per save).\n", accreg_save_count, accreg_row_count, (double)accreg_row_count / accreg_save_count);
 	return;
 }
 
@@ -620,6 +809,7 @@ int mapif_parse_Registry(int fd)
 	}
 	reg->reg_num=j;
 
+	accreg_save_count++;
 	inter_accreg_tosql(RFIFOL(fd,4),RFIFOL(fd,8),reg, RFIFOB(fd,12));
 	mapif_account_reg(fd,RFIFOP(fd,0));	// Send updated accounts to other map servers.
 	return 0;
@@ -26,5 +26,6 @@ extern Sql* lsql_handle;
 extern char main_chat_nick[16];
 
 int inter_accreg_tosql(int account_id, int char_id, struct accreg *reg, int type);
+void inter_accreg_offline(int account_id, int char_id);
 
 #endif /* _INTER_SQL_H_ */
@@ -10,6 +10,12 @@
  *  (5) Public functions
  *
  *  The databases are structured as a hashtable of RED-BLACK trees.
+ *  Numeric databases can instead use an open addressing hashtable
+ *  (DB_OPT_OPEN_HASH): the entries are kept in an array in insertion order
+ *  and a power of 2 sized index of entry positions is searched with linear
+ *  probing. Removed entries stay in the array (marked as deleted) while the
+ *  database is locked and are compacted away when it's unlocked, so
+ *  iterators keep their position across removals and insertions.
  *
  *  <B>Properties of the RED-BLACK trees being used:</B>
  *  1. The value of any node is greater than the value of its left child and
@@ -48,6 +54,7 @@
  *  - create a db that organizes itself by splaying
  *
  *  HISTORY:
+ *    2026/10/18 - Added the open addressing hashtable (DB_OPT_OPEN_HASH).
  *    2008/02/19 - Fixed db_obj_get not handling deleted entries correctly.
  *    2007/11/09 - Added an iterator to the database.
  *    2006/12/21 - Added 1-node cache to the database.
@@ -83,6 +90,7 @@
  *  DBNColor        - Enumeration of colors of the nodes.                    *
  *  DBNode          - Structure of a node in RED-BLACK trees.                *
  *  struct db_free  - Structure that holds a deleted node to be freed.       *
+ *  struct dbe      - Structure of an entry in open addressing hashtables.   *
  *  DBMap_impl      - Struture of the database.                              *
  *  stats           - Statistics about the database system.                  *
 \*****************************************************************************/
@@ -153,6 +161,28 @@ struct db_free {
 	DBNode *root;
 };
 
+/**
+ * An entry of an open addressing hashtable.
+ * @param key Key of this database entry
+ * @param data Data of this database entry
+ * @param deleted If the entry is deleted
+ * @private
+ * @see DBMap_impl#ent
+ * @see #DB_OPT_OPEN_HASH
+ */
+struct dbe {
+	DBKey key;
+	void *data;
+	unsigned deleted : 1;
+};
+
+/**
+ * Initial number of bits of the index of open addressing hashtables.
+ * @private
+ * @see DBMap_impl#idx_bits
+ */
+#define DBO_INITIAL_BITS 4
+
 /**
  * Complete database structure.
  * @param vtable Interface of the database
@@ -172,6 +202,14 @@ struct db_free {
  * @param item_count Number of items in the database
  * @param maxlen Maximum length of strings in DB_STRING and DB_ISTRING databases
  * @param global_lock Global lock of the database
+ * @param ent Entries of the open addressing hashtable, in insertion order
+ * @param ent_count Number of used entries in ent (including deleted ones)
+ * @param ent_max Current maximum capacity of ent
+ * @param ent_deleted Number of deleted entries in ent
+ * @param ent_cache Position of the last entry found in ent (-1 if none)
+ * @param idx Index of the open addressing hashtable, holds the position 
+ *          of an entry + 1 or 0 if the slot is free
+ * @param idx_bits The index has 2^idx_bits slots
  * @private
  * @see #db_alloc(const char*,int,DBType,DBOptions,unsigned short)
  */
@@ -199,6 +237,14 @@ typedef struct DBMap_impl {
 	uint32 item_count;
 	unsigned short maxlen;
 	unsigned global_lock : 1;
+	// Open addressing hashtable (DB_OPT_OPEN_HASH)
+	struct dbe *ent;
+	unsigned int ent_count;
+	unsigned int ent_max;
+	unsigned int ent_deleted;
+	int ent_cache;
+	unsigned int *idx;
+	unsigned int idx_bits;
 } DBMap_impl;
 
 /**
@@ -206,6 +252,7 @@ typedef struct DBMap_impl {
  * @param vtable Interface of the iterator
  * @param db Parent database
  * @param ht_index Current index of the hashtable
+ *          (current position in the entries of open addressing hashtables)
  * @param node Current node
  * @private
  * @see #DBIterator
@@ -328,6 +375,13 @@ static struct db_stats {
  *  db_free_unlock     - Decrement the free_lock of a database.              *
  *         If it was the last lock, frees the nodes in free_list.            *
  *         NOTE: Keeps the database trees balanced.                          *
+ *  dbo_slot           - First index slot of a hash (open hashtables).       *
+ *  dbo_find           - Find the position of an entry (open hashtables).    *
+ *  dbo_link           - Put an entry in the index (open hashtables).        *
+ *  dbo_rehash         - Rebuild the index (open hashtables).                *
+ *  dbo_insert         - Add a new entry (open hashtables).                  *
+ *  dbo_free_add       - Mark an entry as deleted (open hashtables).         *
+ *  dbo_compact        - Remove the deleted entries (open hashtables).       *
 \*****************************************************************************/
 
 /**
@@ -787,6 +841,7 @@ static void db_free_lock(DBMap_impl* db)
  * @see #db_free_dbn(DBNode)
  * @see #db_lock(DBMap_impl*)
  */
+static void dbo_compact(DBMap_impl* db);
 static void db_free_unlock(DBMap_impl* db)
 {
 	unsigned int i;
@@ -802,6 +857,13 @@ static void db_free_unlock(DBMap_impl* db)
 	if (db->free_lock)
 		return; // Not last lock
 
+	if (db->options&DB_OPT_OPEN_HASH) {
+		// compact once the deleted entries are half of the array
+		if (db->ent_deleted > 0 && db->ent_deleted*2 >= db->ent_count)
+			dbo_compact(db);
+		return;
+	}
+
 	for (i = 0; i < db->free_count ; i++) {
 		db_rebalance_erase(db->free_list[i].node, db->free_list[i].root);
 		db_dup_key_free(db, db->free_list[i].node->key);
@@ -811,6 +873,154 @@ static void db_free_unlock(DBMap_impl* db)
 	db->free_count = 0;
 }
 
+/**
+ * Returns the first slot of the index where the entry with this hash is 
+ * searched (fibonacci hashing, spreads sequential keys).
+ * @param db Target database
+ * @param hash Hash of the key
+ * @return Slot of the index
+ * @private
+ * @see DBMap_impl#idx
+ */
+static unsigned int dbo_slot(DBMap_impl* db, unsigned int hash)
+{
+	return (uint32)(hash*2654435769U)>>(32 - db->idx_bits);
+}
+
+/**
+ * Returns the position of the entry with the key, or -1 if there isn't one.
+ * Deleted entries are found too.
+ * @param db Target database
+ * @param key Key of the entry
+ * @return Position of the entry in DBMap_impl#ent or -1
+ * @private
+ */
+static int dbo_find(DBMap_impl* db, DBKey key)
+{
+	unsigned int mask;
+	unsigned int i;
+	unsigned int e;
+
+	if (db->idx == NULL)
+		return -1;
+	mask = (1U<<db->idx_bits) - 1;
+	for (i = dbo_slot(db, db->hash(key, db->maxlen)); (e = db->idx[i]) != 0; i = (i+1)&mask) {
+		if (db->cmp(key, db->ent[e-1].key, db->maxlen) == 0)
+			return (int)e - 1;
+	}
+	return -1;
+}
+
+/**
+ * Puts entry e in the first free slot of the index.
+ * @param db Target database
+ * @param e Position of the entry in DBMap_impl#ent
+ * @private
+ */
+static void dbo_link(DBMap_impl* db, unsigned int e)
+{
+	unsigned int mask = (1U<<db->idx_bits) - 1;
+	unsigned int i;
+
+	for (i = dbo_slot(db, db->hash(db->ent[e].key, db->maxlen)); db->idx[i] != 0; i = (i+1)&mask)
+		;
+	db->idx[i] = e + 1;
+}
+
+/**
+ * Rebuilds the index with 2^bits slots.
+ * Entry positions don't change, so it's safe while the database is locked.
+ * @param db Target database
+ * @param bits Number of bits of the new index
+ * @private
+ */
+static void dbo_rehash(DBMap_impl* db, unsigned int bits)
+{
+	unsigned int e;
+
+	if (db->idx_bits != bits || db->idx == NULL) {
+		if (db->idx)
+			aFree(db->idx);
+		db->idx_bits = bits;
+		CREATE(db->idx, unsigned int, 1U<<bits);
+	} else
+		memset(db->idx, 0, sizeof(db->idx[0])<<bits);
+	for (e = 0; e < db->ent_count; e++)
+		dbo_link(db, e);
+}
+
+/**
+ * Adds a new entry at the end of the entries.
+ * Grows the entries and the index as needed (load factor of the index up to 1/2).
+ * @param db Target database
+ * @param key Key of the entry
+ * @param data Data of the entry
+ * @return Position of the new entry
+ * @private
+ */
+static int dbo_insert(DBMap_impl* db, DBKey key, void* data)
+{
+	unsigned int e;
+
+	if (db->ent_count == db->ent_max) {
+		db->ent_max = (db->ent_max ? db->ent_max*2 : 1U<<(DBO_INITIAL_BITS-1));
+		RECREATE(db->ent, struct dbe, db->ent_max);
+	}
+	if (db->idx == NULL)
+		dbo_rehash(db, DBO_INITIAL_BITS);
+	else if ((db->ent_count + 1)*2 > (1U<<db->idx_bits))
+		dbo_rehash(db, db->idx_bits + 1);
+	e = db->ent_count++;
+	db->ent[e].key = key;
+	db->ent[e].data = data;
+	db->ent[e].deleted = 0;
+	dbo_link(db, e);
+	db->item_count++;
+	return (int)e;
+}
+
+/**
+ * Marks entry e as deleted.
+ * The entry stays in the index until the entries are compacted.
+ * @param db Target database
+ * @param e Position of the entry
+ * @private
+ * @see #dbo_compact(DBMap_impl*)
+ */
+static void dbo_free_add(DBMap_impl* db, unsigned int e)
+{
+	if (db->ent_cache == (int)e)
+		db->ent_cache = -1;
+	db->ent[e].deleted = 1;
+	db->ent_deleted++;
+	db->item_count--;
+}
+
+/**
+ * Removes the deleted entries, keeping the order of the others.
+ * Only done when the database isn't locked, since entries change position.
+ * @param db Target database
+ * @private
+ * @see #db_free_unlock(DBMap_impl*)
+ */
+static void dbo_compact(DBMap_impl* db)
+{
+	unsigned int i;
+	unsigned int j;
+
+	for (i = 0, j = 0; i < db->ent_count; i++) {
+		if (db->ent[i].deleted)
+			continue;
+		if (i != j)
+			db->ent[j] = db->ent[i];
+		j++;
+	}
+	db->ent_count = j;
+	db->ent_deleted = 0;
+	db->ent_cache = -1;
+	dbo_rehash(db, db->idx_bits);
+}
+
 /*****************************************************************************\
  *  (3) Section of protected functions used internally.                      *
  *  NOTE: the protected functions used in the database interface are in the  *
@@ -1096,6 +1306,8 @@ static void db_release_both(DBKey key, void *data, DBRelease which)
  *  db_obj_size     - Return the size of the database.                       *
  *  db_obj_type     - Return the type of the database.                       *
  *  db_obj_options  - Return the options of the database.                    *
+ *  dbit_open_* and dbo_obj_* - Versions of the above for open addressing    *
+ *           hashtables (DB_OPT_OPEN_HASH).                                  *
 \*****************************************************************************/
 
 /**
@@ -2114,6 +2326,10 @@ static int db_obj_vdestroy(DBMap* self, DBApply func, va_list args)
 	ers_destroy(db->iters);
 	ers_destroy(db->nodes);
 	db_free_unlock(db);
+	if (db->ent)
+		aFree(db->ent);
+	if (db->idx)
+		aFree(db->idx);
 	aFree(db);
 	return sum;
 }
@@ -2217,6 +2433,487 @@ static DBOptions db_obj_options(DBMap* self)
 	return options;
 }
 
+/**
+ * Fetches the next entry of an open addressing hashtable.
+ * Entries are fetched in insertion order.
+ * @param self Iterator
+ * @param out_key Key of the entry
+ * @return Data of the entry
+ * @protected
+ * @see DBIterator#next
+ */
+static void* dbit_open_next(DBIterator* self, DBKey* out_key)
+{
+	DBIterator_impl* it = (DBIterator_impl*)self;
+	DBMap_impl* db = it->db;
+
+	DB_COUNTSTAT(dbit_next);
+	if (it->ht_index < -1)
+		it->ht_index = -1;
+	while (++(it->ht_index) < (int)db->ent_count) {
+		if (!db->ent[it->ht_index].deleted) { // found next entry
+			if (out_key)
+				memcpy(out_key, &db->ent[it->ht_index].key, sizeof(DBKey));
+			return db->ent[it->ht_index].data;
+		}
+	}
+	it->ht_index = (int)db->ent_count;
+	return NULL; // not found
+}
+
+/**
+ * Fetches the previous entry of an open addressing hashtable.
+ * @param self Iterator
+ * @param out_key Key of the entry
+ * @return Data of the entry
+ * @protected
+ * @see DBIterator#prev
+ */
+static void* dbit_open_prev(DBIterator* self, DBKey* out_key)
+{
+	DBIterator_impl* it = (DBIterator_impl*)self;
+	DBMap_impl* db = it->db;
+
+	DB_COUNTSTAT(dbit_prev);
+	if (it->ht_index > (int)db->ent_count)
+		it->ht_index = (int)db->ent_count;
+	while (--(it->ht_index) >= 0) {
+		if (!db->ent[it->ht_index].deleted) { // found previous entry
+			if (out_key)
+				memcpy(out_key, &db->ent[it->ht_index].key, sizeof(DBKey));
+			return db->ent[it->ht_index].data;
+		}
+	}
+	it->ht_index = -1;
+	return NULL; // not found
+}
+
+/**
+ * Fetches the first entry of an open addressing hashtable.
+ * @param self Iterator
+ * @param out_key Key of the entry
+ * @return Data of the entry
+ * @protected
+ * @see DBIterator#first
+ */
+static void* dbit_open_first(DBIterator* self, DBKey* out_key)
+{
+	DBIterator_impl* it = (DBIterator_impl*)self;
+
+	DB_COUNTSTAT(dbit_first);
+	it->ht_index = -1; // position before the first entry
+	return dbit_open_next(self, out_key);
+}
+
+/**
+ * Fetches the last entry of an open addressing hashtable.
+ * @param self Iterator
+ * @param out_key Key of the entry
+ * @return Data of the entry
+ * @protected
+ * @see DBIterator#last
+ */
+static void* dbit_open_last(DBIterator* self, DBKey* out_key)
+{
+	DBIterator_impl* it = (DBIterator_impl*)self;
+
+	DB_COUNTSTAT(dbit_last);
+	it->ht_index = (int)it->db->ent_count; // position after the last entry
+	return dbit_open_prev(self, out_key);
+}
+
+/**
+ * Returns true if the fetched entry of an open addressing hashtable exists.
+ * @param self Iterator
+ * @return true is the entry exists
+ * @protected
+ * @see DBIterator#exists
+ */
+static bool dbit_open_exists(DBIterator* self)
+{
+	DBIterator_impl* it = (DBIterator_impl*)self;
+
+	DB_COUNTSTAT(dbit_exists);
+	return (it->ht_index >= 0 && it->ht_index < (int)it->db->ent_count && !it->db->ent[it->ht_index].deleted);
+}
+
+/**
+ * Removes the current entry from an open addressing hashtable.
+ * @param self Iterator
+ * @return The data of the entry or NULL if not found
+ * @protected
+ * @see DBIterator#remove
+ */
+static void* dbit_open_remove(DBIterator* self)
+{
+	DBIterator_impl* it = (DBIterator_impl*)self;
+	DBMap_impl* db = it->db;
+	void* data = NULL;
+
+	DB_COUNTSTAT(dbit_remove);
+	if (dbit_open_exists(self)) {
+		data = db->ent[it->ht_index].data;
+		db->release(db->ent[it->ht_index].key, data, DB_RELEASE_DATA);
+		dbo_free_add(db, (unsigned int)it->ht_index);
+	}
+	return data;
+}
+
+/**
+ * Returns a new iterator for an open addressing hashtable.
+ * The iterator keeps the database locked until it is destroyed.
+ * @param self Database
+ * @return New iterator
+ * @protected
+ * @see DBMap#iterator
+ */
+static DBIterator* dbo_obj_iterator(DBMap* self)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+	DBIterator_impl* it;
+
+	DB_COUNTSTAT(db_iterator);
+	it = ers_alloc(db->iters, DBIterator_impl);
+	/* Interface of the iterator **/
+	it->vtable.first   = dbit_open_first;
+	it->vtable.last    = dbit_open_last;
+	it->vtable.next    = dbit_open_next;
+	it->vtable.prev    = dbit_open_prev;
+	it->vtable.exists  = dbit_open_exists;
+	it->vtable.remove  = dbit_open_remove;
+	it->vtable.destroy = dbit_obj_destroy;
+	/* Initial state (before the first entry) */
+	it->db = db;
+	it->ht_index = -1;
+	it->node = NULL;
+	/* Lock the database */
+	db_free_lock(db);
+	return &it->vtable;
+}
+
+/**
+ * Returns the position of the live entry with the key, or -1 if not found.
+ * Uses and updates the 1-entry cache.
+ * @param db Target database
+ * @param key Key of the entry
+ * @return Position of the entry or -1
+ * @private
+ */
+static int dbo_lookup(DBMap_impl* db, DBKey key)
+{
+	int e;
+
+	if (db->ent_cache >= 0 && db->cmp(key, db->ent[db->ent_cache].key, db->maxlen) == 0)
+		return db->ent_cache; // cache hit
+
+	e = dbo_find(db, key);
+	if (e < 0 || db->ent[e].deleted)
+		return -1;
+	db->ent_cache = e;
+	return e;
+}
+
+/**
+ * Returns true if the entry exists in an open addressing hashtable.
+ * @param self Interface of the database
+ * @param key Key that identifies the entry
+ * @return true is the entry exists
+ * @protected
+ * @see DBMap#exists
+ */
+static bool dbo_obj_exists(DBMap* self, DBKey key)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+
+	DB_COUNTSTAT(db_exists);
+	if (db == NULL) return false; // nullpo candidate
+	return (dbo_lookup(db, key) >= 0);
+}
+
+/**
+ * Get the data of the entry identifid by the key in an open addressing 
+ * hashtable.
+ * @param self Interface of the database
+ * @param key Key that identifies the entry
+ * @return Data of the entry or NULL if not found
+ * @protected
+ * @see DBMap#get
+ */
+static void* dbo_obj_get(DBMap* self, DBKey key)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+	int e;
+
+	DB_COUNTSTAT(db_get);
+	if (db == NULL) return NULL; // nullpo candidate
+	e = dbo_lookup(db, key);
+	return (e < 0 ? NULL : db->ent[e].data);
+}
+
+/**
+ * Get the data of the entries matched by <code>match</code> in an open 
+ * addressing hashtable.
+ * @param self Interface of the database
+ * @param buf Buffer to put the data of the matched entries
+ * @param max Maximum number of data entries to be put into buf
+ * @param match Function that matches the database entries
+ * @param args Extra arguments for match
+ * @return The number of entries that matched
+ * @protected
+ * @see DBMap#vgetall
+ */
+static unsigned int dbo_obj_vgetall(DBMap* self, void **buf, unsigned int max, DBMatcher match, va_list args)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+	unsigned int e;
+	unsigned int ret = 0;
+
+	DB_COUNTSTAT(db_vgetall);
+	if (db == NULL) return 0; // nullpo candidate
+	if (match == NULL) return 0; // nullpo candidate
+
+	db_free_lock(db);
+	for (e = 0; e < db->ent_count; e++) {
+		if (!db->ent[e].deleted) {
+			va_list argscopy;
+			va_copy(argscopy, args);
+			if (match(db->ent[e].key, db->ent[e].data, argscopy) == 0) {
+				if (buf && ret < max)
+					buf[ret] = db->ent[e].data;
+				ret++;
+			}
+			va_end(argscopy);
+		}
+	}
+	db_free_unlock(db);
+	return ret;
+}
+
+/**
+ * Get the data of the entry identified by the key in an open addressing 
+ * hashtable, adding an entry with the data returned by <code>create</code> 
+ * if it doesn't exist.
+ * @param self Interface of the database
+ * @param key Key that identifies the entry
+ * @param create Function used to create the data if the entry doesn't exist
+ * @param args Extra arguments for create
+ * @return Data of the entry
+ * @protected
+ * @see DBMap#vensure
+ */
+static void *dbo_obj_vensure(DBMap* self, DBKey key, DBCreateData create, va_list args)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+	va_list argscopy;
+	void *data;
+	int e;
+
+	DB_COUNTSTAT(db_vensure);
+	if (db == NULL) return NULL; // nullpo candidate
+	if (create == NULL) {
+		ShowError("db_ensure: Create function is NULL for db allocated at %s:%d\n",db->alloc_file, db->alloc_line);
+		return NULL; // nullpo candidate
+	}
+
+	e = dbo_lookup(db, key);
+	if (e >= 0)
+		return db->ent[e].data;
+
+	if (db->item_count == UINT32_MAX) {
+		ShowError("db_vensure: item_count overflow, aborting item insertion.\n"
+				"Database allocated at %s:%d",
+				db->alloc_file, db->alloc_line);
+		return NULL;
+	}
+	db_free_lock(db);
+	e = dbo_find(db, key);
+	if (e >= 0) { // revive the deleted entry
+		db->ent[e].deleted = 0;
+		db->ent_deleted--;
+		db->item_count++;
+	} else
+		e = dbo_insert(db, key, NULL);
+	va_copy(argscopy, args);
+	data = create(key, argscopy);
+	va_end(argscopy);
+	db->ent[e].data = data;
+	db->ent_cache = e;
+	db_free_unlock(db);
+	return data;
+}
+
+/**
+ * Put the data identified by the key in an open addressing hashtable.
+ * Returns the previous data if the entry exists or NULL.
+ * @param self Interface of the database
+ * @param key Key that identifies the data
+ * @param data Data to be put in the database
+ * @return The previous data if the entry exists or NULL
+ * @protected
+ * @see DBMap#put
+ */
+static void *dbo_obj_put(DBMap* self, DBKey key, void *data)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+	void *old_data = NULL;
+	int e;
+
+	DB_COUNTSTAT(db_put);
+	if (db == NULL) return NULL; // nullpo candidate
+	if (db->global_lock) {
+		ShowError("db_put: Database is being destroyed, aborting entry insertion.\n"
+				"Database allocated at %s:%d\n",
+				db->alloc_file, db->alloc_line);
+		return NULL; // nullpo candidate
+	}
+	if (!(data || db->options&DB_OPT_ALLOW_NULL_DATA)) {
+		ShowError("db_put: Attempted to use non-allowed NULL data for db allocated at %s:%d\n",db->alloc_file, db->alloc_line);
+		return NULL; // nullpo candidate
+	}
+	if (db->item_count == UINT32_MAX) {
+		ShowError("db_put: item_count overflow, aborting item insertion.\n"
+				"Database allocated at %s:%d",
+				db->alloc_file, db->alloc_line);
+		return NULL;
+	}
+
+	db_free_lock(db);
+	e = dbo_find(db, key);
+	if (e < 0) {
+		e = dbo_insert(db, key, data);
+	} else {
+		if (db->ent[e].deleted) { // revive the deleted entry
+			db->ent[e].deleted = 0;
+			db->ent_deleted--;
+			db->item_count++;
+		} else { // equal entry, replace
+			old_data = db->ent[e].data;
+			db->release(db->ent[e].key, old_data, DB_RELEASE_BOTH);
+		}
+		db->ent[e].key = key;
+		db->ent[e].data = data;
+	}
+	db->ent_cache = e;
+	db_free_unlock(db);
+	return old_data;
+}
+
+/**
+ * Remove an entry from an open addressing hashtable.
+ * Returns the data of the entry.
+ * @param self Interface of the database
+ * @param key Key that identifies the entry
+ * @return The data of the entry or NULL if not found
+ * @protected
+ * @see DBMap#remove
+ */
+static void *dbo_obj_remove(DBMap* self, DBKey key)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+	void *data = NULL;
+	int e;
+
+	DB_COUNTSTAT(db_remove);
+	if (db == NULL) return NULL; // nullpo candidate
+	if (db->global_lock) {
+		ShowError("db_remove: Database is being destroyed. Aborting entry deletion.\n"
+				"Database allocated at %s:%d\n",
+				db->alloc_file, db->alloc_line);
+		return NULL; // nullpo candidate
+	}
+
+	db_free_lock(db);
+	e = dbo_lookup(db, key);
+	if (e >= 0) {
+		data = db->ent[e].data;
+		db->release(db->ent[e].key, data, DB_RELEASE_DATA);
+		dbo_free_add(db, (unsigned int)e);
+	}
+	db_free_unlock(db);
+	return data;
+}
+
+/**
+ * Apply <code>func</code> to every entry in an open addressing hashtable, 
+ * in insertion order.
+ * Returns the sum of values returned by func.
+ * @param self Interface of the database
+ * @param func Function to be applyed
+ * @param args Extra arguments for func
+ * @return Sum of the values returned by func
+ * @protected
+ * @see DBMap#vforeach
+ */
+static int dbo_obj_vforeach(DBMap* self, DBApply func, va_list args)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+	unsigned int e;
+	int sum = 0;
+
+	DB_COUNTSTAT(db_vforeach);
+	if (db == NULL) return 0; // nullpo candidate
+	if (func == NULL) {
+		ShowError("db_foreach: Passed function is NULL for db allocated at %s:%d\n",db->alloc_file, db->alloc_line);
+		return 0; // nullpo candidate
+	}
+
+	db_free_lock(db);
+	for (e = 0; e < db->ent_count; e++) {
+		if (!db->ent[e].deleted) {
+			va_list argscopy;
+			va_copy(argscopy, args);
+			sum += func(db->ent[e].key, db->ent[e].data, argscopy);
+			va_end(argscopy);
+		}
+	}
+	db_free_unlock(db);
+	return sum;
+}
+
+/**
+ * Removes all entries from an open addressing hashtable.
+ * Before deleting an entry, func is applyed to it.
+ * Releases the key and the data.
+ * Returns the sum of values returned by func, if it exists.
+ * @param self Interface of the database
+ * @param func Function to be applyed to every entry before deleting
+ * @param args Extra arguments for func
+ * @return Sum of values returned by func
+ * @protected
+ * @see DBMap#vclear
+ */
+static int dbo_obj_vclear(DBMap* self, DBApply func, va_list args)
+{
+	DBMap_impl* db = (DBMap_impl*)self;
+	unsigned int e;
+	int sum = 0;
+
+	DB_COUNTSTAT(db_vclear);
+	if (db == NULL) return 0; // nullpo candidate
+
+	db_free_lock(db);
+	db->ent_cache = -1;
+	for (e = 0; e < db->ent_count; e++) {
+		if (db->ent[e].deleted)
+			continue;
+		if (func) {
+			va_list argscopy;
+			va_copy(argscopy, args);
+			sum += func(db->ent[e].key, db->ent[e].data, argscopy);
+			va_end(argscopy);
+		}
+		db->release(db->ent[e].key, db->ent[e].data, DB_RELEASE_BOTH);
+		db->ent[e].deleted = 1;
+	}
+	db->ent_count = 0;
+	db->ent_deleted = 0;
+	db->item_count = 0;
+	if (db->idx)
+		memset(db->idx, 0, sizeof(db->idx[0])<<db->idx_bits);
+	db_free_unlock(db);
+	return sum;
+}
+
 /*****************************************************************************\
  *  (5) Section with public functions.
  *  db_fix_options     - Apply database type restrictions to the options.
@@ -2236,6 +2933,7 @@ static DBOptions db_obj_options(DBMap* self)
  * Returns the fixed options according to the database type.
  * Sets required options and unsets unsupported options.
  * For numeric databases DB_OPT_DUP_KEY and DB_OPT_RELEASE_KEY are unset.
+ * For string databases DB_OPT_OPEN_HASH is unset.
  * @param type Type of the database
  * @param options Original options of the database
  * @return Fixed options of the database
@@ -2254,8 +2952,8 @@ DBOptions db_fix_options(DBType type, DBOptions options)
 		default:
 			ShowError("db_fix_options: Unknown database type %u with options %x\n", type, options);
 		case DB_STRING:
-		case DB_ISTRING: // String databases, no fix required
-			return options;
+		case DB_ISTRING: // String databases, no open addressing
+			return (DBOptions)(options&~DB_OPT_OPEN_HASH);
 	}
 }
 
@@ -2434,6 +3132,26 @@ DBMap* db_alloc(const char *file, int line, DBType type, DBOptions options, unsi
 	db->item_count = 0;
 	db->maxlen = maxlen;
 	db->global_lock = 0;
+	db->ent = NULL;
+	db->ent_count = 0;
+	db->ent_max = 0;
+	db->ent_deleted = 0;
+	db->ent_cache = -1;
+	db->idx = NULL;
+	db->idx_bits = 0;
+
+	if (options&DB_OPT_OPEN_HASH) {
+		/* Interface of the open addressing hashtable */
+		db->vtable.iterator = dbo_obj_iterator;
+		db->vtable.exists   = dbo_obj_exists;
+		db->vtable.get      = dbo_obj_get;
+		db->vtable.vgetall  = dbo_obj_vgetall;
+		db->vtable.vensure  = dbo_obj_vensure;
+		db->vtable.put      = dbo_obj_put;
+		db->vtable.remove   = dbo_obj_remove;
+		db->vtable.vforeach = dbo_obj_vforeach;
+		db->vtable.vclear   = dbo_obj_vclear;
+	}
 
 	if( db->maxlen == 0 && (type == DB_STRING || type == DB_ISTRING) )
 		db->maxlen = UINT16_MAX;
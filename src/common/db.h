@@ -113,6 +113,9 @@ typedef enum DBType {
  * @param DB_OPT_RELEASE_BOTH Releases both key and data.
  * @param DB_OPT_ALLOW_NULL_KEY Allow NULL keys in the database.
  * @param DB_OPT_ALLOW_NULL_DATA Allow NULL data in the database.
+ * @param DB_OPT_OPEN_HASH Uses a growable open addressing hashtable instead 
+ *          of the hashtable of RED-BLACK trees. Only for numeric databases.
+ *          Entries are iterated in insertion order.
  * @public
  * @see #db_fix_options(DBType,DBOptions)
  * @see #db_default_release(DBType,DBOptions)
@@ -126,6 +129,7 @@ typedef enum DBOptions {
 	DB_OPT_RELEASE_BOTH    = 6,
 	DB_OPT_ALLOW_NULL_KEY  = 8,
 	DB_OPT_ALLOW_NULL_DATA = 16,
+	DB_OPT_OPEN_HASH       = 32,
 } DBOptions;
 
 /**
@@ -623,6 +627,7 @@ struct DBMap {
  * Returns the fixed options according to the database type.
  * Sets required options and unsets unsupported options.
  * For numeric databases DB_OPT_DUP_KEY and DB_OPT_RELEASE_KEY are unset.
+ * For string databases DB_OPT_OPEN_HASH is unset.
  * @param type Type of the database
  * @param options Original options of the database
  * @return Fixed options of the database
@@ -28,17 +28,24 @@
  *    destroyed so memory will usually only be recovered near the end.       *
  *  - Always wastes space for entries smaller than a pointer.                *
  *                                                                           *
- *  WARNING: The system is not thread-safe at the moment.                    *
+ *  WARNING: Regular managers are not thread-safe. Entries that are          *
+ *  allocated or freed from several threads must use a manager obtained with *
+ *  ers_new_ts, which caches entries per thread.                             *
  *                                                                           *
  *  HISTORY:                                                                 *
  *    0.1 - Initial version                                                  *
+ *    0.2 - Thread-safe managers and allocation statistics                   *
  *                                                                           *
- * @version 0.1 - Initial version                                            *
+ * @version 0.2 - Thread-safe managers and allocation statistics             *
  * @author Flavio @ Amazon Project                                           *
  * @encoding US-ASCII                                                        *
  * @see common#ers.h                                                         *
 \*****************************************************************************/
 #include <stdlib.h>
+#include <string.h>
+#if defined(_MSC_VER)
+#include <windows.h> // InterlockedExchange, InterlockedCompareExchangePointer
+#endif
 
 #include "../common/cbasetypes.h"
 #include "../common/malloc.h" // CREATE, RECREATE, aMalloc, aFree
@@ -50,10 +57,16 @@
  *  (1) Private defines, structures and global variables.                    *
  *  ERS_BLOCK_ENTRIES - Number of entries in each block.                     *
  *  ERS_ROOT_SIZE     - Maximum number of root entry managers.               *
+ *  ERS_TS_SIZE       - Maximum number of thread-safe entry managers.        *
+ *  ERS_MAGAZINE_SIZE - Number of entries in a batch of a thread magazine.   *
  *  ERLinkedList      - Structure of a linked list of reusable entries.      *
+ *  ERBatch           - Structure of a batch of reusable entries.            *
  *  ERS_impl          - Class of an entry manager.                           *
+ *  ERMagazine        - Entries cached by a thread for a thread-safe manager.*
  *  ers_root          - Array of root entry managers.                        *
  *  ers_num           - Number of root entry managers in the array.          *
+ *  ers_ts_root       - Array of thread-safe entry managers.                 *
+ *  ers_magazines     - Magazines of the current thread.                     *
 \*****************************************************************************/
 
 /**
@@ -70,6 +83,49 @@
  */
 #define ERS_ROOT_SIZE 256
 
+/**
+ * Maximum number of thread-safe entry managers.
+ * @private
+ * @see #ers_ts_root
+ * @see #ers_magazines
+ */
+#define ERS_TS_SIZE 32
+
+/**
+ * Number of entries that move between a thread magazine and the depot at once.
+ * A magazine holds up to twice this amount before giving a batch back.
+ * @private
+ * @see #ERMagazine
+ */
+#define ERS_MAGAZINE_SIZE 64
+
+/**
+ * Atomic operations used by the thread-safe managers.
+ * ERS_TLS                   - Storage class of thread-local variables.
+ * ERS_CAS_PTR(p,o,n)        - Sets *p to n if it is o, returns true on success.
+ * ERS_XCHG_PTR(p,n)         - Sets *p to n, returns the previous value.
+ * ERS_ADD64(p,n)            - Adds n to the 64-bit integer *p.
+ * ERS_TRYLOCK(p)/ERS_UNLOCK - Spinlock on a long.
+ * @private
+ */
+#if defined(_MSC_VER)
+#	define ERS_TLS __declspec(thread)
+#	define ERS_CAS_PTR(p,o,n) (InterlockedCompareExchangePointer((PVOID volatile*)(p),(PVOID)(n),(PVOID)(o)) == (PVOID)(o))
+#	define ERS_XCHG_PTR(p,n)  InterlockedExchangePointer((PVOID volatile*)(p),(PVOID)(n))
+#	define ERS_ADD64(p,n)     InterlockedExchangeAdd64((LONGLONG volatile*)(p),(LONGLONG)(n))
+#	define ERS_TRYLOCK(p)     (InterlockedExchange((p),1) == 0)
+#	define ERS_UNLOCK(p)      InterlockedExchange((p),0)
+#elif defined(__GNUC__)
+#	define ERS_TLS __thread
+#	define ERS_CAS_PTR(p,o,n) __sync_bool_compare_and_swap((p),(o),(n))
+#	define ERS_XCHG_PTR(p,n)  __sync_lock_test_and_set((p),(n))
+#	define ERS_ADD64(p,n)     __sync_fetch_and_add((p),(uint64)(n))
+#	define ERS_TRYLOCK(p)     (__sync_lock_test_and_set((p),1) == 0)
+#	define ERS_UNLOCK(p)      __sync_lock_release(p)
+#else
+#	define ERS_NO_THREADSAFE
+#endif
+
 /**
  * Linked list of reusable entries.
  * The minimum size of the entries is the size of this structure.
@@ -80,6 +136,19 @@ typedef struct ers_ll {
 	struct ers_ll *next;
 } *ERLinkedList;
 
+/**
+ * Batch of ERS_MAGAZINE_SIZE reusable entries in the depot of a thread-safe 
+ * manager.
+ * The first entry of the batch is used as header, so the minimum size of the 
+ * entries of thread-safe managers is the size of this structure.
+ * @private
+ * @see ERS_impl#depot
+ */
+typedef struct ers_batch {
+	struct ers_ll entry; // first entry, links to the rest of the batch
+	struct ers_batch *next; // next batch in the depot
+} *ERBatch;
+
 /**
  * Class of the object that manages entries of a certain size.
  * @param eri Public interface of the object
@@ -90,6 +159,14 @@ typedef struct ers_ll {
  * @param max Current maximum capacity of the array
  * @param destroy Destroy lock
  * @param size Size of the entries of the manager
+ * @param allocs Number of allocated entries
+ * @param frees Number of freed entries
+ * @param reuses Number of allocations served by a freed entry
+ * @param ts Slot in ers_ts_root, -1 if not thread-safe
+ * @param serial Serial number of the thread-safe manager
+ * @param depot Batches of reusable entries shared by the threads
+ * @param lock Lock of the blocks of a thread-safe manager
+ * @param poplock Lock serializing the pops from the depot
  * @private
  */
 typedef struct ers_impl {
@@ -139,8 +216,66 @@ typedef struct ers_impl {
 	 */
 	size_t size;
 
+	/**
+	 * Allocation statistics.
+	 * Thread-safe managers receive them from the thread magazines in bulk.
+	 */
+	uint64 allocs;
+	uint64 frees;
+	uint64 reuses;
+
+	/**
+	 * Slot in ers_ts_root, -1 if the manager is not thread-safe.
+	 * The fields below are only used by thread-safe managers.
+	 */
+	int ts;
+
+	/**
+	 * Serial number of the manager.
+	 * Lets the threads recognize magazines of a previous manager in the slot.
+	 */
+	uint32 serial;
+
+	/**
+	 * Stack of batches of reusable entries, pushed without locking.
+	 */
+	struct ers_batch *volatile depot;
+
+	/**
+	 * Lock of the blocks of entries.
+	 */
+	volatile long lock;
+
+	/**
+	 * Lock serializing the pops from the depot.
+	 */
+	volatile long poplock;
+
 } *ERS_impl;
 
+/**
+ * Entries cached by a thread for a thread-safe manager.
+ * The freed entries are on top of the never used ones, so the bottom 
+ * 'fresh' entries of the list were never allocated.
+ * @param serial Serial number of the manager, 0 if unused
+ * @param head Linked list of cached entries
+ * @param count Number of cached entries
+ * @param fresh Number of never used entries in the list
+ * @param allocs Allocations not yet added to the manager
+ * @param frees Frees not yet added to the manager
+ * @param reuses Reuses not yet added to the manager
+ * @private
+ */
+typedef struct ers_magazine {
+	uint32 serial;
+	ERLinkedList head;
+	uint32 count;
+	uint32 fresh;
+	uint32 allocs;
+	uint32 frees;
+	uint32 reuses;
+} *ERMagazine;
+
 /**
  * Root array with entry managers.
  * @private
@@ -159,12 +294,39 @@ static ERS_impl ers_root[ERS_ROOT_SIZE];
  */
 static uint32 ers_num = 0;
 
+/**
+ * Array with the thread-safe entry managers, indexed by their slot.
+ * @private
+ * @static
+ * @see #ERS_TS_SIZE
+ */
+static ERS_impl ers_ts_root[ERS_TS_SIZE];
+
+/**
+ * Last serial number given to a thread-safe manager.
+ * @private
+ * @static
+ */
+static uint32 ers_ts_serial = 0;
+
+#ifndef ERS_NO_THREADSAFE
+/**
+ * Magazines of the current thread, indexed by the slot of the manager.
+ * @private
+ * @static
+ * @see #ers_ts_root
+ */
+static ERS_TLS struct ers_magazine ers_magazines[ERS_TS_SIZE];
+#endif /* not ERS_NO_THREADSAFE */
+
 /*****************************************************************************\
  *  (2) Object functions.                                                 *
  *  ers_obj_alloc_entry - Allocate an entry from the manager.                *
  *  ers_obj_free_entry  - Free an entry allocated from the manager.          *
  *  ers_obj_entry_size  - Return the size of the entries of the manager.     *
  *  ers_obj_destroy     - Destroy the instance of the manager.               *
+ *  ers_ts_alloc_entry  - Allocate an entry from a thread-safe manager.      *
+ *  ers_ts_free_entry   - Free an entry allocated from a thread-safe manager.*
 \*****************************************************************************/
 
 /**
@@ -186,9 +348,11 @@ static void *ers_obj_alloc_entry(ERS self)
 		return NULL;
 	}
 
+	obj->allocs++;
 	if (obj->reuse) { // Reusable entry
 		ret = obj->reuse;
 		obj->reuse = obj->reuse->next;
+		obj->reuses++;
 	} else if (obj->free) { // Unused entry
 		obj->free--;
 		ret = &obj->blocks[obj->num -1][obj->free*obj->size];
@@ -236,8 +400,215 @@ static void ers_obj_free_entry(ERS self, void *entry)
 	reuse = (ERLinkedList)entry;
 	reuse->next = obj->reuse;
 	obj->reuse = reuse;
+	obj->frees++;
+}
+
+#ifndef ERS_NO_THREADSAFE
+/**
+ * Return the magazine of the current thread for a thread-safe manager.
+ * A magazine left over from a destroyed manager in the same slot is emptied, 
+ * its entries were released with that manager.
+ * @param obj Thread-safe entry manager
+ * @return Magazine of the current thread
+ * @see #ers_magazines
+ */
+static ERMagazine ers_ts_magazine(ERS_impl obj)
+{
+	ERMagazine mag = &ers_magazines[obj->ts];
+
+	if (mag->serial != obj->serial) {
+		memset(mag, 0, sizeof(struct ers_magazine));
+		mag->serial = obj->serial;
+	}
+	return mag;
+}
+
+/**
+ * Add the statistics of a magazine to its manager.
+ * @param obj Thread-safe entry manager
+ * @param mag Magazine of the current thread
+ */
+static void ers_ts_flush(ERS_impl obj, ERMagazine mag)
+{
+	ERS_ADD64(&obj->allocs, mag->allocs);
+	ERS_ADD64(&obj->frees, mag->frees);
+	ERS_ADD64(&obj->reuses, mag->reuses);
+	mag->allocs = 0;
+	mag->frees = 0;
+	mag->reuses = 0;
+}
+
+/**
+ * Push a batch of reusable entries to the depot.
+ * @param obj Thread-safe entry manager
+ * @param batch Batch of ERS_MAGAZINE_SIZE entries
+ * @see ERS_impl#depot
+ */
+static void ers_ts_depot_push(ERS_impl obj, ERBatch batch)
+{
+	ERBatch head;
+
+	do {
+		head = obj->depot;
+		batch->next = head;
+	} while (!ERS_CAS_PTR(&obj->depot, head, batch));
+}
+
+/**
+ * Pop a batch of reusable entries from the depot.
+ * Pushes are lock-free, but pops are serialized by a short spinlock. With a 
+ * single popper the head can't be popped and pushed back while it is being 
+ * replaced, which rules out the ABA problem of a lock-free stack.
+ * @param obj Thread-safe entry manager
+ * @return Batch of ERS_MAGAZINE_SIZE entries or NULL if the depot is empty
+ * @see ERS_impl#depot
+ */
+static ERBatch ers_ts_depot_pop(ERS_impl obj)
+{
+	ERBatch batch;
+
+	if (obj->depot == NULL)
+		return NULL;
+	while (!ERS_TRYLOCK(&obj->poplock))
+		;
+	do {
+		batch = obj->depot;
+	} while (batch && !ERS_CAS_PTR(&obj->depot, batch, batch->next));
+	ERS_UNLOCK(&obj->poplock);
+	return batch;
+}
+
+/**
+ * Take ERS_MAGAZINE_SIZE unused entries from the blocks of the manager.
+ * The blocks are allocated with the system allocator, the memory manager is 
+ * not thread-safe.
+ * @param obj Thread-safe entry manager
+ * @param mag Empty magazine of the current thread
+ * @see #ERS_BLOCK_ENTRIES
+ */
+static void ers_ts_carve(ERS_impl obj, ERMagazine mag)
+{
+	ERLinkedList entry;
+	uint32 i;
+
+	while (!ERS_TRYLOCK(&obj->lock))
+		; // only contended once every ERS_BLOCK_ENTRIES entries
+	for (i = 0; i < ERS_MAGAZINE_SIZE; i++) {
+		if (obj->free == 0) { // allocate a new block
+			if (obj->num == obj->max) { // expand the block array
+				if (obj->max == UINT32_MAX) { // No more space for blocks
+					ShowFatalError("ers::alloc : maximum number of blocks reached, increase ERS_BLOCK_ENTRIES.\n"
+							"exiting the program...\n");
+					exit(EXIT_FAILURE);
+				}
+				obj->max = (obj->max*4)+3; // left shift bits '11' - overflow won't happen
+				obj->blocks = (uint8 **)realloc(obj->blocks, obj->max*sizeof(uint8 *));
+			}
+			if (obj->blocks == NULL || (obj->blocks[obj->num] = (uint8 *)malloc(obj->size*ERS_BLOCK_ENTRIES)) == NULL) {
+				ShowFatalError("ers::alloc : out of memory.\n"
+						"exiting the program...\n");
+				exit(EXIT_FAILURE);
+			}
+			obj->free = ERS_BLOCK_ENTRIES;
+			obj->num++;
+		}
+		obj->free--;
+		entry = (ERLinkedList)&obj->blocks[obj->num -1][obj->free*obj->size];
+		entry->next = mag->head;
+		mag->head = entry;
+	}
+	ERS_UNLOCK(&obj->lock);
+	mag->count += ERS_MAGAZINE_SIZE;
+	mag->fresh += ERS_MAGAZINE_SIZE;
 }
 
+/**
+ * Allocate an entry from a thread-safe entry manager.
+ * The entry comes from the magazine of the current thread, which is refilled 
+ * from the depot or the blocks when empty.
+ * @param self Interface of the entry manager
+ * @return An entry
+ * @see #ERMagazine
+ * @see ERS_impl::vtable#alloc
+ */
+static void *ers_ts_alloc_entry(ERS self)
+{
+	ERS_impl obj = (ERS_impl)self;
+	ERMagazine mag;
+	ERLinkedList ret;
+
+	if (obj == NULL) {
+		ShowError("ers::alloc : NULL object, aborting entry allocation.\n");
+		return NULL;
+	}
+
+	mag = ers_ts_magazine(obj);
+	if (mag->count == 0) { // refill
+		ERBatch batch = ers_ts_depot_pop(obj);
+		if (batch) {
+			mag->head = &batch->entry;
+			mag->count = ERS_MAGAZINE_SIZE;
+		} else
+			ers_ts_carve(obj, mag);
+	}
+	ret = mag->head;
+	if (mag->count > mag->fresh)
+		mag->reuses++;
+	else
+		mag->fresh--;
+	mag->head = ret->next;
+	mag->count--;
+	if (++mag->allocs == ERS_MAGAZINE_SIZE)
+		ers_ts_flush(obj, mag);
+	return ret;
+}
+
+/**
+ * Free an entry allocated from a thread-safe manager.
+ * The entry goes to the magazine of the current thread, a full magazine 
+ * gives a batch of entries to the depot.
+ * WARNING: Does not check if the entry was allocated by this manager.
+ * Freeing such an entry can lead to unexpected behaviour.
+ * @param self Interface of the entry manager
+ * @param entry Entry to be freed
+ * @see #ERMagazine
+ * @see ERS_impl::vtable#free
+ */
+static void ers_ts_free_entry(ERS self, void *entry)
+{
+	ERS_impl obj = (ERS_impl)self;
+	ERMagazine mag;
+	ERLinkedList reuse;
+
+	if (obj == NULL) {
+		ShowError("ers::free : NULL object, aborting entry freeing.\n");
+		return;
+	} else if (entry == NULL) {
+		ShowError("ers::free : NULL entry, nothing to free.\n");
+		return;
+	}
+
+	mag = ers_ts_magazine(obj);
+	reuse = (ERLinkedList)entry;
+	reuse->next = mag->head;
+	mag->head = reuse;
+	mag->count++;
+	if (mag->count == 2*ERS_MAGAZINE_SIZE) { // give the freed entries on top to the depot
+		ERBatch batch = (ERBatch)mag->head;
+		uint32 i;
+
+		for (i = 1; i < ERS_MAGAZINE_SIZE; i++)
+			reuse = reuse->next;
+		mag->head = reuse->next;
+		reuse->next = NULL;
+		mag->count -= ERS_MAGAZINE_SIZE;
+		ers_ts_depot_push(obj, batch);
+	}
+	if (++mag->frees == ERS_MAGAZINE_SIZE)
+		ers_ts_flush(obj, mag);
+}
+#endif /* not ERS_NO_THREADSAFE */
+
 /**
  * Return the size of the entries allocated from this manager.
  * @param self Interface of the entry manager
@@ -257,6 +628,28 @@ static size_t ers_obj_entry_size(ERS self)
 	return obj->size;
 }
 
+/**
+ * Release the blocks of entries of a manager.
+ * @param obj Entry manager
+ */
+static void ers_free_blocks(ERS_impl obj)
+{
+	uint32 i;
+
+	if (obj->max == 0)
+		return;
+	for (i = 0; i < obj->num; i++) { // release block of entries
+		if (obj->ts < 0)
+			aFree(obj->blocks[i]);
+		else
+			free(obj->blocks[i]);
+	}
+	if (obj->ts < 0) // release array of blocks
+		aFree(obj->blocks);
+	else
+		free(obj->blocks);
+}
+
 /**
  * Destroy this instance of the manager.
  * The manager is actually only destroyed when all the instances are destroyed.
@@ -291,6 +684,12 @@ static void ers_obj_destroy(ERS self)
 			break;
 		}
 	}
+	if (obj->ts >= 0) { // other threads may still cache entries, nothing to check
+		ers_ts_root[obj->ts] = NULL;
+		ers_free_blocks(obj);
+		aFree(obj);
+		return;
+	}
 	reuse = obj->reuse;
 	count = 0;
 	// Check for missing/extra entries
@@ -322,38 +721,32 @@ static void ers_obj_destroy(ERS self)
 				count, obj->size);
 	}
 	// destroy the entry manager
-	if (obj->max) {
-		for (i = 0; i < obj->num; i++)
-			aFree(obj->blocks[i]); // release block of entries
-		aFree(obj->blocks); // release array of blocks
-	}
+	ers_free_blocks(obj);
 	aFree(obj); // release manager
 }
 
 /*****************************************************************************\
  *  (3) Public functions.                                                    *
  *  ers_new               - Get a new instance of an entry manager.          *
+ *  ers_new_ts            - Get a new instance of a thread-safe manager.     *
  *  ers_report            - Print a report about the current state.          *
  *  ers_force_destroy_all - Force the destruction of all the managers.       *
 \*****************************************************************************/
 
 /**
  * Get a new instance of the manager that handles the specified entry size.
- * Size has to greater than 0.
- * If the specified size is smaller than a pointer, the size of a pointer is 
- * used instead.
- * It's also aligned to ERS_ALIGNED bytes, so the smallest multiple of 
- * ERS_ALIGNED that is greater or equal to size is what's actually used.
- * @param The requested size of the entry in bytes
+ * Regular and thread-safe managers are looked up separately.
+ * @param size The requested size of the entry in bytes
+ * @param ts Whether the manager has to be thread-safe
  * @return Interface of the object
- * @see #ERS_impl
- * @see #ers_root
- * @see #ers_num
+ * @see #ers_new
+ * @see #ers_new_ts
  */
-ERS ers_new(uint32 size)
+static ERS ers_new_sub(uint32 size, bool ts)
 {
 	ERS_impl obj;
 	uint32 i;
+	int slot = -1;
 
 	if (size == 0) {
 		ShowError("ers_new: invalid size %u, aborting instance creation.\n",
@@ -363,12 +756,14 @@ ERS ers_new(uint32 size)
 
 	if (size < sizeof(struct ers_ll)) // Minimum size
 		size = sizeof(struct ers_ll);
+	if (ts && size < sizeof(struct ers_batch)) // Minimum size of thread-safe entries
+		size = sizeof(struct ers_batch);
 	if (size%ERS_ALIGNED) // Align size
 		size += ERS_ALIGNED -size%ERS_ALIGNED;
 
 	for (i = 0; i < ers_num; i++) {
 		obj = ers_root[i];
-		if (obj->size == size) {
+		if (obj->size == size && (obj->ts >= 0) == ts) {
 			// found a manager that handles the entry size
 			obj->destroy++;
 			return &obj->vtable;
@@ -380,6 +775,15 @@ ERS ers_new(uint32 size)
 				"exiting the program...\n");
 		exit(EXIT_FAILURE);
 	}
+	if (ts) {
+		for (slot = 0; slot < ERS_TS_SIZE && ers_ts_root[slot]; slot++)
+			;
+		if (slot == ERS_TS_SIZE) {
+			ShowFatalError("ers_alloc: too many thread-safe objects, increase ERS_TS_SIZE.\n"
+					"exiting the program...\n");
+			exit(EXIT_FAILURE);
+		}
+	}
 	obj = (ERS_impl)aMalloc(sizeof(struct ers_impl));
 	// Public interface
 	obj->vtable.alloc      = ers_obj_alloc_entry;
@@ -395,10 +799,67 @@ ERS ers_new(uint32 size)
 	obj->destroy = 1;
 	// Properties
 	obj->size = size;
+	// Statistics
+	obj->allocs = 0;
+	obj->frees  = 0;
+	obj->reuses = 0;
+	// Thread-safe managers
+	obj->ts     = slot;
+	obj->serial = 0;
+	obj->depot  = NULL;
+	obj->lock   = 0;
+	obj->poplock = 0;
+#ifndef ERS_NO_THREADSAFE
+	if (ts) {
+		obj->vtable.alloc = ers_ts_alloc_entry;
+		obj->vtable.free  = ers_ts_free_entry;
+		if (++ers_ts_serial == 0) // 0 marks unused magazines
+			++ers_ts_serial;
+		obj->serial = ers_ts_serial;
+		ers_ts_root[slot] = obj;
+	}
+#endif /* not ERS_NO_THREADSAFE */
 	ers_root[ers_num++] = obj;
 	return &obj->vtable;
 }
 
+/**
+ * Get a new instance of the manager that handles the specified entry size.
+ * Size has to greater than 0.
+ * If the specified size is smaller than a pointer, the size of a pointer is 
+ * used instead.
+ * It's also aligned to ERS_ALIGNED bytes, so the smallest multiple of 
+ * ERS_ALIGNED that is greater or equal to size is what's actually used.
+ * @param The requested size of the entry in bytes
+ * @return Interface of the object
+ * @see #ERS_impl
+ * @see #ers_root
+ * @see #ers_num
+ */
+ERS ers_new(uint32 size)
+{
+	return ers_new_sub(size, false);
+}
+
+/**
+ * Get a new instance of a thread-safe manager that handles the specified 
+ * entry size.
+ * Entries are at least the size of an ERBatch.
+ * Falls back to a regular manager when there are no atomic operations.
+ * @param The requested size of the entry in bytes
+ * @return Interface of the object
+ * @see #ERMagazine
+ * @see #ers_ts_root
+ */
+ERS ers_new_ts(uint32 size)
+{
+#ifdef ERS_NO_THREADSAFE
+	return ers_new_sub(size, false);
+#else
+	return ers_new_sub(size, true);
+#endif
+}
+
 /**
  * Print a report about the current state of the Entry Reusage System.
  * Shows information about the global system and each entry manager.
@@ -465,9 +926,18 @@ void ers_report(void)
 		ShowMessage("\tentry size         : %u\n", obj->size);
 		ShowMessage("\tblock array size   : %u\n", obj->max);
 		ShowMessage("\tallocated blocks   : %u\n", obj->num);
-		ShowMessage("\tentries being used : %u\n", used);
-		ShowMessage("\tunused entries     : %u\n", obj->free);
-		ShowMessage("\treusable entries   : %u\n", reusable);
+		if (obj->ts >= 0) { // reusable entries are cached by the threads
+			ShowMessage("\tthread-safe        : yes\n");
+			ShowMessage("\tentries being used : %"PRId64"\n", (int64)(obj->allocs - obj->frees));
+			ShowMessage("\tunused entries     : %u\n", obj->free);
+		} else {
+			ShowMessage("\tentries being used : %u\n", used);
+			ShowMessage("\tunused entries     : %u\n", obj->free);
+			ShowMessage("\treusable entries   : %u\n", reusable);
+		}
+		ShowMessage("\tallocations        : %"PRIu64"\n", obj->allocs);
+		ShowMessage("\tfrees              : %"PRIu64"\n", obj->frees);
+		ShowMessage("\treused entries     : %"PRIu64"\n", obj->reuses);
 		if (extra)
 			ShowMessage("\tWARNING - %u extra reusable entries were found.\n", extra);
 	}
@@ -488,18 +958,14 @@ void ers_report(void)
 void ers_force_destroy_all(void)
 {
 	uint32 i;
-	uint32 j;
 	ERS_impl obj;
 
 	for (i = 0; i < ers_num; i++) {
 		obj = ers_root[i];
-		if (obj->max) {
-			for (j = 0; j < obj->num; j++)
-				aFree(obj->blocks[j]); // block of entries
-			aFree(obj->blocks); // array of blocks
-		}
+		ers_free_blocks(obj); // blocks of entries
 		aFree(obj); // entry manager object
 	}
 	ers_num = 0;
+	memset(ers_ts_root, 0, sizeof(ers_ts_root));
 }
 #endif /* not DISABLE_ERS */
@@ -28,12 +28,15 @@
  *    destroyed so memory will usually only be recovered near the end.       *
  *  - Always wastes space for entries smaller than a pointer.                *
  *                                                                           *
- *  WARNING: The system is not thread-safe at the moment.                    *
+ *  WARNING: Regular managers are not thread-safe. Entries that are          *
+ *  allocated or freed from several threads must use a manager obtained with *
+ *  ers_new_ts, which caches entries per thread.                             *
  *                                                                           *
  *  HISTORY:                                                                 *
  *    0.1 - Initial version                                                  *
+ *    0.2 - Thread-safe managers and allocation statistics                   *
  *                                                                           *
- * @version 0.1 - Initial version                                            *
+ * @version 0.2 - Thread-safe managers and allocation statistics             *
  * @author Flavio @ Amazon Project                                           *
  * @encoding US-ASCII                                                        *
 \*****************************************************************************/
@@ -48,6 +51,7 @@
  *  ERS_ALIGNED           - Alignment of the entries in the blocks.          *
  *  ERS                   - Entry manager.                                   *
  *  ers_new               - Allocate an instance of an entry manager.        *
+ *  ers_new_ts            - Allocate an instance of a thread-safe manager.   *
  *  ers_report            - Print a report about the current state.          *
  *  ers_force_destroy_all - Force the destruction of all the managers.       *
 \*****************************************************************************/
@@ -122,6 +126,7 @@ typedef struct eri {
 #	define ers_destroy(obj)
 // Disable the public functions
 #	define ers_new(size) NULL
+#	define ers_new_ts(size) NULL
 #	define ers_report()
 #	define ers_force_destroy_all()
 #else /* not DISABLE_ERS */
@@ -144,12 +149,29 @@ typedef struct eri {
  */
 ERS ers_new(uint32 size);
 
+/**
+ * Get a new instance of a thread-safe manager that handles the specified 
+ * entry size.
+ * Entries of these managers can be allocated and freed from any thread.
+ * Each thread keeps a small magazine of entries and exchanges full batches 
+ * with a depot shared by all threads.
+ * Thread-safe managers never share entries with the managers of ers_new.
+ * The manager itself must be created and destroyed while no other thread is 
+ * using it.
+ * Falls back to a regular manager on compilers without atomic operations.
+ * @param The requested size of the entry in bytes
+ * @return Interface of the object
+ */
+ERS ers_new_ts(uint32 size);
+
 /**
  * Print a report about the current state of the Entry Reusage System.
  * Shows information about the global system and each entry manager.
  * The number of entries are checked and a warning is shown if extra reusable 
  * entries are found.
  * The extra entries are included in the count of reusable entries.
+ * The allocation statistics of thread-safe managers only include what the 
+ * threads have already flushed from their magazines.
  */
 void ers_report(void);
 
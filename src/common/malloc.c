@@ -243,6 +243,81 @@ static inline void memmgr_usage_decrease(size_t delta)
 	memmgr_usage_bytes-= delta;
 }
 
+/* allocation statistics, by size class and by call site */
+#define MEMMGR_CLASS_LARGE (BLOCK_DATA_COUNT1 + BLOCK_DATA_COUNT2 + 1)
+#define MEMMGR_SITES 2048
+#define MEMMGR_SITE_PROBES 32
+
+struct memmgr_stat
+{
+	size_t count;  // live allocations
+	size_t bytes;  // live bytes
+	size_t peak;   // highest amount of live allocations
+	size_t total;  // allocations since startup
+};
+
+struct memmgr_site
+{
+	const char*        file;
+	unsigned short     line;
+	struct memmgr_stat stat;
+};
+
+static struct memmgr_stat memmgr_class_stat[MEMMGR_CLASS_LARGE + 1];  // indexed by hash, large units in the last one
+static struct memmgr_site memmgr_sites[MEMMGR_SITES];  // open addressing by file and line
+static struct memmgr_site memmgr_site_other;           // sites that didn't fit in the table
+
+static struct memmgr_stat* memmgr_site_stat(const char* file, unsigned short line)
+{
+	unsigned int i = (unsigned int)(((uintptr_t)file>>3) ^ (line*2654435761U))&(MEMMGR_SITES-1);
+	int n;
+
+	for( n = 0; n < MEMMGR_SITE_PROBES; ++n, i = (i+1)&(MEMMGR_SITES-1) )
+	{
+		struct memmgr_site* site = &memmgr_sites[i];
+
+		if( site->file == file && site->line == line )
+			return &site->stat;
+		if( site->file == NULL )
+		{
+			site->file = file;
+			site->line = line;
+			return &site->stat;
+		}
+	}
+	return &memmgr_site_other.stat;
+}
+
+static inline void memmgr_stat_add(struct memmgr_stat* stat, size_t size)
+{
+	stat->count++;
+	stat->bytes+= size;
+	stat->total++;
+	if( stat->peak < stat->count )
+		stat->peak = stat->count;
+}
+
+static inline void memmgr_stat_sub(struct memmgr_stat* stat, size_t size)
+{
+	memmgr_assert( stat->count > 0 && stat->bytes >= size );
+
+	stat->count--;
+	stat->bytes-= size;
+}
+
+/// Accounts an allocation of a unit of size class 'hash' (MEMMGR_CLASS_LARGE for large units).
+static void memmgr_stat_alloc(unsigned short hash, size_t size, const char* file, unsigned short line)
+{
+	memmgr_stat_add(&memmgr_class_stat[hash], size);
+	memmgr_stat_add(memmgr_site_stat(file, line), size);
+}
+
+static void memmgr_stat_free(unsigned short hash, size_t size, const char* file, unsigned short line)
+{
+	memmgr_stat_sub(&memmgr_class_stat[hash], size);
+	memmgr_stat_sub(memmgr_site_stat(file, line), size);
+}
+
 static inline long* memmgr_unit_tail_large(struct unit_head_large* large)
 {
 	return (long*)(((char*)&large->unit_head.checksum) + large->size);
@@ -346,6 +421,7 @@ void* _mmalloc(size_t size, const char *file, int line, const char *func )
 #endif
 
 			memmgr_unit_tail_large(p)[0] = TAILCHECK_VALUE;
+			memmgr_stat_alloc(MEMMGR_CLASS_LARGE, size, file, (unsigned short)line);
 
 			return &p->unit_head.checksum;
 		}
@@ -431,6 +507,7 @@ void* _mmalloc(size_t size, const char *file, int line, const char *func )
 	head->size  = (unsigned short)size;
 
 	memmgr_unit_tail(head)[0] = TAILCHECK_VALUE;
+	memmgr_stat_alloc(size_hash, size, file, (unsigned short)line);
 
 	return &head->checksum;
 };
@@ -537,6 +614,7 @@ void _mfree(void* ptr, const char* file, int line, const char* func)
 			}
 
 			memmgr_usage_decrease(head_large->size);
+			memmgr_stat_free(MEMMGR_CLASS_LARGE, head_large->size, head_large->unit_head.file, head_large->unit_head.line);
 
 #ifdef DEBUG_MEMMGR
 			// set freed memory to 0xfd
@@ -566,6 +644,7 @@ void _mfree(void* ptr, const char* file, int line, const char* func)
 		else
 		{
 			memmgr_usage_decrease(head->size);
+			memmgr_stat_free(block->unit_hash, head->size, head->file, head->line);
 
 			head->block = NULL;
 
@@ -778,6 +857,60 @@ bool memmgr_verify(void* ptr)
 	return false;
 }
 
+static int memmgr_cmp_site(const void* a, const void* b)
+{
+	const struct memmgr_site* site_a = *(const struct memmgr_site**)a;
+	const struct memmgr_site* site_b = *(const struct memmgr_site**)b;
+
+	if( site_a->stat.bytes != site_b->stat.bytes )
+		return ( site_a->stat.bytes < site_b->stat.bytes ) ? 1 : -1;
+	return ( site_a->stat.count < site_b->stat.count ) ? 1 : ( site_a->stat.count > site_b->stat.count ) ? -1 : 0;
+}
+
+/// Prints the live allocations by size class and the 'limit' call sites holding the most memory.
+static void memmgr_report(int limit)
+{
+	static struct memmgr_site* list[MEMMGR_SITES+1];
+	int i, n;
+
+	ShowMessage(CL_BOLD"Memory manager report:"CL_NORMAL" %lu KB in use\n", (unsigned long)memmgr_usage());
+	ShowMessage("%-12s %10s %12s %10s %12s\n", "size class", "live", "live bytes", "peak", "total");
+	for( i = 1; i <= MEMMGR_CLASS_LARGE; ++i )
+	{
+		struct memmgr_stat* stat = &memmgr_class_stat[i];
+		char name[16];
+
+		if( stat->count == 0 )
+			continue;
+		if( i == MEMMGR_CLASS_LARGE )
+			sprintf(name, "large");
+		else
+			sprintf(name, "<=%lu", (unsigned long)hash2size((unsigned short)i));
+		ShowMessage("%-12s %10lu %12lu %10lu %12lu\n", name, (unsigned long)stat->count, (unsigned long)stat->bytes, (unsigned long)stat->peak, (unsigned long)stat->total);
+	}
+
+	for( i = 0, n = 0; i < MEMMGR_SITES; ++i )
+		if( memmgr_sites[i].stat.count )
+			list[n++] = &memmgr_sites[i];
+	if( memmgr_site_other.stat.count )
+		list[n++] = &memmgr_site_other;
+	qsort(list, n, sizeof(list[0]), memmgr_cmp_site);
+
+	ShowMessage("%-40s %10s %12s %10s %12s\n", "call site", "live", "live bytes", "peak", "total");
+	for( i = 0; i < n && i < limit; ++i )
+	{
+		struct memmgr_site* site = list[i];
+		char name[64];
+
+		if( site == &memmgr_site_other )
+			sprintf(name, "(other)");
+		else
+			snprintf(name, sizeof(name), "%s:%u", site->file, site->line);
+		ShowMessage("%-40s %10lu %12lu %10lu %12lu\n", name, (unsigned long)site->stat.count, (unsigned long)site->stat.bytes, (unsigned long)site->stat.peak, (unsigned long)site->stat.total);
+	}
+	ShowMessage("End of report\n");
+}
+
 static void memmgr_final(void)
 {
 	struct block *block = block_first;
@@ -845,6 +978,129 @@ static void memmgr_init(void)
 #endif /* USE_MEMMGR */
 
 
+/*======================================
+ * Arena
+ *--------------------------------------
+ * Memory is handed out from large chunks by bumping an offset.
+ * Allocations bigger than the chunk size get a chunk of their own.
+ */
+
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(n) (((n) + (ARENA_ALIGN-1)) & ~(size_t)(ARENA_ALIGN-1))
+
+struct arena_chunk {
+	struct arena_chunk* next;
+	size_t size; // usable bytes after the header
+	size_t used;
+};
+
+#define ARENA_HEADER ARENA_ROUND(sizeof(struct arena_chunk))
+
+struct arena {
+	struct arena_chunk* head; // chunk being filled, older ones follow
+	size_t chunk_size;
+	size_t usage; // bytes handed out
+};
+
+static struct arena_chunk* arena_newchunk(size_t size)
+{
+	struct arena_chunk* c = (struct arena_chunk*)aMalloc(ARENA_HEADER + size);
+	c->next = NULL;
+	c->size = size;
+	c->used = 0;
+	return c;
+}
+
+/// Creates an arena which allocates chunk_size bytes at a time.
+struct arena* arena_create(size_t chunk_size)
+{
+	struct arena* a;
+	CREATE(a, struct arena, 1);
+	a->chunk_size = ARENA_ROUND(chunk_size > 0 ? chunk_size : 64*1024);
+	a->head = arena_newchunk(a->chunk_size);
+	a->usage = 0;
+	return a;
+}
+
+/// Allocates size bytes from the arena.
+/// The memory is aligned to ARENA_ALIGN bytes and lives until the arena is reset or destroyed.
+void* arena_alloc(struct arena* a, size_t size)
+{
+	struct arena_chunk* c;
+
+	size = ARENA_ROUND(size > 0 ? size : 1);
+	if( size > a->chunk_size )
+	{// dedicated chunk, linked behind the current one so that one keeps being filled
+		c = arena_newchunk(size);
+		c->next = a->head->next;
+		a->head->next = c;
+	}
+	else if( a->head->size - a->head->used < size )
+	{
+		c = arena_newchunk(a->chunk_size);
+		c->next = a->head;
+		a->head = c;
+	}
+	else
+		c = a->head;
+
+	c->used += size;
+	a->usage += size;
+	return (char*)c + ARENA_HEADER + c->used - size;
+}
+
+void* arena_calloc(struct arena* a, size_t num, size_t size)
+{
+	void* ret = arena_alloc(a, num*size);
+	memset(ret, 0, num*size);
+	return ret;
+}
+
+char* arena_strdup(struct arena* a, const char* p)
+{
+	size_t len = strlen(p) + 1;
+	char* ret = (char*)arena_alloc(a, len);
+	memcpy(ret, p, len);
+	return ret;
+}
+
+/// Releases all allocations, keeping the first chunk for reuse.
+void arena_reset(struct arena* a)
+{
+	struct arena_chunk* c = a->head;
+
+	while( c->next != NULL )
+	{// the first chunk is always the last one in the list
+		struct arena_chunk* next = c->next;
+		aFree(c);
+		c = next;
+	}
+	c->used = 0;
+	a->head = c;
+	a->usage = 0;
+}
+
+/// Releases the arena and everything allocated from it.
+void arena_destroy(struct arena* a)
+{
+	struct arena_chunk* c = a->head;
+
+	while( c != NULL )
+	{
+		struct arena_chunk* next = c->next;
+		aFree(c);
+		c = next;
+	}
+	aFree(a);
+}
+
+/// Returns the amount of bytes handed out by the arena.
+size_t arena_usage(struct arena* a)
+{
+	return a->usage;
+}
+
+
 /*======================================
  * Initialise
  *--------------------------------------
@@ -870,6 +1126,18 @@ bool malloc_verify_ptr(void* ptr)
 }
 
 
+/// Prints the allocation statistics of the memory manager.
+/// Lists the allocations by size class and the 'limit' call sites holding the most memory.
+void malloc_report(int limit)
+{
+#ifdef USE_MEMMGR
+	memmgr_report(limit);
+#else
+	ShowInfo("Memory manager is disabled, no allocation statistics available.\n");
+#endif
+}
+
+
 size_t malloc_usage(void)
 {
 #ifdef USE_MEMMGR
@@ -83,9 +83,26 @@
 
 ////////////////////////////////////////////////
 
+////////////// Arena //////////////////////////
+// Bump allocator for data that is loaded in bulk and released as a whole.
+// Individual allocations cannot be freed, only the complete arena.
+
+struct arena;
+
+struct arena* arena_create(size_t chunk_size);
+void* arena_alloc(struct arena* a, size_t size);
+void* arena_calloc(struct arena* a, size_t num, size_t size);
+char* arena_strdup(struct arena* a, const char* p);
+void arena_reset(struct arena* a);
+void arena_destroy(struct arena* a);
+size_t arena_usage(struct arena* a);
+
+////////////////////////////////////////////////
+
 void malloc_memory_check(void);
 bool malloc_verify_ptr(void* ptr);
 size_t malloc_usage(void);
+void malloc_report(int limit);
 void malloc_init(void);
 void malloc_final(void);
 
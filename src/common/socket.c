@@ -2,6 +2,7 @@
 // For more information, see LICENCE in the main folder
 
 #include "../common/cbasetypes.h"
+#include "../common/db.h"
 #include "../common/mmo.h"
 #include "../common/timer.h"
 #include "../common/malloc.h"
@@ -206,6 +207,11 @@ int naddr_ = 0;   // # of ip addresses
 // Larger packets cause a buffer overflow and stack corruption.
 static size_t socket_max_client_packet = 20480;
 
+// Send the data of each session only once per do_sockets call (PRESEND).
+// POSTSEND then skips every session that is not being closed, so data pending after recv
+// waits for the next call, after do_timer; fewer send calls for up to one cycle of latency.
+static bool send_coalesce = false;
+
 // initial recv buffer size (this will also be the max. size)
 // biggest known packet: S 0153 <len>.w <emblem data>.?B -> 24x24 256 color .bmp (0153 + len.w + 1618/1654/1756 bytes)
 #define RFIFO_SIZE (2*1024)
@@ -339,6 +345,7 @@ int send_from_fifo(int fd)
 		return 0; // nothing to send
 
 	len = sSend(fd, (const char *) session[fd]->wdata, (int)session[fd]->wdata_size, 0);
+	session[fd]->wsends++;
 
 	if( len == SOCKET_ERROR )
 	{//An exception has occured
@@ -358,6 +365,7 @@ int send_from_fifo(int fd)
 			memmove(session[fd]->wdata, session[fd]->wdata + len, session[fd]->wdata_size - len);
 
 		session[fd]->wdata_size -= len;
+		session[fd]->wbytes += len;
 	}
 
 	return 0;
@@ -377,6 +385,45 @@ void flush_fifos(void)
 		flush_fifo(i);
 }
 
+static int socket_cmp_sends(const void* a, const void* b)
+{
+	uint32 sends_a = session[*(const int*)a]->wsends;
+	uint32 sends_b = session[*(const int*)b]->wsends;
+	return ( sends_a < sends_b ) ? 1 : ( sends_a > sends_b ) ? -1 : 0;
+}
+
+/// Prints the output statistics of the sessions.
+/// Shows the totals and the 'limit' sessions with the most send() calls.
+void socket_report(int limit)
+{
+	static int list[FD_SETSIZE];
+	uint64 bytes = 0, packets = 0, sends = 0;
+	int i, n = 0;
+
+	for( i = 1; i < fd_max; i++ )
+	{
+		if( !session_isValid(i) || session[i]->func_send != send_from_fifo )
+			continue;
+		bytes += session[i]->wbytes;
+		packets += session[i]->wpackets;
+		sends += session[i]->wsends;
+		list[n++] = i;
+	}
+	qsort(list, n, sizeof(list[0]), socket_cmp_sends);
+
+	ShowMessage(CL_BOLD"Socket report:"CL_NORMAL" %d sessions, send coalescing %s\n", n, send_coalesce ? "on" : "off");
+	ShowMessage("total: %"PRIu64" bytes, %"PRIu64" packets, %"PRIu64" send calls (%.2f packets per call)\n", bytes, packets, sends, sends ? (double)packets/sends : 0.);
+	ShowMessage("%6s %-15s %12s %10s %10s %8s\n", "fd", "ip", "bytes", "packets", "sends", "pk/send");
+	for( i = 0; i < n && i < limit; i++ )
+	{
+		struct socket_data* s = session[list[i]];
+		char ip[16];
+
+		ShowMessage("%6d %-15s %12"PRIu64" %10u %10u %8.2f\n", list[i], ip2str(s->client_addr, ip), s->wbytes, s->wpackets, s->wsends, s->wsends ? (double)s->wpackets/s->wsends : 0.);
+	}
+	ShowMessage("End of report\n");
+}
+
 /*======================================
  *	CORE : Connection functions
  *--------------------------------------*/
@@ -666,6 +713,7 @@ int WFIFOSET(int fd, size_t len)
 	}
 
 	s->wdata_size += len;
+	s->wpackets++;
 	//If the interserver has 200% of its normal size full, flush the data.
 	if( s->flag.server && s->wdata_size >= 2*FIFOSIZE_SERVERLINK )
 		flush_fifo(fd);
@@ -693,7 +741,7 @@ int do_sockets(int next)
 	// PRESEND Timers are executed before do_sendrecv and can send packets and/or set sessions to eof.
 	// Send remaining data and process client-side disconnects here.
 #ifdef SEND_SHORTLIST
-	send_shortlist_do_sends();
+	send_shortlist_do_sends(false);
 #else
 	for (i = 1; i < fd_max; i++)
 	{
@@ -745,15 +793,16 @@ int do_sockets(int next)
 #endif
 
 	// POSTSEND Send remaining data and handle eof sessions.
+	// With send_coalesce, only the sessions being closed send here.
 #ifdef SEND_SHORTLIST
-	send_shortlist_do_sends();
+	send_shortlist_do_sends(send_coalesce);
 #else
 	for (i = 1; i < fd_max; i++)
 	{
 		if(!session[i])
 			continue;
 
-		if(session[i]->wdata_size)
+		if(session[i]->wdata_size && (!send_coalesce || session[i]->flag.eof))
 			session[i]->func_send(i);
 
 		if(session[i]->flag.eof) //func_send can't free a session, this is safe.
@@ -780,7 +829,7 @@ int do_sockets(int next)
 			continue;
 
 		// after parse, check client's RFIFO size to know if there is an invalid packet (too big and not parsed)
-		if (session[i]->rdata_size == RFIFO_SIZE && session[i]->max_rdata == RFIFO_SIZE) {
+		if (session[i]->rdata_size - session[i]->rdata_pos == RFIFO_SIZE && session[i]->max_rdata == RFIFO_SIZE) {
 			set_eof(i);
 			continue;
 		}
@@ -794,7 +843,7 @@ int do_sockets(int next)
 // IP rules and DDoS protection
 
 typedef struct _connect_history {
-	struct _connect_history* next;
+	struct _connect_history* next;// next record in the same expiry slot
 	uint32 ip;
 	uint32 tick;
 	int count;
@@ -806,6 +855,14 @@ typedef struct _access_control {
 	uint32 mask;
 } AccessControl;
 
+/// Node of the access rule tree, one level per address bit (most significant first).
+/// A rule with a contiguous mask of N bits ends at depth N.
+typedef struct _access_node {
+	struct _access_node* child[2];
+	int allow;// index+1 of the first allow rule ending here (0 if none)
+	int deny;// index+1 of the first deny rule ending here (0 if none)
+} AccessNode;
+
 enum _aco {
 	ACO_DENY_ALLOW,
 	ACO_ALLOW_DENY,
@@ -821,12 +878,123 @@ static int access_debug    = 0;
 static int ddos_count      = 10;
 static int ddos_interval   = 3*1000;
 static int ddos_autoreset  = 10*60*1000;
-/// Connection history, an array of linked lists.
-/// The array's index for any ip is ip&0xFFFF
-static ConnectHistory* connect_history[0x10000];
+/// Allow/deny rules with contiguous masks (all the usual ones).
+static AccessNode access_tree;
+/// Number of rules with non-contiguous masks, which are still checked one by one.
+static int access_sparsenum = 0;
+/// Connection history, ip -> ConnectHistory*
+static DBMap* connect_history = NULL;
+
+/// Resolution of the connection history expiry wheel (ms).
+#define CONNECT_WHEEL_RESOLUTION 1000
+/// Number of slots of the connection history expiry wheel.
+/// Records that expire past the last slot are filed there and refiled when it comes around.
+#define CONNECT_WHEEL_SIZE 64
+/// Connection history records by expiry slot, linked through ConnectHistory::next.
+static ConnectHistory* connect_wheel[CONNECT_WHEEL_SIZE];
+/// Slot that is due next, and the tick it is due at.
+static int connect_wheel_pos = 0;
+static unsigned int connect_wheel_tick = 0;
 
 static int connect_check_(uint32 ip);
 
+/// Returns true if the mask is made of leading 1 bits only.
+static bool access_iscontiguous(uint32 mask)
+{
+	return ( ((~mask) & (~mask + 1)) == 0 );
+}
+
+/// Adds rule 'index' of the allow list (or deny list) to the rule tree.
+/// The mask must be contiguous.
+static void access_tree_add(const AccessControl* acc, int index, bool allow)
+{
+	AccessNode* node = &access_tree;
+	uint32 mask;
+	int depth;
+	int* rule;
+
+	for( mask = acc->mask, depth = 0; mask; mask <<= 1, ++depth )
+	{
+		int bit = (acc->ip >> (31 - depth))&1;
+		if( node->child[bit] == NULL )
+			CREATE(node->child[bit], AccessNode, 1);
+		node = node->child[bit];
+	}
+	rule = ( allow ? &node->allow : &node->deny );
+	if( *rule == 0 )
+		*rule = index + 1;
+}
+
+/// Releases the children of node.
+static void access_tree_clear(AccessNode* node)
+{
+	int i;
+
+	for( i = 0; i < 2; ++i )
+	{
+		if( node->child[i] == NULL )
+			continue;
+		access_tree_clear(node->child[i]);
+		aFree(node->child[i]);
+		node->child[i] = NULL;
+	}
+}
+
+/// Finds the first rule of the list that matches ip, checking only rules with non-contiguous masks.
+/// Returns index+1 of the rule, or 0 if none matches before rule 'limit'.
+static int access_sparsematch(const AccessControl* list, int num, int limit, uint32 ip)
+{
+	int i;
+
+	if( limit > 0 && limit <= num )
+		num = limit - 1;
+	for( i = 0; i < num; ++i )
+		if( !access_iscontiguous(list[i].mask) && (ip & list[i].mask) == (list[i].ip & list[i].mask) )
+			return i + 1;
+	return limit;
+}
+
+/// Finds the first allow rule and the first deny rule that match ip.
+/// Stores index+1 of the rules in allow and deny (0 if there's no match).
+static void access_match(uint32 ip, int* allow, int* deny)
+{
+	const AccessNode* node = &access_tree;
+	int depth = 0;
+
+	*allow = *deny = 0;
+	for(;;)
+	{
+		if( node->allow && (*allow == 0 || node->allow < *allow) )
+			*allow = node->allow;
+		if( node->deny && (*deny == 0 || node->deny < *deny) )
+			*deny = node->deny;
+		if( depth == 32 || (node = node->child[(ip >> (31 - depth))&1]) == NULL )
+			break;
+		++depth;
+	}
+
+	if( access_sparsenum > 0 )
+	{
+		*allow = access_sparsematch(access_allow, access_allownum, *allow, ip);
+		*deny = access_sparsematch(access_deny, access_denynum, *deny, ip);
+	}
+}
+
+/// Files a connection history record in the expiry wheel slot of its expiration.
+static void connect_history_file(ConnectHistory* hist)
+{
+	int delay = DIFF_TICK(hist->tick + (hist->ddos ? ddos_autoreset : ddos_interval*3), connect_wheel_tick);
+	int slot = delay/CONNECT_WHEEL_RESOLUTION + 1;
+
+	if( slot < 0 )
+		slot = 0;
+	else if( slot > CONNECT_WHEEL_SIZE-1 )
+		slot = CONNECT_WHEEL_SIZE-1;
+	slot = (connect_wheel_pos + slot)%CONNECT_WHEEL_SIZE;
+	hist->next = connect_wheel[slot];
+	connect_wheel[slot] = hist;
+}
+
 /// Verifies if the IP can connect. (with debug info)
 /// @see connect_check_()
 static int connect_check(uint32 ip)
@@ -843,37 +1011,31 @@ static int connect_check(uint32 ip)
 ///  1 or 2 : Connection Accepted
 static int connect_check_(uint32 ip)
 {
-	ConnectHistory* hist = connect_history[ip&0xFFFF];
-	int i;
+	ConnectHistory* hist;
+	int allow, deny;
 	int is_allowip = 0;
 	int is_denyip = 0;
 	int connect_ok = 0;
 
-	// Search the allow list
-	for( i=0; i < access_allownum; ++i ){
-		if( (ip & access_allow[i].mask) == (access_allow[i].ip & access_allow[i].mask) ){
-			if( access_debug ){
-				ShowInfo("connect_check: Found match from allow list:%d.%d.%d.%d IP:%d.%d.%d.%d Mask:%d.%d.%d.%d\n",
-					CONVIP(ip),
-					CONVIP(access_allow[i].ip),
-					CONVIP(access_allow[i].mask));
-			}
-			is_allowip = 1;
-			break;
+	// Search the allow and deny lists
+	access_match(ip, &allow, &deny);
+	if( allow ){
+		if( access_debug ){
+			ShowInfo("connect_check: Found match from allow list:%d.%d.%d.%d IP:%d.%d.%d.%d Mask:%d.%d.%d.%d\n",
+				CONVIP(ip),
+				CONVIP(access_allow[allow-1].ip),
+				CONVIP(access_allow[allow-1].mask));
 		}
+		is_allowip = 1;
 	}
-	// Search the deny list
-	for( i=0; i < access_denynum; ++i ){
-		if( (ip & access_deny[i].mask) == (access_deny[i].ip & access_deny[i].mask) ){
-			if( access_debug ){
-				ShowInfo("connect_check: Found match from deny list:%d.%d.%d.%d IP:%d.%d.%d.%d Mask:%d.%d.%d.%d\n",
-					CONVIP(ip),
-					CONVIP(access_deny[i].ip),
-					CONVIP(access_deny[i].mask));
-			}
-			is_denyip = 1;
-			break;
+	if( deny ){
+		if( access_debug ){
+			ShowInfo("connect_check: Found match from deny list:%d.%d.%d.%d IP:%d.%d.%d.%d Mask:%d.%d.%d.%d\n",
+				CONVIP(ip),
+				CONVIP(access_deny[deny-1].ip),
+				CONVIP(access_deny[deny-1].mask));
 		}
+		is_denyip = 1;
 	}
 	// Decide connection status
 	//  0 : Reject
@@ -906,72 +1068,69 @@ static int connect_check_(uint32 ip)
 	}
 
 	// Inspect connection history
-	while( hist ) {
-		if( ip == hist->ip )
-		{// IP found
-			if( hist->ddos )
-			{// flagged as DDoS
+	hist = (ConnectHistory*)idb_get(connect_history, ip);
+	if( hist )
+	{// IP found
+		if( hist->ddos )
+		{// flagged as DDoS
+			return (connect_ok == 2 ? 1 : 0);
+		} else if( DIFF_TICK(gettick(),hist->tick) < ddos_interval )
+		{// connection within ddos_interval
+			hist->tick = gettick();
+			if( hist->count++ >= ddos_count )
+			{// DDoS attack detected
+				hist->ddos = 1;
+				ShowWarning("connect_check: DDoS Attack detected from %d.%d.%d.%d!\n", CONVIP(ip));
 				return (connect_ok == 2 ? 1 : 0);
-			} else if( DIFF_TICK(gettick(),hist->tick) < ddos_interval )
-			{// connection within ddos_interval
-				hist->tick = gettick();
-				if( hist->count++ >= ddos_count )
-				{// DDoS attack detected
-					hist->ddos = 1;
-					ShowWarning("connect_check: DDoS Attack detected from %d.%d.%d.%d!\n", CONVIP(ip));
-					return (connect_ok == 2 ? 1 : 0);
-				}
-				return connect_ok;
-			} else
-			{// not within ddos_interval, clear data
-				hist->tick  = gettick();
-				hist->count = 0;
-				return connect_ok;
 			}
+			return connect_ok;
+		} else
+		{// not within ddos_interval, clear data
+			hist->tick  = gettick();
+			hist->count = 0;
+			return connect_ok;
 		}
-		hist = hist->next;
 	}
 	// IP not found, add to history
 	CREATE(hist, ConnectHistory, 1);
 	memset(hist, 0, sizeof(ConnectHistory));
 	hist->ip   = ip;
 	hist->tick = gettick();
-	hist->next = connect_history[ip&0xFFFF];
-	connect_history[ip&0xFFFF] = hist;
+	idb_put(connect_history, ip, hist);
+	connect_history_file(hist);
 	return connect_ok;
 }
 
 /// Timer function.
-/// Deletes old connection history records.
+/// Deletes old connection history records from the expiry wheel slots that are due.
+/// Records that were refreshed since they were filed are filed again.
 static int connect_check_clear(int tid, unsigned int tick, int id, intptr_t data)
 {
-	int i;
 	int clear = 0;
 	int list  = 0;
-	ConnectHistory root;
-	ConnectHistory* prev_hist;
 	ConnectHistory* hist;
+	ConnectHistory* next_hist;
 
-	for( i=0; i < 0x10000 ; ++i ){
-		prev_hist = &root;
-		root.next = hist = connect_history[i];
+	while( DIFF_TICK(tick, connect_wheel_tick) >= 0 ){
+		hist = connect_wheel[connect_wheel_pos];
+		connect_wheel[connect_wheel_pos] = NULL;
+		connect_wheel_pos = (connect_wheel_pos + 1)%CONNECT_WHEEL_SIZE;
+		connect_wheel_tick += CONNECT_WHEEL_RESOLUTION;
 		while( hist ){
+			next_hist = hist->next;
 			if( (!hist->ddos && DIFF_TICK(tick,hist->tick) > ddos_interval*3) ||
 					(hist->ddos && DIFF_TICK(tick,hist->tick) > ddos_autoreset) )
 			{// Remove connection history
-				prev_hist->next = hist->next;
+				idb_remove(connect_history, hist->ip);
 				aFree(hist);
-				hist = prev_hist->next;
 				clear++;
-			} else {
-				prev_hist = hist;
-				hist = hist->next;
-			}
+			} else
+				connect_history_file(hist);
+			hist = next_hist;
 			list++;
 		}
-		connect_history[i] = root.next;
 	}
-	if( access_debug ){
+	if( access_debug && list ){
 		ShowInfo("connect_check_clear: Cleared %d of %d from IP list.\n", clear, list);
 	}
 	return list;
@@ -1055,14 +1214,24 @@ int socket_config_read(const char* cfgName)
 				access_order = ACO_MUTUAL_FAILURE;
 		} else if (!strcmpi(w1, "allow")) {
 			RECREATE(access_allow, AccessControl, access_allownum+1);
-			if (access_ipmask(w2, &access_allow[access_allownum]))
+			if (access_ipmask(w2, &access_allow[access_allownum])) {
+				if (access_iscontiguous(access_allow[access_allownum].mask))
+					access_tree_add(&access_allow[access_allownum], access_allownum, true);
+				else
+					++access_sparsenum;
 				++access_allownum;
+			}
 			else
 				ShowError("socket_config_read: Invalid ip or ip range '%s'!\n", line);
 		} else if (!strcmpi(w1, "deny")) {
 			RECREATE(access_deny, AccessControl, access_denynum+1);
-			if (access_ipmask(w2, &access_deny[access_denynum]))
+			if (access_ipmask(w2, &access_deny[access_denynum])) {
+				if (access_iscontiguous(access_deny[access_denynum].mask))
+					access_tree_add(&access_deny[access_denynum], access_denynum, false);
+				else
+					++access_sparsenum;
 				++access_denynum;
+			}
 			else
 				ShowError("socket_config_read: Invalid ip or ip range '%s'!\n", line);
 		}
@@ -1076,6 +1245,8 @@ int socket_config_read(const char* cfgName)
 			access_debug = config_switch(w2);
 		else if (!strcmpi(w1,"socket_max_client_packet"))
 			socket_max_client_packet = strtoul(w2, NULL, 0);
+		else if (!strcmpi(w1,"send_coalesce"))
+			send_coalesce = config_switch(w2);
 		else if (!strcmpi(w1, "import"))
 			socket_config_read(w2);
 	}
@@ -1091,14 +1262,18 @@ void socket_final(void)
 	ConnectHistory* hist;
 	ConnectHistory* next_hist;
 
-	for( i=0; i < 0x10000; ++i ){
-		hist = connect_history[i];
+	for( i=0; i < CONNECT_WHEEL_SIZE; ++i ){
+		hist = connect_wheel[i];
 		while( hist ){
 			next_hist = hist->next;
 			aFree(hist);
 			hist = next_hist;
 		}
+		connect_wheel[i] = NULL;
 	}
+	db_destroy(connect_history);
+	connect_history = NULL;
+	access_tree_clear(&access_tree);
 	if( access_allow )
 		aFree(access_allow);
 	if( access_deny )
@@ -1286,10 +1461,11 @@ void socket_init(void)
 	// should hold enough buffer (it is a vacuum so to speak) as it is never flushed. [Skotlex]
 	create_session(0, null_recv, null_send, null_parse);
 
-	// Delete old connection history every 5 minutes
-	memset(connect_history, 0, sizeof(connect_history));
+	// Delete old connection history as it expires
+	connect_history = idb_alloc(DB_OPT_BASE);
+	connect_wheel_tick = gettick() + CONNECT_WHEEL_RESOLUTION;
 	add_timer_func_list(connect_check_clear, "connect_check_clear");
-	add_timer_interval(gettick()+1000, connect_check_clear, 0, 0, 5*60*1000);
+	add_timer_interval(connect_wheel_tick, connect_check_clear, 0, 0, CONNECT_WHEEL_RESOLUTION);
 
 	ShowInfo("Server supports up to '"CL_WHITE"%u"CL_RESET"' concurrent connections.\n", rlim_cur);
 }
@@ -1364,7 +1540,8 @@ void send_shortlist_add_fd(int fd)
 }
 
 // Do pending network sends and eof handling from the shortlist.
-void send_shortlist_do_sends()
+// With eof_only, sessions that are not being closed keep their data for the next call.
+void send_shortlist_do_sends(bool eof_only)
 {
 	int i;
 
@@ -1395,7 +1572,7 @@ void send_shortlist_do_sends()
 		if( session[fd] )
 		{
 			// Send data
-			if( session[fd]->wdata_size )
+			if( session[fd]->wdata_size && (!eof_only || session[fd]->flag.eof) )
 				session[fd]->func_send(fd);
 
 			// If it's been marked as eof, call the parse func on it so that
@@ -45,11 +45,14 @@
 #define WFIFOSPACE(fd) (session[fd]->max_wdata - session[fd]->wdata_size)
 
 #define RFIFOREST(fd)  (session[fd]->flag.eof ? 0 : session[fd]->rdata_size - session[fd]->rdata_pos)
+// Discards the processed part of the RFIFO.
+// Unread data is only moved to the front once the free space behind it is
+// smaller than the processed part, until then only rdata_pos advances.
 #define RFIFOFLUSH(fd) \
 	do { \
 		if(session[fd]->rdata_size == session[fd]->rdata_pos){ \
 			session[fd]->rdata_size = session[fd]->rdata_pos = 0; \
-		} else { \
+		} else if(RFIFOSPACE(fd) < session[fd]->rdata_pos) { \
 			session[fd]->rdata_size -= session[fd]->rdata_pos; \
 			memmove(session[fd]->rdata, session[fd]->rdata+session[fd]->rdata_pos, session[fd]->rdata_size); \
 			session[fd]->rdata_pos = 0; \
@@ -94,6 +97,10 @@ struct socket_data
 	size_t rdata_pos;
 	time_t rdata_tick; // time of last recv (for detecting timeouts); zero when timeout is disabled
 
+	uint64 wbytes;   // bytes sent
+	uint32 wpackets; // packets queued with WFIFOSET
+	uint32 wsends;   // send() calls
+
 	RecvFunc func_recv;
 	SendFunc func_send;
 	ParseFunc func_parse;
@@ -133,6 +140,7 @@ void socket_final(void);
 
 extern void flush_fifo(int fd);
 extern void flush_fifos(void);
+extern void socket_report(int limit);
 extern void set_nonblocking(int fd, unsigned long yes);
 
 void set_defaultparse(ParseFunc defaultparse);
@@ -164,7 +172,8 @@ void set_eof(int fd);
 // sending done on it.
 void send_shortlist_add_fd(int fd);
 // Do pending network sends (and eof handling) from the shortlist.
-void send_shortlist_do_sends();
+// With eof_only, only sessions that are being closed send their data.
+void send_shortlist_do_sends(bool eof_only);
 #endif
 
 #endif /* _SOCKET_H_ */
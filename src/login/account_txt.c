@@ -15,8 +15,8 @@
 
 /// global defines
 #define ACCOUNT_TXT_DB_VERSION 20110114
-#define AUTHS_BEFORE_SAVE 10 // flush every 10 saves
-#define AUTH_SAVING_INTERVAL 60000 // flush every 10 minutes
+#define AUTH_JOURNAL_COMPACT 1000 // fold the journal into the account file every 1000 changes
+#define AUTH_SAVING_INTERVAL 60000 // check for compaction every minute
 
 /// internal structure
 typedef struct AccountDB_TXT
@@ -25,10 +25,16 @@ typedef struct AccountDB_TXT
 
 	DBMap* accounts;       // in-memory accounts storage
 	int next_account_id;   // auto_increment
-	int auths_before_save; // prevents writing to disk too often
 	int save_timer;        // save timer id
 
+	FILE* journal;         // append-only change log, folded into account_db on compaction
+	long journal_size;     // offset just past the last complete journal line
+	int journal_entries;   // changes recorded since the last compaction
+	bool journal_lost;     // a change could not be journaled, compact on the next timer run
+	int journal_compact;   // amount of changes that triggers a compaction
+
 	char account_db[1024]; // account data storage file
+	char journal_db[1024]; // journal file (account_db + ".journal")
 	bool case_sensitive;   // how to look up usernames
 
 } AccountDB_TXT;
@@ -58,6 +64,10 @@ static bool account_db_txt_iter_next(AccountDBIterator* self, struct mmo_account
 static bool mmo_auth_fromstr(struct mmo_account* acc, char* str, unsigned int version);
 static bool mmo_auth_tostr(const struct mmo_account* acc, char* str);
 static void mmo_auth_sync(AccountDB_TXT* self);
+static void mmo_auth_journal_replay(AccountDB_TXT* db);
+static void mmo_auth_journal_open(AccountDB_TXT* db);
+static void mmo_auth_journal_save(AccountDB_TXT* db, const struct mmo_account* acc);
+static void mmo_auth_journal_remove(AccountDB_TXT* db, int account_id);
 static int mmo_auth_sync_timer(int tid, unsigned int tick, int id, intptr_t data);
 
 /// public constructor
@@ -80,8 +90,12 @@ AccountDB* account_db_txt(void)
 	// initialize to default values
 	db->accounts = NULL;
 	db->next_account_id = START_ACCOUNT_NUM;
-	db->auths_before_save = AUTHS_BEFORE_SAVE;
 	db->save_timer = INVALID_TIMER;
+	db->journal = NULL;
+	db->journal_size = 0;
+	db->journal_entries = 0;
+	db->journal_lost = false;
+	db->journal_compact = AUTH_JOURNAL_COMPACT;
 	safestrncpy(db->account_db, "save/account.txt", sizeof(db->account_db));
 	db->case_sensitive = false;
 
@@ -181,6 +195,12 @@ static bool account_db_txt_init(AccountDB* self)
 	// close data file
 	fclose(fp);
 
+	// apply changes that were not folded into the data file yet
+	mmo_auth_journal_replay(db);
+	mmo_auth_journal_open(db);
+	if( db->journal_entries > 0 )
+		mmo_auth_sync(db);
+
 	// initialize data saving timer
 	add_timer_func_list(mmo_auth_sync_timer, "mmo_auth_sync_timer");
 	db->save_timer = add_timer_interval(gettick() + AUTH_SAVING_INTERVAL, mmo_auth_sync_timer, 0, (intptr_t)db, AUTH_SAVING_INTERVAL);
@@ -199,6 +219,11 @@ static void account_db_txt_destroy(AccountDB* self)
 
 	// write data
 	mmo_auth_sync(db);
+	if( db->journal != NULL )
+	{
+		fclose(db->journal);
+		db->journal = NULL;
+	}
 
 	// delete accounts database
 	accounts->destroy(accounts, NULL);
@@ -239,6 +264,8 @@ static bool account_db_txt_get_property(AccountDB* self, const char* key, char*
 		safesnprintf(buf, buflen, "%s", db->account_db);
 	else if( strcmpi(key, "case_sensitive") == 0 )
 		safesnprintf(buf, buflen, "%d", (db->case_sensitive ? 1 : 0));
+	else if( strcmpi(key, "journal_compact") == 0 )
+		safesnprintf(buf, buflen, "%d", db->journal_compact);
 	else
 		return false;// not found
 
@@ -260,6 +287,8 @@ static bool account_db_txt_set_property(AccountDB* self, const char* key, const
 		safestrncpy(db->account_db, value, sizeof(db->account_db));
 	else if( strcmpi(key, "case_sensitive") == 0 )
 		db->case_sensitive = config_switch(value);
+	else if( strcmpi(key, "journal_compact") == 0 )
+		db->journal_compact = max(atoi(value), 1);
 	else // no match
 		return false;
 
@@ -300,8 +329,8 @@ static bool account_db_txt_create(AccountDB* self, struct mmo_account* acc)
 	if( account_id >= db->next_account_id )
 		db->next_account_id = account_id + 1;
 
-	// flush data
-	mmo_auth_sync(db);
+	// record the change
+	mmo_auth_journal_save(db, tmp);
 
 	// write output
 	acc->account_id = account_id;
@@ -323,8 +352,8 @@ static bool account_db_txt_remove(AccountDB* self, const int account_id)
 		return false;
 	}
 
-	// flush data
-	mmo_auth_sync(db);
+	// record the change
+	mmo_auth_journal_remove(db, account_id);
 
 	return true;
 }
@@ -346,9 +375,8 @@ static bool account_db_txt_save(AccountDB* self, const struct mmo_account* acc)
 	// overwrite with new data
 	memcpy(tmp, acc, sizeof(struct mmo_account));
 
-	// modify save counter and save if needed
-	if( --db->auths_before_save == 0 )
-		mmo_auth_sync(db);
+	// record the change
+	mmo_auth_journal_save(db, tmp);
 
 	return true;
 }
@@ -591,7 +619,7 @@ static bool mmo_auth_tostr(const struct mmo_account* a, char* str)
 	return true;
 }
 
-/// dump the entire account db to disk
+/// dump the entire account db to disk and empty the journal
 static void mmo_auth_sync(AccountDB_TXT* db)
 {
 	int lock;
@@ -602,6 +630,7 @@ static void mmo_auth_sync(AccountDB_TXT* db)
 	fp = lock_fopen(db->account_db, &lock);
 	if( fp == NULL )
 	{
+		ShowError("mmo_auth_sync: unable to write accounts file [%s], keeping the journal.\n", db->account_db);
 		return;
 	}
 
@@ -628,18 +657,158 @@ static void mmo_auth_sync(AccountDB_TXT* db)
 	fprintf(fp, "%d\t%%newid%%\n", db->next_account_id);
 	iter->destroy(iter);
 
-	lock_fclose(fp, db->account_db, &lock);
+	if( lock_fclose(fp, db->account_db, &lock) != 0 )
+		return; // keep the journal, the data file was not replaced
+
+	// everything is in the data file now, start a new journal
+	if( db->journal != NULL )
+		fclose(db->journal);
+	db->journal = fopen(db->journal_db, "w");
+	if( db->journal == NULL )
+		ShowError("mmo_auth_sync: unable to open journal file [%s], account changes will only be saved on compaction!\n", db->journal_db);
+	db->journal_size = 0;
+	db->journal_entries = 0;
+	db->journal_lost = false;
+}
+
+/// Journal format (one change per line, same encoding as the accounts file):
+///   S<TAB><account line>   account was created or saved
+///   D<TAB><account id>     account was removed
+/// A line without a terminating newline is the remains of an interrupted write
+/// and is ignored.
+
+/// allocates an empty account entry (DBCreateData)
+static void* create_account(DBKey key, va_list args)
+{
+	return aCalloc(1, sizeof(struct mmo_account));
+}
+
+/// apply the journal left behind by the previous run on top of the loaded accounts
+static void mmo_auth_journal_replay(AccountDB_TXT* db)
+{
+	DBMap* accounts = db->accounts;
+	FILE* fp;
+	char line[2048+2];
+
+	safesnprintf(db->journal_db, sizeof(db->journal_db), "%s.journal", db->account_db);
+	db->journal_size = 0;
+	db->journal_entries = 0;
+
+	fp = fopen(db->journal_db, "r");
+	if( fp == NULL )
+		return; // no pending changes
+
+	while( fgets(line, sizeof(line), fp) != NULL )
+	{
+		size_t len = strlen(line);
+
+		if( len == 0 || line[len-1] != '\n' )
+		{
+			ShowWarning("mmo_auth_journal_replay: ignoring incomplete entry at the end of [%s].\n", db->journal_db);
+			break;
+		}
+		db->journal_size = ftell(fp);
+
+		if( line[0] == 'S' && line[1] == '\t' )
+		{
+			struct mmo_account acc;
+			struct mmo_account* tmp;
+
+			if( !mmo_auth_fromstr(&acc, line + 2, ACCOUNT_TXT_DB_VERSION) )
+			{
+				ShowError("mmo_auth_journal_replay: skipping invalid data: %s", line);
+				continue;
+			}
+
+			tmp = (struct mmo_account*)idb_ensure(accounts, acc.account_id, create_account);
+			memcpy(tmp, &acc, sizeof(struct mmo_account));
+
+			if( acc.account_id >= db->next_account_id )
+				db->next_account_id = acc.account_id + 1;
+		}
+		else
+		if( line[0] == 'D' && line[1] == '\t' )
+		{
+			idb_remove(accounts, atoi(line + 2));
+		}
+		else
+		{
+			ShowError("mmo_auth_journal_replay: skipping invalid data: %s", line);
+			continue;
+		}
+
+		db->journal_entries++;
+	}
+
+	fclose(fp);
+
+	if( db->journal_entries > 0 )
+		ShowStatus("Replayed %d account changes from '"CL_WHITE"%s"CL_RESET"'.\n", db->journal_entries, db->journal_db);
+}
+
+/// open the journal for appending after the last complete line
+static void mmo_auth_journal_open(AccountDB_TXT* db)
+{
+	db->journal = fopen(db->journal_db, "r+");
+	if( db->journal == NULL )
+		db->journal = fopen(db->journal_db, "w");
+	if( db->journal != NULL && fseek(db->journal, db->journal_size, SEEK_SET) != 0 )
+	{
+		fclose(db->journal);
+		db->journal = NULL;
+	}
+	if( db->journal == NULL )
+		ShowError("mmo_auth_journal_open: unable to open journal file [%s], account changes will only be saved on compaction!\n", db->journal_db);
+}
+
+/// append a single line to the journal and flush it to disk
+/// a failed write is rewound, so the next line overwrites it, and the change is left to the next compaction
+static void mmo_auth_journal_write(AccountDB_TXT* db, const char* line)
+{
+	if( db->journal != NULL )
+	{
+		if( fprintf(db->journal, "%s\n", line) < 0 || fflush(db->journal) != 0 )
+		{
+			ShowError("mmo_auth_journal_write: unable to write to journal file [%s], the change will be saved on the next compaction.\n", db->journal_db);
+			clearerr(db->journal);
+			fseek(db->journal, db->journal_size, SEEK_SET);
+			db->journal_lost = true;
+		}
+		else
+			db->journal_size = ftell(db->journal);
+	}
+
+	db->journal_entries++;
+}
+
+/// record a created or modified account
+static void mmo_auth_journal_save(AccountDB_TXT* db, const struct mmo_account* acc)
+{
+	char buf[2048+2]; // ought to be big enough ^^
+
+	buf[0] = 'S';
+	buf[1] = '\t';
+	mmo_auth_tostr(acc, buf + 2);
+	mmo_auth_journal_write(db, buf);
+}
+
+/// record a removed account
+static void mmo_auth_journal_remove(AccountDB_TXT* db, int account_id)
+{
+	char buf[32];
 
-	// reset save counter
-	db->auths_before_save = AUTHS_BEFORE_SAVE;
+	sprintf(buf, "D\t%d", account_id);
+	mmo_auth_journal_write(db, buf);
 }
 
+/// folds the journal into the accounts file once enough changes were recorded
+/// (the whole accounts file is rewritten synchronously, it is not a background job)
 static int mmo_auth_sync_timer(int tid, unsigned int tick, int id, intptr_t data)
 {
 	AccountDB_TXT* db = (AccountDB_TXT*)data;
 
-	if( db->auths_before_save < AUTHS_BEFORE_SAVE )
-		mmo_auth_sync(db); // db was modified, flush it
+	if( db->journal_entries >= db->journal_compact || db->journal_lost || (db->journal == NULL && db->journal_entries > 0) )
+		mmo_auth_sync(db); // journal is getting long (or incomplete/unavailable), compact it
 
 	return 0;
 }
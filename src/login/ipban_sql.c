@@ -14,6 +14,7 @@
 #include "loginlog.h"
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 // global sql settings
 static char   global_db_hostname[32] = "127.0.0.1";
@@ -34,9 +35,146 @@ static char   ipban_table[32] = "ipbanlist";
 // globals
 static Sql* sql_handle = NULL;
 static int cleanup_timer_id = INVALID_TIMER;
+static int refresh_timer_id = INVALID_TIMER;
 static bool ipban_inited = false;
 
+/// Active bans, one trie level per octet (most significant first).
+/// A node at depth N holds the ban on its N-octet prefix, so 'a.*.*.*' is
+/// stored at depth 1 and 'a.b.c.d' at depth 4.
+/// The table in sql is the durable record, this copy is reloaded from it periodically.
+struct ipban_node
+{
+	time_t expire;// expiration of the ban on this prefix (0 if not banned)
+	struct ipban_node** child;// 256 entries, allocated on first use
+};
+static struct ipban_node ipban_root;
+
+/// Recent password failures of an ip.
+/// The last 'dynamic_pass_failure_ban_limit' failure times are kept in a ring.
+struct ipban_failures
+{
+	unsigned int count;// number of failures in the ring
+	unsigned int pos;// next slot of the ring (the oldest failure once the ring is full)
+	time_t time[1];// dynamic_pass_failure_ban_limit entries
+};
+static DBMap* failures_db = NULL;// uint32 ip -> struct ipban_failures*
+
 int ipban_cleanup(int tid, unsigned int tick, int id, intptr_t data);
+int ipban_refresh(int tid, unsigned int tick, int id, intptr_t data);
+
+
+/// Adds a ban on the first 'depth' octets of ip.
+static void ipban_trie_add(struct ipban_node* root, uint32 ip, int depth, time_t expire)
+{
+	struct ipban_node* node = root;
+	int i;
+
+	for( i = 0; i < depth; ++i )
+	{
+		uint8 octet = (uint8)(ip>>(24-8*i));
+		if( node->child == NULL )
+			CREATE(node->child, struct ipban_node*, 256);
+		if( node->child[octet] == NULL )
+			CREATE(node->child[octet], struct ipban_node, 1);
+		node = node->child[octet];
+	}
+	if( node->expire < expire )
+		node->expire = expire;
+}
+
+/// Returns true if ip or one of its prefixes has a ban that didn't expire yet.
+static bool ipban_trie_check(const struct ipban_node* root, uint32 ip, time_t now)
+{
+	const struct ipban_node* node = root;
+	int i;
+
+	for( i = 0; i < 4; ++i )
+	{
+		if( node->child == NULL || (node = node->child[(uint8)(ip>>(24-8*i))]) == NULL )
+			return false;
+		if( node->expire > now )
+			return true;
+	}
+	return false;
+}
+
+/// Releases the children of node.
+static void ipban_trie_clear(struct ipban_node* node)
+{
+	int i;
+
+	if( node->child == NULL )
+		return;
+	for( i = 0; i < 256; ++i )
+	{
+		if( node->child[i] == NULL )
+			continue;
+		ipban_trie_clear(node->child[i]);
+		aFree(node->child[i]);
+	}
+	aFree(node->child);
+	node->child = NULL;
+}
+
+/// Parses a ban mask ('a.*.*.*', 'a.b.*.*', 'a.b.c.*' or 'a.b.c.d').
+/// Returns the number of fixed octets, or 0 if the mask is invalid.
+static int ipban_parse_mask(const char* str, uint32* ip)
+{
+	int depth = 0;
+	int i;
+
+	*ip = 0;
+	for( i = 0; i < 4; ++i )
+	{
+		if( i > 0 && *str++ != '.' )
+			return 0;
+		if( *str == '*' )
+			++str;
+		else if( depth == i && ISDIGIT(*str) )
+		{
+			unsigned long octet = strtoul(str, (char**)&str, 10);
+			if( octet > 255 )
+				return 0;
+			*ip |= (uint32)octet<<(24-8*i);
+			++depth;
+		}
+		else
+			return 0;
+	}
+	return ( *str == '\0' ) ? depth : 0;
+}
+
+/// Reloads the active bans from sql.
+/// Keeps the current ones if the table can't be read.
+static void ipban_load(void)
+{
+	struct ipban_node root;
+	char* data;
+
+	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT `list`, UNIX_TIMESTAMP(`rtime`) FROM `%s` WHERE `rtime` > NOW()", ipban_table) )
+	{
+		Sql_ShowDebug(sql_handle);
+		return;
+	}
+
+	memset(&root, 0, sizeof(root));
+	while( SQL_SUCCESS == Sql_NextRow(sql_handle) )
+	{
+		uint32 ip;
+		int depth;
+
+		Sql_GetData(sql_handle, 0, &data, NULL);
+		depth = ipban_parse_mask(data, &ip);
+		if( depth == 0 )
+			continue;// not a mask ipban_check ever matched
+		Sql_GetData(sql_handle, 1, &data, NULL);
+		ipban_trie_add(&root, ip, depth, (time_t)strtoul(data, NULL, 10));
+	}
+	Sql_FreeResult(sql_handle);
+
+	ipban_trie_clear(&ipban_root);
+	ipban_root = root;
+}
 
 
 // initialize
@@ -87,6 +225,15 @@ void ipban_init(void)
 	ShowStatus("Connected to ipban database '%s'.\n", database);
 	Sql_PrintExtendedInfo(sql_handle);
 
+	failures_db = idb_alloc(DB_OPT_RELEASE_DATA);
+
+	ipban_load();
+	if( login_config.ipban_refresh_interval > 0 )
+	{ // pick up bans added to the table by other tools
+		add_timer_func_list(ipban_refresh, "ipban_refresh");
+		refresh_timer_id = add_timer_interval(gettick()+login_config.ipban_refresh_interval*1000, ipban_refresh, 0, 0, login_config.ipban_refresh_interval*1000);
+	}
+
 	if( login_config.ipban_cleanup_interval > 0 )
 	{ // set up periodic cleanup of connection history and active bans
 		add_timer_func_list(ipban_cleanup, "ipban_cleanup");
@@ -107,6 +254,12 @@ void ipban_final(void)
 	
 	ipban_cleanup(0,0,0,0); // always clean up on login-server stop
 
+	if( login_config.ipban_refresh_interval > 0 )
+		delete_timer(refresh_timer_id, ipban_refresh);
+	ipban_trie_clear(&ipban_root);
+	db_destroy(failures_db);
+	failures_db = NULL;
+
 	// close connections
 	Sql_Free(sql_handle);
 	sql_handle = NULL;
@@ -204,45 +357,77 @@ bool ipban_config_read(const char* key, const char* value)
 // check ip against active bans list
 bool ipban_check(uint32 ip)
 {
-	uint8* p = (uint8*)&ip;
-	char* data = NULL;
-	int matches;
-
 	if( !login_config.ipban )
 		return false;// ipban disabled
 
-	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT count(*) FROM `%s` WHERE `rtime` > NOW() AND (`list` = '%u.*.*.*' OR `list` = '%u.%u.*.*' OR `list` = '%u.%u.%u.*' OR `list` = '%u.%u.%u.%u')",
-		ipban_table, p[3], p[3], p[2], p[3], p[2], p[1], p[3], p[2], p[1], p[0]) )
+	return ipban_trie_check(&ipban_root, ip, time(NULL));
+}
+
+/// Records a password failure of ip and returns the number of failures
+/// within the last dynamic_pass_failure_ban_interval minutes (up to the limit).
+static unsigned int ipban_failedattempts(uint32 ip, time_t now)
+{
+	unsigned int limit = max(login_config.dynamic_pass_failure_ban_limit, 1);
+	time_t since = now - (time_t)login_config.dynamic_pass_failure_ban_interval*60;
+	struct ipban_failures* f;
+	unsigned int i, n;
+
+	f = (struct ipban_failures*)idb_get(failures_db, ip);
+	if( f == NULL )
 	{
-		Sql_ShowDebug(sql_handle);
-		// close connection because we can't verify their connectivity.
-		return true;
+		f = (struct ipban_failures*)aCalloc(1, sizeof(struct ipban_failures) + (limit-1)*sizeof(time_t));
+		idb_put(failures_db, ip, f);
 	}
 
-	if( SQL_ERROR == Sql_NextRow(sql_handle) )
-		return true;// Shouldn't happen, but just in case...
+	f->time[f->pos] = now;
+	f->pos = (f->pos+1)%limit;
+	if( f->count < limit )
+		++f->count;
 
-	Sql_GetData(sql_handle, 0, &data, NULL);
-	matches = atoi(data);
-	Sql_FreeResult(sql_handle);
+	// count from the newest failure backwards
+	for( i = 0, n = 0; i < f->count; ++i )
+	{
+		if( f->time[(f->pos+limit-1-i)%limit] <= since )
+			break;
+		++n;
+	}
+	return n;
+}
 
-	return( matches > 0 );
+/// Forgets the ips whose newest failure is out of the window.
+static void ipban_purge_failures(void)
+{
+	unsigned int limit = max(login_config.dynamic_pass_failure_ban_limit, 1);
+	time_t since = time(NULL) - (time_t)login_config.dynamic_pass_failure_ban_interval*60;
+	DBIterator* iter;
+	struct ipban_failures* f;
+
+	if( failures_db == NULL )
+		return;
+
+	iter = db_iterator(failures_db);
+	for( f = (struct ipban_failures*)dbi_first(iter); dbi_exists(iter); f = (struct ipban_failures*)dbi_next(iter) )
+		if( f->time[(f->pos+limit-1)%limit] <= since )
+			iter->remove(iter);
+	dbi_destroy(iter);
 }
 
 // log failed attempt
 void ipban_log(uint32 ip)
 {
-	unsigned long failures;
+	time_t now = time(NULL);
+	unsigned int failures;
 
 	if( !login_config.ipban )
 		return;// ipban disabled
 
-	failures = loginlog_failedattempts(ip, login_config.dynamic_pass_failure_ban_interval);// how many times failed account? in one ip.
+	failures = ipban_failedattempts(ip, now);// how many times failed account? in one ip.
 
 	// if over the limit, add a temporary ban entry
 	if( failures >= login_config.dynamic_pass_failure_ban_limit )
 	{
 		uint8* p = (uint8*)&ip;
+		ipban_trie_add(&ipban_root, ip, 3, now + (time_t)login_config.dynamic_pass_failure_ban_duration*60);
 		if( SQL_ERROR == Sql_Query(sql_handle, "INSERT INTO `%s`(`list`,`btime`,`rtime`,`reason`) VALUES ('%u.%u.%u.*', NOW() , NOW() +  INTERVAL %d MINUTE ,'Password error ban')",
 			ipban_table, p[3], p[2], p[1], login_config.dynamic_pass_failure_ban_duration) )
 			Sql_ShowDebug(sql_handle);
@@ -258,5 +443,17 @@ int ipban_cleanup(int tid, unsigned int tick, int id, intptr_t data)
 	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `ipbanlist` WHERE `rtime` <= NOW()") )
 		Sql_ShowDebug(sql_handle);
 
+	ipban_purge_failures();
+	return 0;
+}
+
+// reload active bans
+int ipban_refresh(int tid, unsigned int tick, int id, intptr_t data)
+{
+	if( !login_config.ipban )
+		return 0;// ipban disabled
+
+	ipban_load();
+	ipban_purge_failures();
 	return 0;
 }
@@ -367,12 +367,20 @@ int parse_console(const char* command)
 		runflag = SERVER_STATE_STOP;
 	else if( strcmpi("alive", command) == 0 || strcmpi("status", command) == 0 )
 		ShowInfo(CL_CYAN"Console: "CL_BOLD"I'm Alive."CL_RESET"\n");
+	else if( strcmpi("memory", command) == 0 )
+		malloc_report(20);
+	else if( strcmpi("sockets", command) == 0 )
+		socket_report(20);
 	else if( strcmpi("help", command) == 0 )
 	{
 		ShowInfo("To shutdown the server:\n");
 		ShowInfo("  'shutdown|exit|quit|end'\n");
 		ShowInfo("To know if server is alive:\n");
 		ShowInfo("  'alive|status'\n");
+		ShowInfo("To show the allocations by size class and call site:\n");
+		ShowInfo("  'memory'\n");
+		ShowInfo("To show the bytes, packets and send calls of the connections:\n");
+		ShowInfo("  'sockets'\n");
 		ShowInfo("To create a new account:\n");
 		ShowInfo("  'create'\n");
 	}
@@ -1527,6 +1535,7 @@ void login_set_defaults()
 	login_config.login_ip = INADDR_ANY;
 	login_config.login_port = 6900;
 	login_config.ipban_cleanup_interval = 60;
+	login_config.ipban_refresh_interval = 60;
 	login_config.ip_sync_interval = 0;
 	login_config.log_login = true;
 	safestrncpy(login_config.date_format, "%Y-%m-%d %H:%M:%S", sizeof(login_config.date_format));
@@ -1614,6 +1623,8 @@ int login_config_read(const char* cfgName)
 			safestrncpy(login_config.dnsbl_servs, w2, sizeof(login_config.dnsbl_servs));
 		else if(!strcmpi(w1, "ipban_cleanup_interval"))
 			login_config.ipban_cleanup_interval = (unsigned int)atoi(w2);
+		else if(!strcmpi(w1, "ipban_refresh_interval"))
+			login_config.ipban_refresh_interval = (unsigned int)atoi(w2);
 		else if(!strcmpi(w1, "ip_sync_interval"))
 			login_config.ip_sync_interval = (unsigned int)1000*60*atoi(w2); //w2 comes in minutes.
 		else if(!strcmpi(w1, "import"))
@@ -5013,7 +5013,7 @@ ACMD_FUNC(jail)
 		return -1;
 	}
 
-	if (pl_sd->sc.data[SC_JAILED])
+	if (sc_get(&pl_sd->sc,SC_JAILED))
 	{
 		clif_displaymessage(fd, msg_txt(118)); // Player warped in jails.
 		return -1;
@@ -5065,7 +5065,7 @@ ACMD_FUNC(unjail)
 		return -1;
 	}
 
-	if (!pl_sd->sc.data[SC_JAILED])
+	if (!sc_get(&pl_sd->sc,SC_JAILED))
 	{
 		clif_displaymessage(fd, msg_txt(119)); // This player is not in jails.
 		return -1;
@@ -5152,10 +5152,10 @@ ACMD_FUNC(jailfor)
 	}
 
 	//Added by Coltaro
-	if(pl_sd->sc.data[SC_JAILED] && 
-		pl_sd->sc.data[SC_JAILED]->val1 != INT_MAX)
+	if(sc_get(&pl_sd->sc,SC_JAILED) && 
+		sc_get(&pl_sd->sc,SC_JAILED)->val1 != INT_MAX)
   	{	//Update the player's jail time
-		jailtime += pl_sd->sc.data[SC_JAILED]->val1;
+		jailtime += sc_get(&pl_sd->sc,SC_JAILED)->val1;
 		if (jailtime <= 0) {
 			jailtime = 0;
 			clif_displaymessage(pl_sd->fd, msg_txt(120)); // GM has discharge you.
@@ -5197,23 +5197,23 @@ ACMD_FUNC(jailtime)
 
 	nullpo_retr(-1, sd);
 	
-	if (!sd->sc.data[SC_JAILED]) {
+	if (!sc_get(&sd->sc,SC_JAILED)) {
 		clif_displaymessage(fd, "You are not in jail."); // You are not in jail.
 		return -1;
 	}
 
-	if (sd->sc.data[SC_JAILED]->val1 == INT_MAX) {
+	if (sc_get(&sd->sc,SC_JAILED)->val1 == INT_MAX) {
 		clif_displaymessage(fd, "You have been jailed indefinitely.");
 		return 0;
 	}
 
-	if (sd->sc.data[SC_JAILED]->val1 <= 0) { // Was not jailed with @jailfor (maybe @jail? or warped there? or got recalled?)
+	if (sc_get(&sd->sc,SC_JAILED)->val1 <= 0) { // Was not jailed with @jailfor (maybe @jail? or warped there? or got recalled?)
 		clif_displaymessage(fd, "You have been jailed for an unknown amount of time.");
 		return -1;
 	}
 
 	//Get remaining jail time
-	get_jail_time(sd->sc.data[SC_JAILED]->val1,&year,&month,&day,&hour,&minute);
+	get_jail_time(sc_get(&sd->sc,SC_JAILED)->val1,&year,&month,&day,&hour,&minute);
 	sprintf(atcmd_output,msg_txt(402),"You will remain",year,month,day,hour,minute); // You will remain in jail for %d years, %d months, %d days, %d hours and %d minutes
 
 	clif_displaymessage(fd, atcmd_output);
@@ -6431,8 +6431,8 @@ ACMD_FUNC(npctalk)
 	unsigned long color=0;
 
 	if (sd->sc.count && //no "chatting" while muted.
-		(sd->sc.data[SC_BERSERK] ||
-		(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT)))
+		(sc_get(&sd->sc,SC_BERSERK) ||
+		(sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT)))
 		return -1;
 
 	if(!ifcolor) {
@@ -6476,8 +6476,8 @@ ACMD_FUNC(pettalk)
 	}
 
 	if (sd->sc.count && //no "chatting" while muted.
-		(sd->sc.data[SC_BERSERK] ||
-		(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT)))
+		(sc_get(&sd->sc,SC_BERSERK) ||
+		(sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT)))
 		return -1;
 
 	if (!message || !*message || sscanf(message, "%99[^\n]", mes) < 1) {
@@ -6758,7 +6758,7 @@ ACMD_FUNC(unmute)
 		return -1;
 	}
 
-	if(!pl_sd->sc.data[SC_NOCHAT]) {
+	if(!sc_get(&pl_sd->sc,SC_NOCHAT)) {
 		clif_displaymessage(sd->fd,"Player is not muted");
 		return -1;
 	}
@@ -7261,8 +7261,8 @@ ACMD_FUNC(homtalk)
 	nullpo_retr(-1, sd);
 
 	if (sd->sc.count && //no "chatting" while muted.
-		(sd->sc.data[SC_BERSERK] ||
-		(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT)))
+		(sc_get(&sd->sc,SC_BERSERK) ||
+		(sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT)))
 		return -1;
 
 	if ( !merc_is_hom_active(sd->hd) ) {
@@ -7688,8 +7688,8 @@ ACMD_FUNC(me)
 	memset(atcmd_output, '\0', sizeof(atcmd_output));
 
 	if (sd->sc.count && //no "chatting" while muted.
-		(sd->sc.data[SC_BERSERK] ||
-		(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT)))
+		(sc_get(&sd->sc,SC_BERSERK) ||
+		(sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT)))
 		return -1;
 
 	if (!message || !*message || sscanf(message, "%199[^\n]", tempmes) < 0) {
@@ -8359,7 +8359,7 @@ ACMD_FUNC(main)
 				sd->state.mainchat = 1;
 				clif_displaymessage(fd, msg_txt(380)); // Main chat has been activated.
 			}
-			if (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT) {
+			if (sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT) {
 				clif_displaymessage(fd, msg_txt(387));
 				return -1;
 			}
@@ -9206,7 +9206,7 @@ bool is_atcommand(const int fd, struct map_session_data* sd, const char* message
 		return false;
 	
 	//Block NOCHAT but do not display it as a normal message
-	if( sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCOMMAND )
+	if( sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCOMMAND )
 		return true;
 		
 	// skip 10/11-langtype's codepage indicator, if detected
@@ -184,7 +184,7 @@ int battle_delay_damage (unsigned int tick, int amotion, struct block_list *src,
 	nullpo_ret(target);
 
 	sc = status_get_sc(target);
-	if( sc && sc->data[SC_DEVOTION] && damage > 0 )
+	if( sc && sc_get(sc,SC_DEVOTION) && damage > 0 )
 		damage = 0;
 
 	if (!battle_config.delay_battle_damage) {
@@ -251,19 +251,19 @@ int battle_attr_fix(struct block_list *src, struct block_list *target, int damag
 	ratio = attr_fix_table[def_lv-1][atk_elem][def_type];
 	if (sc && sc->count)
 	{
-		if(sc->data[SC_VOLCANO] && atk_elem == ELE_FIRE)
-			ratio += enchant_eff[sc->data[SC_VOLCANO]->val1-1];
-		if(sc->data[SC_VIOLENTGALE] && atk_elem == ELE_WIND)
-			ratio += enchant_eff[sc->data[SC_VIOLENTGALE]->val1-1];
-		if(sc->data[SC_DELUGE] && atk_elem == ELE_WATER)
-			ratio += enchant_eff[sc->data[SC_DELUGE]->val1-1];
+		if(sc_get(sc,SC_VOLCANO) && atk_elem == ELE_FIRE)
+			ratio += enchant_eff[sc_get(sc,SC_VOLCANO)->val1-1];
+		if(sc_get(sc,SC_VIOLENTGALE) && atk_elem == ELE_WIND)
+			ratio += enchant_eff[sc_get(sc,SC_VIOLENTGALE)->val1-1];
+		if(sc_get(sc,SC_DELUGE) && atk_elem == ELE_WATER)
+			ratio += enchant_eff[sc_get(sc,SC_DELUGE)->val1-1];
 	}
-	if( atk_elem == ELE_FIRE && tsc && tsc->count && tsc->data[SC_SPIDERWEB] )
+	if( atk_elem == ELE_FIRE && tsc && tsc->count && sc_get(tsc,SC_SPIDERWEB) )
 	{
-		tsc->data[SC_SPIDERWEB]->val1 = 0; // free to move now
-		if( tsc->data[SC_SPIDERWEB]->val2-- > 0 )
+		sc_get(tsc,SC_SPIDERWEB)->val1 = 0; // free to move now
+		if( sc_get(tsc,SC_SPIDERWEB)->val2-- > 0 )
 			damage <<= 1; // double damage
-		if( tsc->data[SC_SPIDERWEB]->val2 == 0 )
+		if( sc_get(tsc,SC_SPIDERWEB)->val2 == 0 )
 			status_change_end(target, SC_SPIDERWEB, INVALID_TIMER);
 	}
 	return damage*ratio/100;
@@ -303,7 +303,7 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 
 	sc = status_get_sc(bl);
 
-	if( sc && sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+	if( sc && sc_get(sc,SC_INVINCIBLE) && !sc_get(sc,SC_INVINCIBLEOFF) )
 		return 1;
 
 	if (skill_num == PA_PRESSURE)
@@ -312,15 +312,15 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 	if( sc && sc->count )
 	{
 		//First, sc_*'s that reduce damage to 0.
-		if( sc->data[SC_BASILICA] && !(status_get_mode(src)&MD_BOSS) && skill_num != PA_PRESSURE )
+		if( sc_get(sc,SC_BASILICA) && !(status_get_mode(src)&MD_BOSS) && skill_num != PA_PRESSURE )
 		{
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
 
-		if( sc->data[SC_SAFETYWALL] && (flag&(BF_SHORT|BF_MAGIC))==BF_SHORT )
+		if( sc_get(sc,SC_SAFETYWALL) && (flag&(BF_SHORT|BF_MAGIC))==BF_SHORT )
 		{
-			struct skill_unit_group* group = skill_id2group(sc->data[SC_SAFETYWALL]->val3);
+			struct skill_unit_group* group = skill_id2group(sc_get(sc,SC_SAFETYWALL)->val3);
 			if (group) {
 				if (--group->val2<=0)
 					skill_delunitgroup(group);
@@ -330,13 +330,13 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 			status_change_end(bl, SC_SAFETYWALL, INVALID_TIMER);
 		}
 
-		if( sc->data[SC_PNEUMA] && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG )
+		if( sc_get(sc,SC_PNEUMA) && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG )
 		{
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
 
-		if( (sce=sc->data[SC_AUTOGUARD]) && flag&BF_WEAPON && !(skill_get_nk(skill_num)&NK_NO_CARDFIX_ATK) && rand()%100 < sce->val2 )
+		if( (sce=sc_get(sc,SC_AUTOGUARD)) && flag&BF_WEAPON && !(skill_get_nk(skill_num)&NK_NO_CARDFIX_ATK) && rand()%100 < sce->val2 )
 		{
 			int delay;
 			clif_skill_nodamage(bl,bl,CR_AUTOGUARD,sce->val1,1);
@@ -349,34 +349,34 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 				delay = 100;
 			unit_set_walkdelay(bl, gettick(), delay, 1);
 
-			if(sc->data[SC_SHRINK] && rand()%100<5*sce->val1)
+			if(sc_get(sc,SC_SHRINK) && rand()%100<5*sce->val1)
 				skill_blown(bl,src,skill_get_blewcount(CR_SHRINK,1),-1,0);
 			return 0;
 		}
 
-		if( (sce=sc->data[SC_PARRYING]) && flag&BF_WEAPON && skill_num != WS_CARTTERMINATION && rand()%100 < sce->val2 )
+		if( (sce=sc_get(sc,SC_PARRYING)) && flag&BF_WEAPON && skill_num != WS_CARTTERMINATION && rand()%100 < sce->val2 )
 		{ // attack blocked by Parrying
 			clif_skill_nodamage(bl, bl, LK_PARRYING, sce->val1,1);
 			return 0;
 		}
 		
-		if(sc->data[SC_DODGE] && !sc->opt1 &&
-			(flag&BF_LONG || sc->data[SC_SPURT])
+		if(sc_get(sc,SC_DODGE) && !sc->opt1 &&
+			(flag&BF_LONG || sc_get(sc,SC_SPURT))
 			&& rand()%100 < 20) {
 			if (sd && pc_issit(sd)) pc_setstand(sd); //Stand it to dodge.
 			clif_skill_nodamage(bl,bl,TK_DODGE,1,1);
-			if (!sc->data[SC_COMBO])
+			if (!sc_get(sc,SC_COMBO))
 				sc_start4(bl, SC_COMBO, 100, TK_JUMPKICK, src->id, 1, 0, 2000);
 			return 0;
 		}
 
-		if(sc->data[SC_HERMODE] && flag&BF_MAGIC)
+		if(sc_get(sc,SC_HERMODE) && flag&BF_MAGIC)
 			return 0;
 
-		if(sc->data[SC_TATAMIGAESHI] && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG)
+		if(sc_get(sc,SC_TATAMIGAESHI) && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG)
 			return 0;
 
-		if((sce=sc->data[SC_KAUPE]) && rand()%100 < sce->val2)
+		if((sce=sc_get(sc,SC_KAUPE)) && rand()%100 < sce->val2)
 		{	//Kaupe blocks damage (skill or otherwise) from players, mobs, homuns, mercenaries.
 			clif_specialeffect(bl, 462, AREA);
 			//Shouldn't end until Breaker's non-weapon part connects.
@@ -386,7 +386,7 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 			return 0;
 		}
 
-		if (((sce=sc->data[SC_UTSUSEMI]) || sc->data[SC_BUNSINJYUTSU])
+		if (((sce=sc_get(sc,SC_UTSUSEMI)) || sc_get(sc,SC_BUNSINJYUTSU))
 		&& 
 			flag&BF_WEAPON && !(skill_get_nk(skill_num)&NK_NO_CARDFIX_ATK))
 		{
@@ -397,13 +397,13 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 			//Both need to be consumed if they are active.
 			if (sce && --(sce->val2) <= 0)
 				status_change_end(bl, SC_UTSUSEMI, INVALID_TIMER);
-			if ((sce=sc->data[SC_BUNSINJYUTSU]) && --(sce->val2) <= 0)
+			if ((sce=sc_get(sc,SC_BUNSINJYUTSU)) && --(sce->val2) <= 0)
 				status_change_end(bl, SC_BUNSINJYUTSU, INVALID_TIMER);
 			return 0;
 		}
 
 		//Now damage increasing effects
-		if( sc->data[SC_AETERNA] && skill_num != PF_SOULBURN )
+		if( sc_get(sc,SC_AETERNA) && skill_num != PF_SOULBURN )
 		{
 			if( src->type != BL_MER || skill_num == 0 )
 				damage <<= 1; // Lex Aeterna only doubles damage of regular attacks from mercenaries
@@ -413,7 +413,7 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 		}
 
 		//Finally damage reductions....
-		if( sc->data[SC_ASSUMPTIO] )
+		if( sc_get(sc,SC_ASSUMPTIO) )
 		{
 			if( map_flag_vs(bl->m) )
 				damage = damage*2/3; //Receive 66% damage
@@ -421,15 +421,15 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 				damage >>= 1; //Receive 50% damage
 		}
 
-		if(sc->data[SC_DEFENDER] &&
+		if(sc_get(sc,SC_DEFENDER) &&
 			(flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
-			damage=damage*(100-sc->data[SC_DEFENDER]->val2)/100;
+			damage=damage*(100-sc_get(sc,SC_DEFENDER)->val2)/100;
 
-		if(sc->data[SC_ADJUSTMENT] &&
+		if(sc_get(sc,SC_ADJUSTMENT) &&
 			(flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
 			damage -= 20*damage/100;
 
-		if(sc->data[SC_FOGWALL]) {
+		if(sc_get(sc,SC_FOGWALL)) {
 			if(flag&BF_SKILL) //25% reduction
 				damage -= 25*damage/100;
 			else if ((flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
@@ -439,25 +439,25 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 		// Compressed code, fixed by map.h [Epoque]
 		if (src->type == BL_MOB) {
 			int i;
-			if (sc->data[SC_MANU_DEF])
+			if (sc_get(sc,SC_MANU_DEF))
 				for (i=0;ARRAYLENGTH(mob_manuk)>i;i++)
 					if (mob_manuk[i]==((TBL_MOB*)src)->class_) {
-						damage -= sc->data[SC_MANU_DEF]->val1*damage/100;
+						damage -= sc_get(sc,SC_MANU_DEF)->val1*damage/100;
 						break;
 					}
-			if (sc->data[SC_SPL_DEF])
+			if (sc_get(sc,SC_SPL_DEF))
 				for (i=0;ARRAYLENGTH(mob_splendide)>i;i++)
 					if (mob_splendide[i]==((TBL_MOB*)src)->class_) {
-						damage -= sc->data[SC_SPL_DEF]->val1*damage/100;
+						damage -= sc_get(sc,SC_SPL_DEF)->val1*damage/100;
 						break;
 					}
 		}
 
-		if((sce=sc->data[SC_ARMOR]) && //NPC_DEFENDER
+		if((sce=sc_get(sc,SC_ARMOR)) && //NPC_DEFENDER
 			sce->val3&flag && sce->val4&flag)
-			damage -= damage*sc->data[SC_ARMOR]->val2/100;
+			damage -= damage*sc_get(sc,SC_ARMOR)->val2/100;
 
-		if(sc->data[SC_ENERGYCOAT] && flag&BF_WEAPON
+		if(sc_get(sc,SC_ENERGYCOAT) && flag&BF_WEAPON
 			&& skill_num != WS_CARTTERMINATION)
 		{
 			struct status_data *status = status_get_status_data(bl);
@@ -472,7 +472,7 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 
 		// FIXME:
 		// So Reject Sword calculates the redirected damage before calculating WoE/BG reduction? This is weird. [Inkfish]
-		if((sce=sc->data[SC_REJECTSWORD]) && flag&BF_WEAPON &&
+		if((sce=sc_get(sc,SC_REJECTSWORD)) && flag&BF_WEAPON &&
 			// Fixed the condition check [Aalye]
 			(src->type!=BL_PC || (
 				((TBL_PC *)src)->status.weapon == W_DAGGER ||
@@ -489,7 +489,7 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 		}
 
 		//Finally Kyrie because it may, or not, reduce damage to 0.
-		if((sce = sc->data[SC_KYRIE]) && damage > 0){
+		if((sce = sc_get(sc,SC_KYRIE)) && damage > 0){
 			sce->val2-=damage;
 			if(flag&BF_WEAPON || skill_num == TF_THROWSTONE){
 				if(sce->val2>=0)
@@ -505,7 +505,7 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 
 		//Probably not the most correct place, but it'll do here
 		//(since battle_drain is strictly for players currently)
-		if ((sce=sc->data[SC_BLOODLUST]) && flag&BF_WEAPON && damage > 0 &&
+		if ((sce=sc_get(sc,SC_BLOODLUST)) && flag&BF_WEAPON && damage > 0 &&
 			rand()%100 < sce->val3)
 			status_heal(src, damage*sce->val4/100, 0, 3);
 
@@ -516,23 +516,23 @@ int battle_calc_damage(struct block_list *src,struct block_list *bl,struct Damag
 
 	if (sc && sc->count)
 	{
-		if( sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+		if( sc_get(sc,SC_INVINCIBLE) && !sc_get(sc,SC_INVINCIBLEOFF) )
 			damage += damage * 75 / 100;
 		// [Epoque]
 		if (bl->type == BL_MOB)
 		{
 			int i;
 
-			if ( ((sce=sc->data[SC_MANU_ATK]) && (flag&BF_WEAPON)) ||
-				 ((sce=sc->data[SC_MANU_MATK]) && (flag&BF_MAGIC))
+			if ( ((sce=sc_get(sc,SC_MANU_ATK)) && (flag&BF_WEAPON)) ||
+				 ((sce=sc_get(sc,SC_MANU_MATK)) && (flag&BF_MAGIC))
 				)
 				for (i=0;ARRAYLENGTH(mob_manuk)>i;i++)
 					if (((TBL_MOB*)bl)->class_==mob_manuk[i]) {
 						damage += damage*sce->val1/100;
 						break;
 					}
-			if ( ((sce=sc->data[SC_SPL_ATK]) && (flag&BF_WEAPON)) ||
-				 ((sce=sc->data[SC_SPL_MATK]) && (flag&BF_MAGIC))
+			if ( ((sce=sc_get(sc,SC_SPL_ATK)) && (flag&BF_WEAPON)) ||
+				 ((sce=sc_get(sc,SC_SPL_MATK)) && (flag&BF_MAGIC))
 				)
 				for (i=0;ARRAYLENGTH(mob_splendide)>i;i++)
 					if (((TBL_MOB*)bl)->class_==mob_splendide[i]) {
@@ -724,7 +724,7 @@ int battle_addmastery(struct map_session_data *sd,struct block_list *target,int
 
 	if((skill = pc_checkskill(sd,HT_BEASTBANE)) > 0 && (status->race==RC_BRUTE || status->race==RC_INSECT) ) {
 		damage += (skill * 4);
-		if (sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_HUNTER)
+		if (sc_get(&sd->sc,SC_SPIRIT) && sc_get(&sd->sc,SC_SPIRIT)->val2 == SL_HUNTER)
 			damage += sd->status.str;
 	}
 
@@ -843,7 +843,7 @@ static int battle_calc_base_damage(struct status_data *status, struct weapon_atk
 		}
 	}
 	
-	if (sc && sc->data[SC_MAXIMIZEPOWER])
+	if (sc && sc_get(sc,SC_MAXIMIZEPOWER))
 		atkmin = atkmax;
 	
 	//Weapon Damage calculation
@@ -1162,7 +1162,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 		
 		if(tsc)
 		{
-			if (tsc->data[SC_SLEEP])
+			if (sc_get(tsc,SC_SLEEP))
 				cri <<=1;
 		}
 		switch (skill_num)
@@ -1194,7 +1194,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 	} else {	//Check for Perfect Hit
 		if(sd && sd->perfect_hit > 0 && rand()%100 < sd->perfect_hit)
 			flag.hit = 1;
-		if (sc && sc->data[SC_FUSION]) {
+		if (sc && sc_get(sc,SC_FUSION)) {
 			flag.hit = 1; //SG_FUSION always hit [Komurka]
 			flag.idef = flag.idef2 = 1; //def ignore [Komurka]
 		}
@@ -1206,7 +1206,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 						flag.hit = 1;
 					break;
 				case CR_SHIELDBOOMERANG:
-					if( sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_CRUSADER )
+					if( sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_CRUSADER )
 						flag.hit = 1;
 					break;
 			}
@@ -1238,7 +1238,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 		hitrate+= sstatus->hit - flee;
 
 		if(wd.flag&BF_LONG && !skill_num && //Fogwall's hit penalty is only for normal ranged attacks.
-			tsc && tsc->data[SC_FOGWALL])
+			tsc && sc_get(tsc,SC_FOGWALL))
 			hitrate -= 50;
 
 		if(sd && flag.arrow)
@@ -1366,9 +1366,9 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 				i = (flag.cri?1:0)|
 					(flag.arrow?2:0)|
 					(skill_num == HW_MAGICCRASHER?4:0)|
-					(!skill_num && sc && sc->data[SC_CHANGE]?4:0)|
+					(!skill_num && sc && sc_get(sc,SC_CHANGE)?4:0)|
 					(skill_num == MO_EXTREMITYFIST?8:0)|
-					(sc && sc->data[SC_WEAPONPERFECTION]?8:0);
+					(sc && sc_get(sc,SC_WEAPONPERFECTION)?8:0);
 				if (flag.arrow && sd)
 				switch(sd->status.weapon) {
 					case W_BOW:
@@ -1412,11 +1412,11 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 		//Skill damage modifiers that stack linearly
 		if(sc && skill_num != PA_SACRIFICE)
 		{
-			if(sc->data[SC_OVERTHRUST])
-				skillratio += sc->data[SC_OVERTHRUST]->val3;
-			if(sc->data[SC_MAXOVERTHRUST])
-				skillratio += sc->data[SC_MAXOVERTHRUST]->val2;
-			if(sc->data[SC_BERSERK])
+			if(sc_get(sc,SC_OVERTHRUST))
+				skillratio += sc_get(sc,SC_OVERTHRUST)->val3;
+			if(sc_get(sc,SC_MAXOVERTHRUST))
+				skillratio += sc_get(sc,SC_MAXOVERTHRUST)->val2;
+			if(sc_get(sc,SC_BERSERK))
 				skillratio += 100;
 		}
 		if( !skill_num )
@@ -1653,12 +1653,12 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 					break;
 				case TK_JUMPKICK:
 					skillratio += -70 + 10*skill_lv;
-					if (sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill_num)
+					if (sc && sc_get(sc,SC_COMBO) && sc_get(sc,SC_COMBO)->val1 == skill_num)
 						skillratio += 10*status_get_lv(src)/3; //Tumble bonus
 					if (wflag)
 					{
 						skillratio += 10*status_get_lv(src)/3; //Running bonus (TODO: What is the real bonus?)
-						if( sc && sc->data[SC_SPURT] )  // Spurt bonus
+						if( sc && sc_get(sc,SC_SPURT) )  // Spurt bonus
 							skillratio *= 2;
 					}
 					break;
@@ -1761,29 +1761,29 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 
 		//The following are applied on top of current damage and are stackable.
 		if (sc) {
-			if(sc->data[SC_TRUESIGHT])
-				ATK_ADDRATE(2*sc->data[SC_TRUESIGHT]->val1);
+			if(sc_get(sc,SC_TRUESIGHT))
+				ATK_ADDRATE(2*sc_get(sc,SC_TRUESIGHT)->val1);
 
-			if(sc->data[SC_EDP] &&
+			if(sc_get(sc,SC_EDP) &&
 			  	skill_num != ASC_BREAKER &&
 				skill_num != ASC_METEORASSAULT &&
 				skill_num != AS_SPLASHER &&
 				skill_num != AS_VENOMKNIFE)
-				ATK_ADDRATE(sc->data[SC_EDP]->val3);
+				ATK_ADDRATE(sc_get(sc,SC_EDP)->val3);
 		}
 
 		switch (skill_num) {
 			case AS_SONICBLOW:
-				if (sc && sc->data[SC_SPIRIT] &&
-					sc->data[SC_SPIRIT]->val2 == SL_ASSASIN)
+				if (sc && sc_get(sc,SC_SPIRIT) &&
+					sc_get(sc,SC_SPIRIT)->val2 == SL_ASSASIN)
 					ATK_ADDRATE(map_flag_gvg(src->m)?25:100); //+25% dmg on woe/+100% dmg on nonwoe
 
 				if(sd && pc_checkskill(sd,AS_SONICACCEL)>0)
 					ATK_ADDRATE(10);
 			break;
 			case CR_SHIELDBOOMERANG:
-				if(sc && sc->data[SC_SPIRIT] &&
-					sc->data[SC_SPIRIT]->val2 == SL_CRUSADER)
+				if(sc && sc_get(sc,SC_SPIRIT) &&
+					sc_get(sc,SC_SPIRIT)->val2 == SL_CRUSADER)
 					ATK_ADDRATE(100);
 				break;
 		}
@@ -1859,11 +1859,11 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 				target_count = unit_counttargeted(target,battle_config.vit_penalty_count_lv);
 				if(target_count >= battle_config.vit_penalty_count) {
 					if(battle_config.vit_penalty_type == 1) {
-						if( !tsc || !tsc->data[SC_STEELBODY] )
+						if( !tsc || !sc_get(tsc,SC_STEELBODY) )
 							def1 = (def1 * (100 - (target_count - (battle_config.vit_penalty_count - 1))*battle_config.vit_penalty_num))/100;
 						def2 = (def2 * (100 - (target_count - (battle_config.vit_penalty_count - 1))*battle_config.vit_penalty_num))/100;
 					} else { //Assume type 2
-						if( !tsc || !tsc->data[SC_STEELBODY] )
+						if( !tsc || !sc_get(tsc,SC_STEELBODY) )
 							def1 -= (target_count - (battle_config.vit_penalty_count - 1))*battle_config.vit_penalty_num;
 						def2 -= (target_count - (battle_config.vit_penalty_count - 1))*battle_config.vit_penalty_num;
 					}
@@ -1904,8 +1904,8 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 		//Post skill/vit reduction damage increases
 		if( sc && skill_num != LK_SPIRALPIERCE && skill_num != ML_SPIRALPIERCE )
 		{	//SC skill damages
-			if(sc->data[SC_AURABLADE]) 
-				ATK_ADD(20*sc->data[SC_AURABLADE]->val1);
+			if(sc_get(sc,SC_AURABLADE)) 
+				ATK_ADD(20*sc_get(sc,SC_AURABLADE)->val1);
 		}
 
 		//Refine bonus
@@ -1939,7 +1939,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 			if (flag.lh)
 				wd.damage2 = battle_addmastery(sd,target,wd.damage2,1);
 
-			if (sc && sc->data[SC_MIRACLE]) i = 2; //Star anger
+			if (sc && sc_get(sc,SC_MIRACLE)) i = 2; //Star anger
 			else
 			ARR_FIND(0, MAX_PC_FEELHATE, i, t_class == sd->hate_mob[i]);
 			if (i < MAX_PC_FEELHATE && (skill=pc_checkskill(sd,sg_info[i].anger_id))) 
@@ -1977,15 +1977,15 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 		}
 		if( flag.lh && wd.damage2 > 0 )
 			wd.damage2 = battle_attr_fix(src,target,wd.damage2,s_ele_,tstatus->def_ele, tstatus->ele_lv);
-		if( sc && sc->data[SC_WATK_ELEMENT] )
+		if( sc && sc_get(sc,SC_WATK_ELEMENT) )
 		{ // Descriptions indicate this means adding a percent of a normal attack in another element. [Skotlex]
-			int damage = battle_calc_base_damage(sstatus, &sstatus->rhw, sc, tstatus->size, sd, (flag.arrow?2:0)) * sc->data[SC_WATK_ELEMENT]->val2 / 100;
-			wd.damage += battle_attr_fix(src, target, damage, sc->data[SC_WATK_ELEMENT]->val1, tstatus->def_ele, tstatus->ele_lv);
+			int damage = battle_calc_base_damage(sstatus, &sstatus->rhw, sc, tstatus->size, sd, (flag.arrow?2:0)) * sc_get(sc,SC_WATK_ELEMENT)->val2 / 100;
+			wd.damage += battle_attr_fix(src, target, damage, sc_get(sc,SC_WATK_ELEMENT)->val1, tstatus->def_ele, tstatus->ele_lv);
 
 			if( flag.lh )
 			{
-				damage = battle_calc_base_damage(sstatus, &sstatus->lhw, sc, tstatus->size, sd, (flag.arrow?2:0)) * sc->data[SC_WATK_ELEMENT]->val2 / 100;
-				wd.damage2 += battle_attr_fix(src, target, damage, sc->data[SC_WATK_ELEMENT]->val1, tstatus->def_ele, tstatus->ele_lv);
+				damage = battle_calc_base_damage(sstatus, &sstatus->lhw, sc, tstatus->size, sd, (flag.arrow?2:0)) * sc_get(sc,SC_WATK_ELEMENT)->val2 / 100;
+				wd.damage2 += battle_attr_fix(src, target, damage, sc_get(sc,SC_WATK_ELEMENT)->val1, tstatus->def_ele, tstatus->ele_lv);
 			}
 		}
 	}
@@ -2199,8 +2199,8 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 		else	// BF_LONG (there's no other choice)
 			cardfix=cardfix*(100-tsd->long_attack_def_rate)/100;
 
-		if( tsd->sc.data[SC_DEF_RATE] )
-			cardfix=cardfix*(100-tsd->sc.data[SC_DEF_RATE]->val1)/100;
+		if( sc_get(&tsd->sc,SC_DEF_RATE) )
+			cardfix=cardfix*(100-sc_get(&tsd->sc,SC_DEF_RATE)->val1)/100;
 
 		if( cardfix != 1000 )
 			ATK_RATE(cardfix/10);
@@ -2294,7 +2294,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src,struct blo
 	}
 
 	//SG_FUSION hp penalty [Komurka]
-	if (sc && sc->data[SC_FUSION])
+	if (sc && sc_get(sc,SC_FUSION))
 	{
 		int hp= sstatus->max_hp;
 		if (sd && tsd) {
@@ -2449,7 +2449,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						break;
 					case AL_HOLYLIGHT:
 						skillratio += 25;
-						if (sd && sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_PRIEST)
+						if (sd && sc_get(&sd->sc,SC_SPIRIT) && sc_get(&sd->sc,SC_SPIRIT)->val2 == SL_PRIEST)
 							skillratio *= 5; //Does 5x damage include bonuses from other skills?
 						break;
 					case AL_RUWACH:
@@ -2641,8 +2641,8 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 
 			cardfix=cardfix*(100-tsd->magic_def_rate)/100;
 
-			if( tsd->sc.data[SC_MDEF_RATE] )
-				cardfix=cardfix*(100-tsd->sc.data[SC_MDEF_RATE]->val1)/100;
+			if( sc_get(&tsd->sc,SC_MDEF_RATE) )
+				cardfix=cardfix*(100-sc_get(&tsd->sc,SC_MDEF_RATE)->val1)/100;
 
 			if (cardfix != 1000)
 				MATK_RATE(cardfix/10);
@@ -2954,9 +2954,9 @@ int battle_calc_return_damage(struct block_list* bl, int damage, int flag)
 			if(rdamage < 1) rdamage = 1;
 		}
 		sc = status_get_sc(bl);
-		if (sc && sc->data[SC_REFLECTSHIELD])
+		if (sc && sc_get(sc,SC_REFLECTSHIELD))
 		{
-			rdamage += damage * sc->data[SC_REFLECTSHIELD]->val2 / 100;
+			rdamage += damage * sc_get(sc,SC_REFLECTSHIELD)->val2 / 100;
 			if (rdamage < 1) rdamage = 1;
 		}
 	} else {
@@ -3084,17 +3084,17 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 		}
 	}
 
-	if (sc && sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4&2))
+	if (sc && sc_get(sc,SC_CLOAKING) && !(sc_get(sc,SC_CLOAKING)->val4&2))
 		status_change_end(src, SC_CLOAKING, INVALID_TIMER);
 
-	if( tsc && tsc->data[SC_AUTOCOUNTER] && status_check_skilluse(target, src, KN_AUTOCOUNTER, 1) )
+	if( tsc && sc_get(tsc,SC_AUTOCOUNTER) && status_check_skilluse(target, src, KN_AUTOCOUNTER, 1) )
 	{
 		int dir = map_calc_dir(target,src->x,src->y);
 		int t_dir = unit_getdir(target);
 		int dist = distance_bl(src, target);
 		if(dist <= 0 || (!map_check_dir(dir,t_dir) && dist <= tstatus->rhw.range+1))
 		{
-			int skilllv = tsc->data[SC_AUTOCOUNTER]->val1;
+			int skilllv = sc_get(tsc,SC_AUTOCOUNTER)->val1;
 			clif_skillcastcancel(target); //Remove the casting bar. [Skotlex]
 			clif_damage(src, target, tick, sstatus->amotion, 1, 0, 1, 0, 0); //Display MISS.
 			status_change_end(target, SC_AUTOCOUNTER, INVALID_TIMER);
@@ -3103,9 +3103,9 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 		}
 	}
 
-	if( tsc && tsc->data[SC_BLADESTOP_WAIT] && !is_boss(src) && (src->type == BL_PC || tsd == NULL || distance_bl(src, target) <= (tsd->status.weapon == W_FIST ? 1U : 2U)) )
+	if( tsc && sc_get(tsc,SC_BLADESTOP_WAIT) && !is_boss(src) && (src->type == BL_PC || tsd == NULL || distance_bl(src, target) <= (tsd->status.weapon == W_FIST ? 1U : 2U)) )
 	{
-		int skilllv = tsc->data[SC_BLADESTOP_WAIT]->val1;
+		int skilllv = sc_get(tsc,SC_BLADESTOP_WAIT)->val1;
 		int duration = skill_get_time2(MO_BLADESTOP,skilllv);
 		status_change_end(target, SC_BLADESTOP_WAIT, INVALID_TIMER);
 		if(sc_start4(src, SC_BLADESTOP, 100, sd?pc_checkskill(sd, MO_BLADESTOP):5, 0, 0, target->id, duration))
@@ -3120,9 +3120,9 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 	if(sd && (skillv = pc_checkskill(sd,MO_TRIPLEATTACK)) > 0)
 	{
 		int triple_rate= 30 - skillv; //Base Rate
-		if (sc && sc->data[SC_SKILLRATE_UP] && sc->data[SC_SKILLRATE_UP]->val1 == MO_TRIPLEATTACK)
+		if (sc && sc_get(sc,SC_SKILLRATE_UP) && sc_get(sc,SC_SKILLRATE_UP)->val1 == MO_TRIPLEATTACK)
 		{
-			triple_rate+= triple_rate*(sc->data[SC_SKILLRATE_UP]->val2)/100;
+			triple_rate+= triple_rate*(sc_get(sc,SC_SKILLRATE_UP)->val2)/100;
 			status_change_end(src, SC_SKILLRATE_UP, INVALID_TIMER);
 		}
 		if (rand()%100 < triple_rate)
@@ -3132,11 +3132,11 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 
 	if (sc)
 	{
-		if (sc->data[SC_SACRIFICE])
+		if (sc_get(sc,SC_SACRIFICE))
 		{
-			int skilllv = sc->data[SC_SACRIFICE]->val1;
+			int skilllv = sc_get(sc,SC_SACRIFICE)->val1;
 
-			if( --sc->data[SC_SACRIFICE]->val2 <= 0 )
+			if( --sc_get(sc,SC_SACRIFICE)->val2 <= 0 )
 				status_change_end(src, SC_SACRIFICE, INVALID_TIMER);
 
 			status_zap(src, sstatus->max_hp*9/100, 0);//Damage to self is always 9%
@@ -3144,13 +3144,13 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 			//FIXME: invalid return type!
 			return (damage_lv)skill_attack(BF_WEAPON,src,src,target,PA_SACRIFICE,skilllv,tick,0);
 		}
-		if (sc->data[SC_MAGICALATTACK])
+		if (sc_get(sc,SC_MAGICALATTACK))
 			//FIXME: invalid return type!
-			return (damage_lv)skill_attack(BF_MAGIC,src,src,target,NPC_MAGICALATTACK,sc->data[SC_MAGICALATTACK]->val1,tick,0);
+			return (damage_lv)skill_attack(BF_MAGIC,src,src,target,NPC_MAGICALATTACK,sc_get(sc,SC_MAGICALATTACK)->val1,tick,0);
 	}
 
-	if(tsc && tsc->data[SC_KAAHI] && tsc->data[SC_KAAHI]->val4 == INVALID_TIMER && tstatus->hp < tstatus->max_hp)
-		tsc->data[SC_KAAHI]->val4 = add_timer(tick + skill_get_time2(SL_KAAHI,tsc->data[SC_KAAHI]->val1), kaahi_heal_timer, target->id, SC_KAAHI); //Activate heal.
+	if(tsc && sc_get(tsc,SC_KAAHI) && sc_get(tsc,SC_KAAHI)->val4 == INVALID_TIMER && tstatus->hp < tstatus->max_hp)
+		sc_get(tsc,SC_KAAHI)->val4 = add_timer(tick + skill_get_time2(SL_KAAHI,sc_get(tsc,SC_KAAHI)->val1), kaahi_heal_timer, target->id, SC_KAAHI); //Activate heal.
 
 	wd = battle_calc_attack(BF_WEAPON, src, target, 0, 0, flag);	
 
@@ -3178,9 +3178,9 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 
 	battle_delay_damage(tick, wd.amotion, src, target, wd.flag, 0, 0, damage, wd.dmg_lv, wd.dmotion);
 
-	if( tsc && tsc->data[SC_DEVOTION] )
+	if( tsc && sc_get(tsc,SC_DEVOTION) )
 	{
-		struct status_change_entry *sce = tsc->data[SC_DEVOTION];
+		struct status_change_entry *sce = sc_get(tsc,SC_DEVOTION);
 		struct block_list *d_bl = map_id2bl(sce->val1);
 
 		if( d_bl && (
@@ -3195,12 +3195,12 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 			status_change_end(target, SC_DEVOTION, INVALID_TIMER);
 	}
 
-	if (sc && sc->data[SC_AUTOSPELL] && rand()%100 < sc->data[SC_AUTOSPELL]->val4) {
+	if (sc && sc_get(sc,SC_AUTOSPELL) && rand()%100 < sc_get(sc,SC_AUTOSPELL)->val4) {
 		int sp = 0;
-		int skillid = sc->data[SC_AUTOSPELL]->val2;
-		int skilllv = sc->data[SC_AUTOSPELL]->val3;
+		int skillid = sc_get(sc,SC_AUTOSPELL)->val2;
+		int skilllv = sc_get(sc,SC_AUTOSPELL)->val3;
 		int i = rand()%100;
-		if (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_SAGE)
+		if (sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_SAGE)
 			i = 0; //Max chance, no skilllv reduction. [Skotlex]
 		if (i >= 50) skilllv -= 2;
 		else if (i >= 15) skilllv--;
@@ -3236,13 +3236,13 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 	}
 
 	if (tsc) {
-		if (tsc->data[SC_POISONREACT] && 
-			(rand()%100 < tsc->data[SC_POISONREACT]->val3
+		if (sc_get(tsc,SC_POISONREACT) && 
+			(rand()%100 < sc_get(tsc,SC_POISONREACT)->val3
 			|| sstatus->def_ele == ELE_POISON) &&
 //			check_distance_bl(src, target, tstatus->rhw.range+1) && Doesn't checks range! o.O;
 			status_check_skilluse(target, src, TF_POISON, 0)
 		) {	//Poison React
-			struct status_change_entry *sce = tsc->data[SC_POISONREACT];
+			struct status_change_entry *sce = sc_get(tsc,SC_POISONREACT);
 			if (sstatus->def_ele == ELE_POISON) {
 				sce->val2 = 0;
 				skill_attack(BF_WEAPON,target,target,src,AS_POISONREACT,sce->val1,tick,0);
@@ -4018,6 +4018,8 @@ static const struct _battle_data {
 	{ "bg_magic_attack_damage_rate",        &battle_config.bg_magic_damage_rate,            60,     0,      INT_MAX,        },
 	{ "bg_misc_attack_damage_rate",         &battle_config.bg_misc_damage_rate,             60,     0,      INT_MAX,        },
 	{ "bg_flee_penalty",                    &battle_config.bg_flee_penalty,                 20,     0,      INT_MAX,        },
+	{ "mob_ai_stagger",                     &battle_config.mob_ai_stagger,                  1,      1,      10,             },
+	{ "mob_hibernate_time",                 &battle_config.mob_hibernate_time,              60000,  0,      INT_MAX,        },
 };
 
 
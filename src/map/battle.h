@@ -497,6 +497,8 @@ extern struct Battle_Config
 	int bg_magic_damage_rate;
 	int bg_misc_damage_rate;
 	int bg_flee_penalty;
+	int mob_ai_stagger;
+	int mob_hibernate_time;
 } battle_config;
 
 void do_init_battle(void);
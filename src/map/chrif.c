@@ -1169,7 +1169,6 @@ int chrif_save_scdata(struct map_session_data *sd)
 	unsigned int tick;
 	struct status_change_data data;
 	struct status_change *sc = &sd->sc;
-	const struct TimerData *timer;
 
 	chrif_check(-1);
 	tick = gettick();
@@ -1180,21 +1179,20 @@ int chrif_save_scdata(struct map_session_data *sd)
 	WFIFOL(char_fd,8) = sd->status.char_id;
 	for (i = 0; i < SC_MAX; i++)
 	{
-		if (!sc->data[i])
+		if (!sc_get(sc,i))
 			continue;
-		if (sc->data[i]->timer != INVALID_TIMER)
+		if (sc_get(sc,i)->timed)
 		{
-			timer = get_timer(sc->data[i]->timer);
-			if (timer == NULL || timer->func != status_change_timer || DIFF_TICK(timer->tick,tick) < 0)
+			if (DIFF_TICK(sc_get(sc,i)->tick,tick) < 0)
 				continue;
-			data.tick = DIFF_TICK(timer->tick,tick); //Duration that is left before ending.
+			data.tick = DIFF_TICK(sc_get(sc,i)->tick,tick); //Duration that is left before ending.
 		} else
 			data.tick = -1; //Infinite duration
 		data.type = i;
-		data.val1 = sc->data[i]->val1;
-		data.val2 = sc->data[i]->val2;
-		data.val3 = sc->data[i]->val3;
-		data.val4 = sc->data[i]->val4;
+		data.val1 = sc_get(sc,i)->val1;
+		data.val2 = sc_get(sc,i)->val2;
+		data.val3 = sc_get(sc,i)->val3;
+		data.val4 = sc_get(sc,i)->val4;
 		memcpy(WFIFOP(char_fd,14 +count*sizeof(struct status_change_data)),
 			&data, sizeof(struct status_change_data));
 		count++;
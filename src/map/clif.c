@@ -3884,7 +3884,7 @@ static void clif_getareachar_pc(struct map_session_data* sd,struct map_session_d
 	ARR_FIND( 0, 5, i, dstsd->devotion[i] > 0 );
 	if( i < 5 ) clif_devotion(&dstsd->bl, sd);
 	// display link (dstsd - crusader) to sd
-	if( dstsd->sc.data[SC_DEVOTION] && (d_bl = map_id2bl(dstsd->sc.data[SC_DEVOTION]->val1)) != NULL )
+	if( sc_get(&dstsd->sc,SC_DEVOTION) && (d_bl = map_id2bl(sc_get(&dstsd->sc,SC_DEVOTION)->val1)) != NULL )
 		clif_devotion(d_bl, sd);
 }
 
@@ -4013,9 +4013,9 @@ int clif_damage(struct block_list* src, struct block_list* dst, unsigned int tic
 	type = clif_calc_delay(type,div,damage+damage2,ddelay);
 	sc = status_get_sc(dst);
 	if(sc && sc->count) {
-		if(sc->data[SC_HALLUCINATION]) {
-			if(damage) damage = damage*(sc->data[SC_HALLUCINATION]->val2) + rand()%100;
-			if(damage2) damage2 = damage2*(sc->data[SC_HALLUCINATION]->val2) + rand()%100;
+		if(sc_get(sc,SC_HALLUCINATION)) {
+			if(damage) damage = damage*(sc_get(sc,SC_HALLUCINATION)->val2) + rand()%100;
+			if(damage2) damage2 = damage2*(sc_get(sc,SC_HALLUCINATION)->val2) + rand()%100;
 		}
 	}
 
@@ -4662,8 +4662,8 @@ int clif_skill_damage(struct block_list *src,struct block_list *dst,unsigned int
 	type = clif_calc_delay(type,div,damage,ddelay);
 	sc = status_get_sc(dst);
 	if(sc && sc->count) {
-		if(sc->data[SC_HALLUCINATION] && damage)
-			damage = damage*(sc->data[SC_HALLUCINATION]->val2) + rand()%100;
+		if(sc_get(sc,SC_HALLUCINATION) && damage)
+			damage = damage*(sc_get(sc,SC_HALLUCINATION)->val2) + rand()%100;
 	}
 
 #if PACKETVER < 3
@@ -4751,8 +4751,8 @@ int clif_skill_damage2(struct block_list *src,struct block_list *dst,unsigned in
 	sc = status_get_sc(dst);
 
 	if(sc && sc->count) {
-		if(sc->data[SC_HALLUCINATION] && damage)
-			damage = damage*(sc->data[SC_HALLUCINATION]->val2) + rand()%100;
+		if(sc_get(sc,SC_HALLUCINATION) && damage)
+			damage = damage*(sc_get(sc,SC_HALLUCINATION)->val2) + rand()%100;
 	}
 
 	WBUFW(buf,0)=0x115;
@@ -8998,8 +8998,13 @@ void clif_parse_LoadEndAck(int fd,struct map_session_data *sd)
 			pc_setinvincibletimer(sd,battle_config.pc_invincible_time);
 	}
 
-	if( map[sd->bl.m].users++ == 0 && battle_config.dynamic_mobs )
-		map_spawnmobs(sd->bl.m);
+	if( map[sd->bl.m].users++ == 0 )
+	{
+		if( map[sd->bl.m].hibernate )
+			mob_wakeup(sd->bl.m);
+		if( battle_config.dynamic_mobs )
+			map_spawnmobs(sd->bl.m);
+	}
 	if( map[sd->bl.m].instance_id )
 	{
 		instance[map[sd->bl.m].instance_id].users++;
@@ -9355,7 +9360,7 @@ void clif_parse_WalkToXY(int fd, struct map_session_data *sd)
 	else if (pc_cant_act(sd))
 		return;
 
-	if(sd->sc.data[SC_RUN])
+	if(sc_get(&sd->sc,SC_RUN))
 		return;
 
 	pc_delinvincibletimer(sd);
@@ -9393,7 +9398,7 @@ void clif_disconnect_ack(struct map_session_data* sd, short result)
 void clif_parse_QuitGame(int fd, struct map_session_data *sd)
 {
 	/*	Rovert's prevent logout option fixed [Valaris]	*/
-	if( !sd->sc.data[SC_CLOAKING] && !sd->sc.data[SC_HIDING] && !sd->sc.data[SC_CHASEWALK] &&
+	if( !sc_get(&sd->sc,SC_CLOAKING) && !sc_get(&sd->sc,SC_HIDING) && !sc_get(&sd->sc,SC_CHASEWALK) &&
 		(!battle_config.prevent_logout || DIFF_TICK(gettick(), sd->canlog_tick) > battle_config.prevent_logout) )
 	{
 		set_eof(fd);
@@ -9462,7 +9467,7 @@ void clif_parse_GlobalMessage(int fd, struct map_session_data* sd)
 	if( is_atcommand(fd, sd, message, 1)  )
 		return;
 
-	if( sd->sc.data[SC_BERSERK] || (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT) )
+	if( sc_get(&sd->sc,SC_BERSERK) || (sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT) )
 		return;
 
 	if( battle_config.min_chat_delay )
@@ -9623,9 +9628,9 @@ void clif_parse_ActionRequest_sub(struct map_session_data *sd, int action_type,
 	}
 
 	if (sd->sc.count &&
-		(sd->sc.data[SC_TRICKDEAD] ||
-		sd->sc.data[SC_AUTOCOUNTER] ||
-		sd->sc.data[SC_BLADESTOP]))
+		(sc_get(&sd->sc,SC_TRICKDEAD) ||
+		sc_get(&sd->sc,SC_AUTOCOUNTER) ||
+		sc_get(&sd->sc,SC_BLADESTOP)))
 		return;
 
 	pc_stop_walking(sd, 1);
@@ -9645,7 +9650,7 @@ void clif_parse_ActionRequest_sub(struct map_session_data *sd, int action_type,
 		if( sd->sc.option&(OPTION_WEDDING|OPTION_XMAS|OPTION_SUMMER) )
 			return;
 
-		if( sd->sc.data[SC_BASILICA] )
+		if( sc_get(&sd->sc,SC_BASILICA) )
 			return;
 
 		if (!battle_config.sdelay_attack_enable && pc_checkskill(sd, SA_FREECAST) <= 0) {
@@ -9675,8 +9680,8 @@ void clif_parse_ActionRequest_sub(struct map_session_data *sd, int action_type,
 			break;
 
 		if (sd->sc.count && (
-			sd->sc.data[SC_DANCING] ||
-			(sd->sc.data[SC_GRAVITATION] && sd->sc.data[SC_GRAVITATION]->val3 == BCT_SELF)
+			sc_get(&sd->sc,SC_DANCING) ||
+			(sc_get(&sd->sc,SC_GRAVITATION) && sc_get(&sd->sc,SC_GRAVITATION)->val3 == BCT_SELF)
 		)) //No sitting during these states either.
 			break;
 
@@ -9732,7 +9737,7 @@ void clif_parse_Restart(int fd, struct map_session_data *sd)
 		break;
 	case 0x01:
 		/*	Rovert's Prevent logout option - Fixed [Valaris]	*/
-		if( !sd->sc.data[SC_CLOAKING] && !sd->sc.data[SC_HIDING] && !sd->sc.data[SC_CHASEWALK] &&
+		if( !sc_get(&sd->sc,SC_CLOAKING) && !sc_get(&sd->sc,SC_HIDING) && !sc_get(&sd->sc,SC_CHASEWALK) &&
 			(!battle_config.prevent_logout || DIFF_TICK(gettick(), sd->canlog_tick) > battle_config.prevent_logout) )
 		{	//Send to char-server for character selection.
 			chrif_charselectreq(sd, session[fd]->client_addr);
@@ -9761,7 +9766,7 @@ void clif_parse_WisMessage(int fd, struct map_session_data* sd)
 	if (is_atcommand(fd, sd, message, 1)  )
 		return;
 
-	if (sd->sc.data[SC_BERSERK] || (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT))
+	if (sc_get(&sd->sc,SC_BERSERK) || (sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT))
 		return;
 
 	if (battle_config.min_chat_delay)
@@ -9938,11 +9943,11 @@ void clif_parse_TakeItem(int fd, struct map_session_data *sd)
 			break;
 
 		if(sd->sc.count && (
-			sd->sc.data[SC_HIDING] ||
-			sd->sc.data[SC_CLOAKING] ||
-			sd->sc.data[SC_TRICKDEAD] ||
-			sd->sc.data[SC_BLADESTOP] ||
-			(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOITEM))
+			sc_get(&sd->sc,SC_HIDING) ||
+			sc_get(&sd->sc,SC_CLOAKING) ||
+			sc_get(&sd->sc,SC_TRICKDEAD) ||
+			sc_get(&sd->sc,SC_BLADESTOP) ||
+			(sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOITEM))
 		)
 			break;
 
@@ -9973,9 +9978,9 @@ void clif_parse_DropItem(int fd, struct map_session_data *sd)
 			break;
 
 		if (sd->sc.count && (
-			sd->sc.data[SC_AUTOCOUNTER] ||
-			sd->sc.data[SC_BLADESTOP] ||
-			(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOITEM)
+			sc_get(&sd->sc,SC_AUTOCOUNTER) ||
+			sc_get(&sd->sc,SC_BLADESTOP) ||
+			(sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOITEM)
 		))
 			break;
 
@@ -10224,7 +10229,7 @@ void clif_parse_CreateChatRoom(int fd, struct map_session_data* sd)
 	char s_password[CHATROOM_PASS_SIZE];
 	char s_title[CHATROOM_TITLE_SIZE];
 
-	if (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOROOM)
+	if (sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOROOM)
 		return;
 	if(battle_config.basic_skill_check && pc_checkskill(sd,NV_BASIC) < 4) {
 		clif_skill_fail(sd,1,USESKILL_FAIL_LEVEL,3);
@@ -10543,7 +10548,7 @@ static void clif_parse_UseSkillToPos_mercenary(struct mercenary_data *md, struct
 		return;
 	}
 
-	if( md->sc.data[SC_BASILICA] )
+	if( sc_get(&md->sc,SC_BASILICA) )
 		return;
 	lv = mercenary_checkskill(md, skillnum);
 	if( skilllv > lv )
@@ -10619,7 +10624,7 @@ void clif_parse_UseSkillToId(int fd, struct map_session_data *sd)
 	if( sd->sc.option&(OPTION_WEDDING|OPTION_XMAS|OPTION_SUMMER) )
 		return;
 
-	if( sd->sc.data[SC_BASILICA] && (skillnum != HP_BASILICA || sd->sc.data[SC_BASILICA]->val4 != sd->bl.id) )
+	if( sc_get(&sd->sc,SC_BASILICA) && (skillnum != HP_BASILICA || sc_get(&sd->sc,SC_BASILICA)->val4 != sd->bl.id) )
 		return; // On basilica only caster can use Basilica again to stop it.
 
 	if( sd->menuskill_id )
@@ -10715,7 +10720,7 @@ static void clif_parse_UseSkillToPosSub(int fd, struct map_session_data *sd, sho
 	if( sd->sc.option&(OPTION_WEDDING|OPTION_XMAS|OPTION_SUMMER) )
 		return;
 
-	if( sd->sc.data[SC_BASILICA] && (skillnum != HP_BASILICA || sd->sc.data[SC_BASILICA]->val4 != sd->bl.id) )
+	if( sc_get(&sd->sc,SC_BASILICA) && (skillnum != HP_BASILICA || sc_get(&sd->sc,SC_BASILICA)->val4 != sd->bl.id) )
 		return; // On basilica only caster can use Basilica again to stop it.
 
 	if( sd->menuskill_id )
@@ -11433,7 +11438,7 @@ void clif_parse_PartyMessage(int fd, struct map_session_data* sd)
 	if( is_atcommand(fd, sd, message, 1)  )
 		return;
 
-	if( sd->sc.data[SC_BERSERK] || (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT) )
+	if( sc_get(&sd->sc,SC_BERSERK) || (sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT) )
 		return;
 
 	if( battle_config.min_chat_delay )
@@ -11691,7 +11696,7 @@ void clif_parse_OpenVending(int fd, struct map_session_data* sd)
 	bool flag = (bool)RFIFOB(fd,84);
 	const uint8* data = (uint8*)RFIFOP(fd,85);
 
-	if( sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOROOM )
+	if( sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOROOM )
 		return;
 	if( map[sd->bl.m].flag.novending ) {
 		clif_displaymessage (sd->fd, msg_txt(276)); // "You can't open a shop on this map"
@@ -12024,7 +12029,7 @@ void clif_parse_GuildMessage(int fd, struct map_session_data* sd)
 	if( is_atcommand(fd, sd, message, 1) )
 		return;
 
-	if( sd->sc.data[SC_BERSERK] || (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT) )
+	if( sc_get(&sd->sc,SC_BERSERK) || (sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT) )
 		return;
 
 	if( battle_config.min_chat_delay )
@@ -13426,7 +13431,7 @@ void clif_parse_AutoRevive(int fd, struct map_session_data *sd)
 	if (item_position < 0)
 		return;
 
-	if (sd->sc.data[SC_HELLPOWER]) //Cannot res while under the effect of SC_HELLPOWER.
+	if (sc_get(&sd->sc,SC_HELLPOWER)) //Cannot res while under the effect of SC_HELLPOWER.
 		return;
 
 	if (!status_revive(&sd->bl, 100, 100))
@@ -15031,7 +15036,7 @@ void clif_parse_BattleChat(int fd, struct map_session_data* sd)
 	if( is_atcommand(fd, sd, message, 1) )
 		return;
 
-	if( sd->sc.data[SC_BERSERK] || (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOCHAT) )
+	if( sc_get(&sd->sc,SC_BERSERK) || (sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOCHAT) )
 		return;
 
 	if( battle_config.min_chat_delay )
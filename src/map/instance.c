@@ -17,6 +17,7 @@
 #include "map.h"
 #include "npc.h"
 #include "party.h"
+#include "path.h"
 #include "pc.h"
 
 #include <stdio.h>
@@ -146,16 +147,23 @@ int instance_add_map(const char *name, int instance_id, bool usebasename)
 	num_cell = map[im].xs * map[im].ys;
 	CREATE( map[im].cell, struct mapcell, num_cell );
 	memcpy( map[im].cell, map[m].cell, num_cell * sizeof(struct mapcell) );
+	for( i = 0; i < num_cell; i++ )
+		map[im].cell[i].skillunit = 0; // the skill units of the source map stay there
+	path_flow_clear(im);
 
 	size = map[im].bxs * map[im].bys * sizeof(struct block_list*);
 	map[im].block = (struct block_list**)aCalloc(size, 1);
 	map[im].block_mob = (struct block_list**)aCalloc(size, 1);
+	map[im].block_active = NULL;
 
 	memset(map[im].npc, 0x00, sizeof(map[i].npc));
 	map[im].npc_num = 0;
 
 	memset(map[im].moblist, 0x00, sizeof(map[im].moblist));
 	map[im].mob_delete_timer = INVALID_TIMER;
+	map[im].idle_tick = gettick();
+	map[im].hibernate = false;
+	map[im].hibernate_spawns = 0;
 
 	map[im].m = im;
 	map[im].instance_id = instance_id;
@@ -278,8 +286,11 @@ void instance_del_map(int m)
 
 	// Free memory
 	aFree(map[m].cell);
+	path_flow_clear(m);
 	aFree(map[m].block);
 	aFree(map[m].block_mob);
+	if( map[m].block_active )
+		aFree(map[m].block_active);
 
 	// Remove from instance
 	for( i = 0; i < instance[map[m].instance_id].num_map; i++ )
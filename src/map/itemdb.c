@@ -27,6 +27,10 @@ static DBMap*            itemdb_other;// int nameid -> struct item_data*
 
 static struct item_group itemgroup_db[MAX_ITEMGROUP];
 
+// item_data entries and packages are allocated in bulk and released together on reload
+static struct arena* itemdb_arena;
+#define ITEMDB_ARENA_CHUNK (256*1024)
+
 struct item_data dummy_item; //This is the default dummy item used for non-existant items. [Skotlex]
 
 
@@ -282,8 +286,7 @@ static void create_dummy_data(void)
 
 static struct item_data* create_item_data(int nameid)
 {
-	struct item_data *id;
-	CREATE(id, struct item_data, 1);
+	struct item_data *id = (struct item_data*)arena_calloc(itemdb_arena, 1, sizeof(struct item_data));
 	id->nameid = nameid;
 	id->weight = 1;
 	id->type = IT_ETC;
@@ -1168,7 +1171,7 @@ static void itemdb_read_packages(void) {
 		}
 	}
 
-	CREATE(itemdb_packages, struct item_package, config_setting_length(item_packages_conf.root));
+	itemdb_packages = (struct item_package*)arena_calloc(itemdb_arena, config_setting_length(item_packages_conf.root), sizeof(struct item_package));
 	itemdb_package_count = (unsigned short)config_setting_length(item_packages_conf.root);
 
 	/* write */
@@ -1190,18 +1193,18 @@ static void itemdb_read_packages(void) {
 		itemdb_packages[count].must_qty = must[i - 1];
 
 		if (itemdb_packages[count].random_qty) {
-			CREATE(itemdb_packages[count].random_groups, struct item_package_rand_group, itemdb_packages[count].random_qty);
+			itemdb_packages[count].random_groups = (struct item_package_rand_group*)arena_calloc(itemdb_arena, itemdb_packages[count].random_qty, sizeof(struct item_package_rand_group));
 			for (c = 0; c < itemdb_packages[count].random_qty; c++) {
 				if (!rgroups[i - 1][c])
 					ShowError("itemdb_read_packages: package '%s' missing 'Random' field %d! there must not be gaps!\n", config_setting_name(itg), c + 1);
 				else
-					CREATE(itemdb_packages[count].random_groups[c].random_list, struct item_package_rand_entry, rgroups[i - 1][c]);
+					itemdb_packages[count].random_groups[c].random_list = (struct item_package_rand_entry*)arena_calloc(itemdb_arena, rgroups[i - 1][c], sizeof(struct item_package_rand_entry));
 				itemdb_packages[count].random_groups[c].random_qty = 0;
 			}
 		}
 
 		if (itemdb_packages[count].must_qty)
-			CREATE(itemdb_packages[count].must_items, struct item_package_must_entry, itemdb_packages[count].must_qty);
+			itemdb_packages[count].must_items = (struct item_package_must_entry*)arena_calloc(itemdb_arena, itemdb_packages[count].must_qty, sizeof(struct item_package_must_entry));
 
 		c = 0;
 		while ((it = config_setting_get_elem(itg, c++))) {
@@ -1334,6 +1337,7 @@ static void itemdb_read(void)
  *------------------------------------------*/
 
 /// Destroys the item_data.
+/// The memory itself belongs to itemdb_arena unless free_self is set.
 static void destroy_item_data(struct item_data* self, int free_self)
 {
 	if( self == NULL )
@@ -1359,7 +1363,7 @@ static int itemdb_final_sub(DBKey key,void *data,va_list ap)
 	struct item_data *id = (struct item_data *)data;
 
 	if( id != &dummy_item )
-		destroy_item_data(id, 1);
+		destroy_item_data(id, 0);
 
 	return 0;
 }
@@ -1374,11 +1378,14 @@ void itemdb_reload(void)
 	// clear the previous itemdb data
 	for( i = 0; i < ARRAYLENGTH(itemdb_array); ++i )
 		if( itemdb_array[i] )
-			destroy_item_data(itemdb_array[i], 1);
+			destroy_item_data(itemdb_array[i], 0);
 
 	itemdb_other->clear(itemdb_other, itemdb_final_sub);
 
 	memset(itemdb_array, 0, sizeof(itemdb_array));
+	itemdb_packages = NULL;
+	itemdb_package_count = 0;
+	arena_reset(itemdb_arena);
 
 	// read new data
 	itemdb_read();
@@ -1397,28 +1404,17 @@ void do_final_itemdb(void)
 {
 	int i;
 
-	if (itemdb_packages) {
-		for (i = 0; i < itemdb_package_count; i++) {
-			if (itemdb_packages[i].random_groups) {
-				int j;
-				for (j = 0; j < itemdb_packages[i].random_qty; j++)
-					aFree(itemdb_packages[i].random_groups[j].random_list);
-				aFree(itemdb_packages[i].random_groups);
-			}
-			if (itemdb_packages[i].must_items)
-				aFree(itemdb_packages[i].must_items);
-		}
-		aFree(itemdb_packages);
-		itemdb_packages = NULL;
-	}
+	itemdb_packages = NULL;
 	itemdb_package_count = 0;
 
 	for( i = 0; i < ARRAYLENGTH(itemdb_array); ++i )
 		if( itemdb_array[i] )
-			destroy_item_data(itemdb_array[i], 1);
+			destroy_item_data(itemdb_array[i], 0);
 
 	itemdb_other->destroy(itemdb_other, itemdb_final_sub);
 	destroy_item_data(&dummy_item, 0);
+	arena_destroy(itemdb_arena);
+	itemdb_arena = NULL;
 }
 
 int do_init_itemdb(void)
@@ -1427,6 +1423,7 @@ int do_init_itemdb(void)
 	itemdb_package_count = 0;
 
 	memset(itemdb_array, 0, sizeof(itemdb_array));
+	itemdb_arena = arena_create(ITEMDB_ARENA_CHUNK);
 	itemdb_other = idb_alloc(DB_OPT_BASE); 
 	create_dummy_data(); //Dummy data item.
 	itemdb_read();
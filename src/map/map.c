@@ -104,6 +104,20 @@ static DBMap* nick_db=NULL; // int char_id -> struct charid2nick* (requested nam
 static DBMap* charid_db=NULL; // int char_id -> struct map_session_data*
 static DBMap* regen_db=NULL; // int id -> struct block_list* (status_natural_heal processing)
 
+/// Objects with server-allocated ids, indexed by id.
+/// Covers the ids of map_get_new_object_id (floor items, skill units, chatrooms)
+/// and of npc_get_new_npc_id (npcs, mobs, pets, homunculi, mercenaries).
+/// Pages are allocated on demand and freed once empty.
+/// Players use account ids and are only found through id_db/pc_db.
+#define MAP_IDPAGE_BITS 12
+#define MAP_IDPAGE_SIZE (1<<MAP_IDPAGE_BITS)
+struct map_idpage {
+	struct block_list* bl[MAP_IDPAGE_SIZE];
+	int count;// number of objects in this page
+};
+static struct map_idpage** map_idpages = NULL;
+static int map_idpage_count = 0;// size of map_idpages
+
 static int map_users=0;
 
 #define block_free_max 1048576
@@ -281,6 +295,26 @@ static void map_delblcell(struct block_list *bl)
 }
 #endif
 
+/*==========================================
+ * Skill unit cell flag, lets cells without skill units
+ * be skipped with a single bit test.
+ *------------------------------------------*/
+static void map_addskillcell(struct block_list *bl)
+{
+	map[bl->m].cell[bl->x+bl->y*map[bl->m].xs].skillunit = 1;
+}
+
+static void map_delskillcell(struct block_list *bl)
+{
+	struct block_list* b;
+	int m = bl->m;
+
+	for( b = map[m].block[bl->x/BLOCK_SIZE+(bl->y/BLOCK_SIZE)*map[m].bxs]; b != NULL; b = b->next )
+		if( b != bl && b->type == BL_SKILL && b->x == bl->x && b->y == bl->y )
+			return; // another unit is still on the cell
+	map[m].cell[bl->x+bl->y*map[m].xs].skillunit = 0;
+}
+
 /*==========================================
  * Adds a block to the map.
  * Returns 0 on success, 1 on failure (illegal coordinates).
@@ -327,6 +361,8 @@ int map_addblock(struct block_list* bl)
 #ifdef CELL_NOSTACK
 	map_addblcell(bl);
 #endif
+	if (bl->type == BL_SKILL)
+		map_addskillcell(bl);
 	
 	return 0;
 }
@@ -351,6 +387,8 @@ int map_delblock(struct block_list* bl)
 #ifdef CELL_NOSTACK
 	map_delblcell(bl);
 #endif
+	if (bl->type == BL_SKILL)
+		map_delskillcell(bl);
 	
 	pos = bl->x/BLOCK_SIZE+(bl->y/BLOCK_SIZE)*map[bl->m].bxs;
 
@@ -403,27 +441,33 @@ int map_moveblock(struct block_list *bl, int x1, int y1, unsigned int tick)
 		npc_unsetcells((TBL_NPC*)bl);
 
 	if (moveblock) map_delblock(bl);
+	else {
 #ifdef CELL_NOSTACK
-	else map_delblcell(bl);
+		map_delblcell(bl);
 #endif
+		if (bl->type == BL_SKILL) map_delskillcell(bl);
+	}
 	bl->x = x1;
 	bl->y = y1;
 	if (moveblock) map_addblock(bl);
+	else {
 #ifdef CELL_NOSTACK
-	else map_addblcell(bl);
+		map_addblcell(bl);
 #endif
+		if (bl->type == BL_SKILL) map_addskillcell(bl);
+	}
 
 	if (bl->type&BL_CHAR) {
 		skill_unit_move(bl,tick,3);
 		sc = status_get_sc(bl);
 		if (sc) {
 			if (sc->count) {
-				if (sc->data[SC_CLOAKING])
-					skill_check_cloaking(bl, sc->data[SC_CLOAKING]);
-				if (sc->data[SC_DANCING])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_DANCING]->val2), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_WARM])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_WARM]->val4), bl->m, x1-x0, y1-y0);
+				if (sc_get(sc,SC_CLOAKING))
+					skill_check_cloaking(bl, sc_get(sc,SC_CLOAKING));
+				if (sc_get(sc,SC_DANCING))
+					skill_unit_move_unit_group(skill_id2group(sc_get(sc,SC_DANCING)->val2), bl->m, x1-x0, y1-y0);
+				if (sc_get(sc,SC_WARM))
+					skill_unit_move_unit_group(skill_id2group(sc_get(sc,SC_WARM)->val4), bl->m, x1-x0, y1-y0);
 			}
 		}
 	} else
@@ -472,6 +516,8 @@ struct skill_unit* map_find_skill_unit_oncell(struct block_list* target,int x,in
 
 	if (x < 0 || y < 0 || (x >= map[m].xs) || (y >= map[m].ys))
 		return NULL;
+	if (!map[m].cell[x+y*map[m].xs].skillunit)
+		return NULL;
 
 	bx = x/BLOCK_SIZE;
 	by = y/BLOCK_SIZE;
@@ -557,6 +603,121 @@ int map_foreachinrange(int (*func)(struct block_list*,va_list), struct block_lis
 	return returnCount;	//[Skotlex]
 }
 
+/*==========================================
+ * Active blocks
+ * Several areas can be marked (map_activeblock_mark) and then visited in one
+ * go (map_foreachinactiveblock), where an object in overlapping areas is only
+ * visited once. Each marked block remembers the bounding box of the marked
+ * cells in it, so objects in the block but out of every area are skipped
+ * (overlaps inside a single block are merged into one box).
+ *------------------------------------------*/
+struct active_block {
+	int m, b; // map, block index
+	short x0, y0, x1, y1; // marked cells in the block
+};
+static struct active_block* active_block = NULL;
+static int active_block_count = 0;
+static int active_block_max = 0;
+
+/// Marks the cells within 'range' of 'center' as active.
+void map_activeblock_mark(struct block_list* center, int range)
+{
+	int bx, by, m;
+	int x0, x1, y0, y1;
+
+	m = center->m;
+	x0 = max(center->x-range, 0);
+	y0 = max(center->y-range, 0);
+	x1 = min(center->x+range, map[m].xs-1);
+	y1 = min(center->y+range, map[m].ys-1);
+
+	if( map[m].block_active == NULL )
+		CREATE(map[m].block_active, int, map[m].bxs*map[m].bys);
+
+	for( by = y0/BLOCK_SIZE; by <= y1/BLOCK_SIZE; by++ )
+	{
+		for( bx = x0/BLOCK_SIZE; bx <= x1/BLOCK_SIZE; bx++ )
+		{
+			int b = bx+by*map[m].bxs;
+			int i = map[m].block_active[b];
+			struct active_block* ab;
+
+			if( i < active_block_count && active_block[i].m == m && active_block[i].b == b )
+			{// already active, grow the box
+				ab = &active_block[i];
+				ab->x0 = min(ab->x0, max(x0, bx*BLOCK_SIZE));
+				ab->y0 = min(ab->y0, max(y0, by*BLOCK_SIZE));
+				ab->x1 = max(ab->x1, min(x1, bx*BLOCK_SIZE+BLOCK_SIZE-1));
+				ab->y1 = max(ab->y1, min(y1, by*BLOCK_SIZE+BLOCK_SIZE-1));
+				continue;
+			}
+
+			if( active_block_count == active_block_max )
+			{
+				active_block_max += 256;
+				RECREATE(active_block, struct active_block, active_block_max);
+			}
+			map[m].block_active[b] = active_block_count;
+			ab = &active_block[active_block_count++];
+			ab->m = m;
+			ab->b = b;
+			ab->x0 = max(x0, bx*BLOCK_SIZE);
+			ab->y0 = max(y0, by*BLOCK_SIZE);
+			ab->x1 = min(x1, bx*BLOCK_SIZE+BLOCK_SIZE-1);
+			ab->y1 = min(y1, by*BLOCK_SIZE+BLOCK_SIZE-1);
+		}
+	}
+}
+
+/// Calls func once for every object of 'type' in the cells marked by map_activeblock_mark, then clears the marks.
+int map_foreachinactiveblock(int (*func)(struct block_list*,va_list), int type, ...)
+{
+	int returnCount = 0;
+	struct block_list *bl;
+	int blockcount = bl_list_count, i;
+
+	for( i = 0; i < active_block_count; i++ )
+	{
+		struct active_block* ab = &active_block[i];
+
+		if( type&~BL_MOB )
+			for( bl = map[ab->m].block[ab->b]; bl != NULL; bl = bl->next )
+			{
+				if( bl->type&type
+					&& bl->x >= ab->x0 && bl->x <= ab->x1 && bl->y >= ab->y0 && bl->y <= ab->y1
+					&& bl_list_count < BL_LIST_MAX )
+					bl_list[bl_list_count++] = bl;
+			}
+		if( type&BL_MOB )
+			for( bl = map[ab->m].block_mob[ab->b]; bl != NULL; bl = bl->next )
+			{
+				if( bl->x >= ab->x0 && bl->x <= ab->x1 && bl->y >= ab->y0 && bl->y <= ab->y1
+					&& bl_list_count < BL_LIST_MAX )
+					bl_list[bl_list_count++] = bl;
+			}
+	}
+	active_block_count = 0;
+
+	if( bl_list_count >= BL_LIST_MAX )
+		ShowWarning("map_foreachinactiveblock: block count too many!\n");
+
+	map_freeblock_lock();
+
+	for( i = blockcount; i < bl_list_count; i++ )
+		if( bl_list[i]->prev )
+		{
+			va_list ap;
+			va_start(ap, type);
+			returnCount += func(bl_list[i], ap);
+			va_end(ap);
+		}
+
+	map_freeblock_unlock();
+
+	bl_list_count = blockcount;
+	return returnCount;
+}
+
 /*==========================================
  * Same as foreachinrange, but there must be a shoot-able range between center and target to be counted in. [Skotlex]
  *------------------------------------------*/
@@ -1159,6 +1320,60 @@ int map_foreachinmap(int (*func)(struct block_list*,va_list), int m, int type,..
 }
 
 
+/// Returns the position of a server-allocated id in the id table, or -1 for other ids.
+static int map_idslot(int id)
+{
+	if( id >= MIN_FLOORITEM && id < MAX_FLOORITEM )
+		return id - MIN_FLOORITEM;
+	if( id >= START_NPC_NUM )
+		return (MAX_FLOORITEM - MIN_FLOORITEM) + (id - START_NPC_NUM);
+	return -1;
+}
+
+/// Sets (or clears, if bl is NULL) the object of a server-allocated id in the id table.
+static void map_idtable_set(int id, struct block_list* bl)
+{
+	struct map_idpage* p;
+	int slot = map_idslot(id);
+	int page;
+
+	if( slot < 0 )
+		return;// not a server-allocated id
+
+	page = slot>>MAP_IDPAGE_BITS;
+	slot &= MAP_IDPAGE_SIZE-1;
+	if( page >= map_idpage_count )
+	{
+		int n = max(page+1, map_idpage_count*2);
+		if( bl == NULL )
+			return;
+		RECREATE(map_idpages, struct map_idpage*, n);
+		memset(map_idpages+map_idpage_count, 0, (n-map_idpage_count)*sizeof(map_idpages[0]));
+		map_idpage_count = n;
+	}
+
+	p = map_idpages[page];
+	if( p == NULL )
+	{
+		if( bl == NULL )
+			return;
+		CREATE(p, struct map_idpage, 1);
+		map_idpages[page] = p;
+	}
+
+	if( p->bl[slot] == NULL && bl != NULL )
+		p->count++;
+	else if( p->bl[slot] != NULL && bl == NULL )
+		p->count--;
+	p->bl[slot] = bl;
+
+	if( p->count == 0 )
+	{
+		aFree(p);
+		map_idpages[page] = NULL;
+	}
+}
+
 /// Generates a new flooritem object id from the interval [MIN_FLOORITEM, MAX_FLOORITEM).
 /// Used for floor items, skill units and chatroom objects.
 /// @return The new object id
@@ -1174,7 +1389,7 @@ int map_get_new_object_id(void)
 		if( i == MAX_FLOORITEM )
 			i = MIN_FLOORITEM;
 
-		if( idb_get(id_db, i) == NULL )
+		if( map_id2bl(i) == NULL )
 			break;
 
 		++i;
@@ -1500,6 +1715,7 @@ void map_addiddb(struct block_list *bl)
 		idb_put(regen_db, bl->id, bl);
 
 	idb_put(id_db,bl->id,bl);
+	map_idtable_set(bl->id, bl);
 }
 
 /*==========================================
@@ -1525,6 +1741,7 @@ void map_deliddb(struct block_list *bl)
 		idb_remove(regen_db,bl->id);
 
 	idb_remove(id_db,bl->id);
+	map_idtable_set(bl->id, NULL);
 }
 
 /*==========================================
@@ -1562,7 +1779,7 @@ int map_quit(struct map_session_data *sd)
 		status_change_end(&sd->bl, SC_BERSERK, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_TRICKDEAD, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_GUILDAURA, INVALID_TIMER);
-		if(sd->sc.data[SC_ENDURE] && sd->sc.data[SC_ENDURE]->val4)
+		if(sc_get(&sd->sc,SC_ENDURE) && sc_get(&sd->sc,SC_ENDURE)->val4)
 			status_change_end(&sd->bl, SC_ENDURE, INVALID_TIMER); //No need to save infinite endure.
 		status_change_end(&sd->bl, SC_WEIGHT50, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_WEIGHT90, INVALID_TIMER);
@@ -1574,7 +1791,7 @@ int map_quit(struct map_session_data *sd)
 			status_change_end(&sd->bl, SC_STRIPHELM, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_EXTREMITYFIST, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_EXPLOSIONSPIRITS, INVALID_TIMER);
-			if(sd->sc.data[SC_REGENERATION] && sd->sc.data[SC_REGENERATION]->val4)
+			if(sc_get(&sd->sc,SC_REGENERATION) && sc_get(&sd->sc,SC_REGENERATION)->val4)
 				status_change_end(&sd->bl, SC_REGENERATION, INVALID_TIMER);
 			//TO-DO Probably there are way more NPC_type negative status that are removed
 			status_change_end(&sd->bl, SC_CHANGEUNDEAD, INVALID_TIMER);
@@ -1636,8 +1853,9 @@ struct map_session_data * map_id2sd(int id)
 
 struct mob_data * map_id2md(int id)
 {
-	if (id <= 0) return NULL;
-	return (struct mob_data*)idb_get(mobid_db,id);
+	struct block_list* bl = map_id2bl(id);
+
+	return BL_CAST(BL_MOB, bl);
 }
 
 struct npc_data * map_id2nd(int id)
@@ -1749,7 +1967,15 @@ struct map_session_data * map_nick2sd(const char *nick)
  *------------------------------------------*/
 struct block_list * map_id2bl(int id)
 {
-	return (struct block_list*)idb_get(id_db,id);
+	int slot = map_idslot(id);
+	struct map_idpage* p;
+
+	if( slot < 0 )
+		return (struct block_list*)idb_get(id_db,id);
+
+	if( (slot>>MAP_IDPAGE_BITS) >= map_idpage_count || (p = map_idpages[slot>>MAP_IDPAGE_BITS]) == NULL )
+		return NULL;
+	return p->bl[slot&(MAP_IDPAGE_SIZE-1)];
 }
 
 /*==========================================
@@ -2060,6 +2286,7 @@ bool map_addnpc(int m,struct npc_data *nd)
 	map[m].npc[map[m].npc_num]=nd;
 	map[m].npc_num++;
 	idb_put(id_db,nd->bl.id,nd);
+	map_idtable_set(nd->bl.id, &nd->bl);
 	return true;
 }
 
@@ -2385,6 +2612,8 @@ int map_getcellp(struct map_data* m,int x,int y,cell_chk cellchk)
 			return (cell.novending);
 		case CELL_CHKNOCHAT:
 			return (cell.nochat);
+		case CELL_CHKSKILLUNIT:
+			return (cell.skillunit);
 
 		// special checks
 		case CELL_CHKPASS:
@@ -2441,6 +2670,9 @@ void map_setcell(int m, int x, int y, cell_t cell, bool flag)
 			ShowWarning("map_setcell: invalid cell type '%d'\n", (int)cell);
 			break;
 	}
+
+	if( cell == CELL_WALKABLE )
+		path_flow_clear(m); // shared path searches of this map are outdated
 }
 
 void map_setgatcell(int m, int x, int y, int gat)
@@ -2454,6 +2686,8 @@ void map_setgatcell(int m, int x, int y, int gat)
 	j = x + y*map[m].xs;
 
 	cell = map_gat2cell(gat);
+	if( map[m].cell[j].walkable != cell.walkable )
+		path_flow_clear(m);
 	map[m].cell[j].walkable = cell.walkable;
 	map[m].cell[j].shootable = cell.shootable;
 	map[m].cell[j].water = cell.water;
@@ -2953,6 +3187,9 @@ int map_readallmaps (void)
 		map[i].m = i;
 		memset(map[i].moblist, 0, sizeof(map[i].moblist));	//Initialize moblist [Skotlex]
 		map[i].mob_delete_timer = INVALID_TIMER;	//Initialize timer [Skotlex]
+		map[i].idle_tick = gettick();
+		map[i].hibernate = false;
+		map[i].hibernate_spawns = 0;
 
 		map[i].bxs = (map[i].xs + BLOCK_SIZE - 1) / BLOCK_SIZE;
 		map[i].bys = (map[i].ys + BLOCK_SIZE - 1) / BLOCK_SIZE;
@@ -3048,6 +3285,14 @@ int parse_console(const char* buf)
 		{
 			runflag = SERVER_STATE_STOP;
 		}
+		else if( strcmpi("memory", command) == 0 )
+		{
+			malloc_report(20);
+		}
+		else if( strcmpi("sockets", command) == 0 )
+		{
+			socket_report(20);
+		}
 	}
 	else if( strcmpi("help", type) == 0 )
 	{
@@ -3059,6 +3304,10 @@ int parse_console(const char* buf)
 		ShowInfo("IE: @spawn\n");
 		ShowInfo("To shutdown the server:\n");
 		ShowInfo("  server:shutdown\n");
+		ShowInfo("To show the allocations by size class and call site:\n");
+		ShowInfo("  server:memory\n");
+		ShowInfo("To show the bytes, packets and send calls of the connections:\n");
+		ShowInfo("  server:sockets\n");
 	}
 
 	return 0;
@@ -3447,11 +3696,13 @@ void do_final(void)
 	do_final_duel();
 	
 	map_db->destroy(map_db, map_db_final);
+	if( active_block ) aFree(active_block);
 	
 	for (i=0; i<map_num; i++) {
 		if(map[i].cell) aFree(map[i].cell);
 		if(map[i].block) aFree(map[i].block);
 		if(map[i].block_mob) aFree(map[i].block_mob);
+		if(map[i].block_active) aFree(map[i].block_active);
 		if(battle_config.dynamic_mobs) { //Dynamic mobs flag by [random]
 			for (j=0; j<MAX_MOB_LIST_PER_MAP; j++)
 				if (map[i].moblist[j]) aFree(map[i].moblist[j]);
@@ -3463,6 +3714,13 @@ void do_final(void)
 		grfio_final();
 
 	id_db->destroy(id_db, NULL);
+	for( i = 0; i < map_idpage_count; i++ )
+		if( map_idpages[i] )
+			aFree(map_idpages[i]);
+	if( map_idpages )
+		aFree(map_idpages);
+	map_idpages = NULL;
+	map_idpage_count = 0;
 	pc_db->destroy(pc_db, NULL);
 	mobid_db->destroy(mobid_db, NULL);
 	bossid_db->destroy(bossid_db, NULL);
@@ -3721,13 +3979,13 @@ int do_init(int argc, char *argv[])
 	inter_config_read(INTER_CONF_NAME);
 	log_config_read(LOG_CONF_NAME);
 
-	id_db = idb_alloc(DB_OPT_BASE);
-	pc_db = idb_alloc(DB_OPT_BASE);	//Added for reliable map_id2sd() use. [Skotlex]
-	mobid_db = idb_alloc(DB_OPT_BASE);	//Added to lower the load of the lazy mob ai. [Skotlex]
+	id_db = idb_alloc(DB_OPT_OPEN_HASH);
+	pc_db = idb_alloc(DB_OPT_OPEN_HASH);	//Added for reliable map_id2sd() use. [Skotlex]
+	mobid_db = idb_alloc(DB_OPT_OPEN_HASH);	//Added to lower the load of the lazy mob ai. [Skotlex]
 	bossid_db = idb_alloc(DB_OPT_BASE); // Used for Convex Mirror quick MVP search
 	map_db = uidb_alloc(DB_OPT_BASE);
 	nick_db = idb_alloc(DB_OPT_BASE);
-	charid_db = idb_alloc(DB_OPT_BASE);
+	charid_db = idb_alloc(DB_OPT_OPEN_HASH);
 	regen_db = idb_alloc(DB_OPT_BASE); // efficient status_natural_heal processing
 
 	iwall_db = strdb_alloc(DB_OPT_RELEASE_DATA,2*NAME_LENGTH+2+1); // [Zephyrus] Invisible Walls
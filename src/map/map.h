@@ -393,6 +393,7 @@ typedef enum {
 	CELL_CHKLANDPROTECTOR,
 	CELL_CHKNOVENDING,
 	CELL_CHKNOCHAT,
+	CELL_CHKSKILLUNIT,	// there may be skill units on the cell
 } cell_chk;
 
 struct mapcell
@@ -409,7 +410,8 @@ struct mapcell
 		basilica : 1,
 		landprotector : 1,
 		novending : 1,
-		nochat : 1;
+		nochat : 1,
+		skillunit : 1; // set while there are skill units on the cell (see map_addskillcell)
 
 #ifdef CELL_NOSTACK
 	unsigned char cell_bl; //Holds amount of bls in this cell.
@@ -428,6 +430,7 @@ struct map_data {
 	struct mapcell* cell; // Holds the information of each map cell (NULL if the map is not on this map-server).
 	struct block_list **block;
 	struct block_list **block_mob;
+	int* block_active; // position of each block in the active block list (see map_activeblock_mark)
 	int m;
 	short xs,ys; // map dimensions (in cells)
 	short bxs,bys; // map dimensions (in blocks)
@@ -496,6 +499,10 @@ struct map_data {
 
 	struct spawn_data *moblist[MAX_MOB_LIST_PER_MAP]; // [Wizputer]
 	int mob_delete_timer;	// [Skotlex]
+	unsigned int idle_tick; // when the last player left the map
+	unsigned int hibernate_tick; // when the mobs of the map were parked (see mob_hibernate_time)
+	int hibernate_spawns; // respawns held back while hibernating
+	bool hibernate;
 	int zone;	// zone number (for item/skill restrictions)
 	int jexp;	// map experience multiplicator
 	int bexp;	// map experience multiplicator
@@ -559,6 +566,8 @@ int map_foreachinmovearea(int (*func)(struct block_list*,va_list), struct block_
 int map_foreachincell(int (*func)(struct block_list*,va_list), int m, int x, int y, int type, ...);
 int map_foreachinpath(int (*func)(struct block_list*,va_list), int m, int x0, int y0, int x1, int y1, int range, int length, int type, ...);
 int map_foreachinmap(int (*func)(struct block_list*,va_list), int m, int type, ...);
+void map_activeblock_mark(struct block_list* center, int range);
+int map_foreachinactiveblock(int (*func)(struct block_list*,va_list), int type, ...);
 //block֘Aɒǉ
 int map_count_oncell(int m,int x,int y,int type);
 struct skill_unit *map_find_skill_unit_oncell(struct block_list *,int x,int y,int skill_id,struct skill_unit *);
@@ -67,6 +67,9 @@ struct mob_chat *mob_chat(short id) { if(id<=0 || id>MAX_MOB_CHAT || mob_chat_db
 static struct eri *item_drop_ers; //For loot drops delay structures.
 static struct eri *item_drop_list_ers;
 
+static unsigned int mob_ai_round = 0; // hard AI rounds so far
+static unsigned int mob_ai_calls = 0, mob_ai_calls_max = 0; // mobs visited by the hard AI (total, most in one round)
+
 static struct {
 	int qty;
 	int class_[350];
@@ -319,7 +322,7 @@ bool mob_ksprotected (struct block_list *src, struct block_list *target)
 		if( md->db->mexp || md->master_id )
 			return false; // MVP, Slaves mobs ignores KS
 
-		if( (sce = md->sc.data[SC_KSPROTECTED]) == NULL )
+		if( (sce = sc_get(&md->sc,SC_KSPROTECTED)) == NULL )
 			break; // No KS Protected
 
 		if( sd->bl.id == sce->val1 || // Same Owner
@@ -780,6 +783,12 @@ int mob_delayspawn(int tid, unsigned int tick, int id, intptr_t data)
 			return 0;
 		}
 		md->spawn_timer = INVALID_TIMER;
+		if( md->spawn && map[md->spawn->m].hibernate )
+		{// nobody is there to see it, spawn it when the map wakes up
+			md->state.hibernate_spawn = 1;
+			map[md->spawn->m].hibernate_spawns++;
+			return 0;
+		}
 		mob_spawn(md);
 	}
 	return 0;
@@ -954,55 +963,140 @@ int mob_target(struct mob_data *md,struct block_list *bl,int dist)
 	return 0;
 }
 
+/// Number of entries in the per-tick cache of battle_check_target results (power of 2).
+#define MOB_TARGETCACHE_SIZE 512
+
+/// battle_check_target results of plain mobs against their search candidates.
+/// The result of a mob without master, special ai, guardian data or battleground
+/// only depends on the target and the map, so it's shared by all mobs of a class
+/// for the tick it was computed in.
+static struct {
+	unsigned int tick;
+	int class_;
+	int target_id;
+	short m;
+	short result;
+} mob_targetcache[MOB_TARGETCACHE_SIZE];
+
+/// Candidates gathered by mob_ai_sub_hard_activesearch.
+static struct mob_candidate {
+	struct block_list* bl;
+	int dist;
+	int order; // keeps the original search order among equally distant candidates
+}* mob_candidate = NULL;
+static int mob_candidate_count = 0;
+static int mob_candidate_max = 0;
+
+/// Cached battle_check_target(&md->bl, bl, BCT_ENEMY).
+static int mob_check_target(struct mob_data* md, struct block_list* bl, unsigned int tick)
+{
+	int i;
+
+	if( md->master_id || md->special_state.ai || md->guardian_data || md->bg_id )
+		return battle_check_target(&md->bl, bl, BCT_ENEMY);
+
+	i = (bl->id*31 + md->class_)&(MOB_TARGETCACHE_SIZE-1);
+	if( mob_targetcache[i].tick != tick || mob_targetcache[i].target_id != bl->id ||
+		mob_targetcache[i].class_ != md->class_ || mob_targetcache[i].m != bl->m )
+	{
+		mob_targetcache[i].tick = tick;
+		mob_targetcache[i].class_ = md->class_;
+		mob_targetcache[i].target_id = bl->id;
+		mob_targetcache[i].m = bl->m;
+		mob_targetcache[i].result = battle_check_target(&md->bl, bl, BCT_ENEMY);
+	}
+	return mob_targetcache[i].result;
+}
+
+/// qsort comparison function, orders candidates by distance, then by search order.
+static int mob_cmp_candidate(const void* a, const void* b)
+{
+	const struct mob_candidate* ca = (const struct mob_candidate*)a;
+	const struct mob_candidate* cb = (const struct mob_candidate*)b;
+	if( ca->dist != cb->dist )
+		return ( ca->dist < cb->dist ? -1 : 1 );
+	return ( ca->order < cb->order ? -1 : ca->order > cb->order ? 1 : 0 );
+}
+
 /*==========================================
- * The ?? routine of an active monster
+ * Gathers the possible targets of an active monster
  *------------------------------------------*/
 static int mob_ai_sub_hard_activesearch(struct block_list *bl,va_list ap)
 {
 	struct mob_data *md;
 	struct block_list **target;
 	int mode;
-	int dist;
 
 	nullpo_ret(bl);
 	md=va_arg(ap,struct mob_data *);
 	target= va_arg(ap,struct block_list**);
 	mode= va_arg(ap,int);
 
-	//If can't seek yet, not an enemy, or you can't attack it, skip.
-	if ((*target) == bl || !status_check_skilluse(&md->bl, bl, 0, 0))
+	// cheap checks only, the rest is done nearest-first by mob_ai_hard_activesearch
+	if ((*target) == bl || status_isdead(bl))
 		return 0;
 
 	if ((mode&MD_TARGETWEAK) && status_get_lv(bl) >= md->level-5)
 		return 0;
 
-	if(battle_check_target(&md->bl,bl,BCT_ENEMY)<=0)
-		return 0;
+	if( mob_candidate_count == mob_candidate_max )
+	{
+		mob_candidate_max += 64;
+		RECREATE(mob_candidate, struct mob_candidate, mob_candidate_max);
+	}
+	mob_candidate[mob_candidate_count].bl = bl;
+	mob_candidate[mob_candidate_count].dist = distance_bl(&md->bl, bl);
+	mob_candidate[mob_candidate_count].order = mob_candidate_count;
+	mob_candidate_count++;
+	return 1;
+}
+
+/*==========================================
+ * The search routine of an active monster.
+ * Candidates are checked from the nearest one outwards, and the search stops
+ * at the first valid one or once the remaining ones can't beat the current target.
+ *------------------------------------------*/
+static int mob_ai_hard_activesearch(struct mob_data* md, struct block_list** target, int range, int mode, unsigned int tick)
+{
+	int i;
+
+	mob_candidate_count = 0;
+	map_foreachinrange(mob_ai_sub_hard_activesearch, &md->bl, range, DEFAULT_ENEMY_TYPE(md), md, target, mode);
+	if( mob_candidate_count > 1 )
+		qsort(mob_candidate, mob_candidate_count, sizeof(mob_candidate[0]), mob_cmp_candidate);
 
-	switch (bl->type)
+	for( i = 0; i < mob_candidate_count; i++ )
 	{
-	case BL_PC:
-		if (((TBL_PC*)bl)->state.gangsterparadise &&
-			!(status_get_mode(&md->bl)&MD_BOSS))
-			return 0; //Gangster paradise protection.
-	default:
-		if (battle_config.hom_setting&0x4 &&
-			(*target) && (*target)->type == BL_HOM && bl->type != BL_HOM)
-			return 0; //For some reason Homun targets are never overriden.
-
-		dist = distance_bl(&md->bl, bl);
-		if(
-			((*target) == NULL || !check_distance_bl(&md->bl, *target, dist)) &&
-			battle_check_range(&md->bl,bl,md->db->range2)
-		) { //Pick closest target?
-			(*target) = bl;
-			md->target_id=bl->id;
-			md->min_chase= dist + md->db->range3;
-			if(md->min_chase>MAX_MINCHASE)
-				md->min_chase=MAX_MINCHASE;
-			return 1;
-		}
-		break;
+		struct block_list* bl = mob_candidate[i].bl;
+		int dist = mob_candidate[i].dist;
+
+		if( (*target) && check_distance_bl(&md->bl, *target, dist) )
+			break; // current target is at least as close as everything left
+
+		//If can't seek yet, not an enemy, or you can't attack it, skip.
+		if( !status_check_skilluse(&md->bl, bl, 0, 0) )
+			continue;
+
+		if( mob_check_target(md, bl, tick) <= 0 )
+			continue;
+
+		if( bl->type == BL_PC && ((TBL_PC*)bl)->state.gangsterparadise &&
+			!(status_get_mode(&md->bl)&MD_BOSS) )
+			continue; //Gangster paradise protection.
+
+		if( battle_config.hom_setting&0x4 &&
+			(*target) && (*target)->type == BL_HOM && bl->type != BL_HOM )
+			continue; //For some reason Homun targets are never overriden.
+
+		if( !battle_check_range(&md->bl,bl,md->db->range2) )
+			continue;
+
+		(*target) = bl;
+		md->target_id=bl->id;
+		md->min_chase= dist + md->db->range3;
+		if(md->min_chase>MAX_MINCHASE)
+			md->min_chase=MAX_MINCHASE;
+		return 1;
 	}
 	return 0;
 }
@@ -1312,13 +1406,13 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 		return false;
 
 	// Abnormalities
-	if((md->sc.opt1 > 0 && md->sc.opt1 != OPT1_STONEWAIT) || md->sc.data[SC_BLADESTOP])
+	if((md->sc.opt1 > 0 && md->sc.opt1 != OPT1_STONEWAIT) || sc_get(&md->sc,SC_BLADESTOP))
   	{	//Should reset targets.
 		md->target_id = md->attacked_id = 0;
 		return false;
 	}
 
-	if (md->sc.count && md->sc.data[SC_BLIND])
+	if (md->sc.count && sc_get(&md->sc,SC_BLIND))
 		view_range = 3;
 	else
 		view_range = md->db->range2;
@@ -1351,7 +1445,7 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 		{	//Rude attacked check.
 			if( !battle_check_range(&md->bl, tbl, md->status.rhw.range)
 			&&  ( //Can't attack back and can't reach back.
-			      (!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1)))
+			      (!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (sc_get(&md->sc,SC_SPIDERWEB) && sc_get(&md->sc,SC_SPIDERWEB)->val1)))
 			      || !mob_can_reach(md, tbl, md->min_chase, MSS_RUSH)
 			    )
 			&&  md->state.attacked_count++ >= RUDE_ATTACKED_COUNT
@@ -1372,7 +1466,7 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 				|| (battle_config.mob_ai&0x2 && !status_check_skilluse(&md->bl, abl, 0, 0)) // Cannot normal attack back to Attacker
 				|| (!battle_check_range(&md->bl, abl, md->status.rhw.range) // Not on Melee Range and ...
 				&& ( // Reach check
-					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1)))
+					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (sc_get(&md->sc,SC_SPIDERWEB) && sc_get(&md->sc,SC_SPIDERWEB)->val1)))
 					|| !mob_can_reach(md, abl, dist+md->db->range3, MSS_RUSH)
 				)
 				) )
@@ -1425,7 +1519,7 @@ static bool mob_ai_sub_hard(struct mob_data *md, unsigned int tick)
 
 	if ((!tbl && mode&MD_AGGRESSIVE) || md->state.skillstate == MSS_FOLLOW)
 	{
-		map_foreachinrange (mob_ai_sub_hard_activesearch, &md->bl, view_range, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
+		mob_ai_hard_activesearch(md, &tbl, view_range, mode, tick);
 	}
 	else
 	if (mode&MD_CHANGECHASE && (md->state.skillstate == MSS_RUSH || md->state.skillstate == MSS_FOLLOW))
@@ -1544,24 +1638,25 @@ static int mob_ai_sub_hard_timer(struct block_list *bl,va_list ap)
 {
 	struct mob_data *md = (struct mob_data*)bl;
 	unsigned int tick = va_arg(ap, unsigned int);
+
+	if( battle_config.mob_ai_stagger > 1 && (md->bl.id + mob_ai_round)%battle_config.mob_ai_stagger )
+		return 0; // not this mob's turn
+
 	if (mob_ai_sub_hard(md, tick)) 
 	{	//Hard AI triggered.
 		if(!md->state.spotted)
 			md->state.spotted = 1;
 		md->last_pcneartime = tick;
 	}
-	return 0;
+	return 1;
 }
 
 /*==========================================
- * Serious processing for mob in PC field of view (foreachclient)
+ * Marks the area around a PC for the serious processing (foreachclient)
  *------------------------------------------*/
 static int mob_ai_sub_foreachclient(struct map_session_data *sd,va_list ap)
 {
-	unsigned int tick;
-	tick=va_arg(ap,unsigned int);
-	map_foreachinrange(mob_ai_sub_hard_timer,&sd->bl, AREA_SIZE+ACTIVE_AI_RANGE, BL_MOB,tick);
-
+	map_activeblock_mark(&sd->bl, AREA_SIZE+ACTIVE_AI_RANGE);
 	return 0;
 }
 
@@ -1577,6 +1672,9 @@ static int mob_ai_sub_lazy(struct mob_data *md, va_list args)
 	if(md->bl.prev == NULL)
 		return 0;
 
+	if( map[md->bl.m].hibernate )
+		return 0; // parked until a player shows up
+
 	tick = va_arg(args,unsigned int);
 
 	if (battle_config.mob_ai&0x20 && map[md->bl.m].users>0)
@@ -1634,11 +1732,115 @@ static int mob_ai_sub_lazy(struct mob_data *md, va_list args)
 	return 0;
 }
 
+/*==========================================
+ * Parks a mob of a map that is going to sleep
+ *------------------------------------------*/
+static int mob_hibernate_sub(struct block_list *bl, va_list ap)
+{
+	struct mob_data *md = (struct mob_data*)bl;
+	unsigned int tick = va_arg(ap, unsigned int);
+
+	unit_stop_walking(&md->bl, 1);
+	unit_stop_attack(&md->bl);
+	mob_unlocktarget(md, tick);
+	return 1;
+}
+
+/*==========================================
+ * Puts the mobs of a map that has had no players for
+ * mob_hibernate_time to sleep. Sleeping mobs skip the lazy AI,
+ * respawns are held back until the map wakes up.
+ *------------------------------------------*/
+static void mob_hibernate(int m, unsigned int tick)
+{
+	int count;
+
+	map[m].hibernate = true;
+	map[m].hibernate_tick = tick;
+	map[m].hibernate_spawns = 0;
+	count = map_foreachinmap(mob_hibernate_sub, m, BL_MOB, tick);
+
+	if (battle_config.etc_log && count > 0)
+		ShowStatus("Map %s: Hibernating '"CL_WHITE"%d"CL_RESET"' mobs.\n", map[m].name, count);
+}
+
+/*==========================================
+ * Moves a woken up mob to where the lazy AI could have taken it
+ *------------------------------------------*/
+static int mob_wakeup_sub(struct block_list *bl, va_list ap)
+{
+	struct mob_data *md = (struct mob_data*)bl;
+	unsigned int tick = va_arg(ap, unsigned int);
+	struct spawn_data *spawn = md->spawn;
+	short x, y;
+
+	if( md->master_id || !spawn || !(status_get_mode(&md->bl)&MD_CANMOVE) || !unit_can_move(&md->bl) )
+		return 0;
+	if( !((spawn->x == 0 && spawn->y == 0) || spawn->xs || spawn->ys) )
+		return 0; // fixed spawn point, leave it where it stands
+
+	x = spawn->x;
+	y = spawn->y;
+	if( !map_search_freecell(NULL, md->bl.m, &x, &y, spawn->xs, spawn->ys, 1) )
+		return 0;
+
+	map_moveblock(&md->bl, x, y, tick);
+	md->next_walktime = tick+rand()%5000+1000;
+	return 1;
+}
+
+/*==========================================
+ * Spawns a mob that was held back while its map was hibernating
+ *------------------------------------------*/
+static int mob_wakeup_spawn(struct mob_data *md, va_list ap)
+{
+	int m = va_arg(ap, int);
+
+	if( md->state.hibernate_spawn && md->spawn && md->spawn->m == m && md->bl.prev == NULL )
+		mob_spawn(md);
+	return 0;
+}
+
+/*==========================================
+ * Catches up on a hibernating map when the first player enters it:
+ * mobs are scattered over their spawn areas as if they had been
+ * walking around, and held back respawns happen all at once.
+ *------------------------------------------*/
+void mob_wakeup(int m)
+{
+	unsigned int tick = gettick();
+	int count = 0;
+
+	if( !map[m].hibernate )
+		return;
+	map[m].hibernate = false;
+
+	if( DIFF_TICK(tick, map[m].hibernate_tick) >= 10*MIN_MOBTHINKTIME )
+		count = map_foreachinmap(mob_wakeup_sub, m, BL_MOB, tick);
+
+	if( map[m].hibernate_spawns > 0 )
+	{
+		map_foreachmob(mob_wakeup_spawn, m);
+		map[m].hibernate_spawns = 0;
+	}
+
+	if (battle_config.etc_log && count > 0)
+		ShowStatus("Map %s: Woke up, scattered '"CL_WHITE"%d"CL_RESET"' mobs.\n", map[m].name, count);
+}
+
 /*==========================================
  * Negligent processing for mob outside PC field of view   (interval timer function)
  *------------------------------------------*/
 static int mob_ai_lazy(int tid, unsigned int tick, int id, intptr_t data)
 {
+	int m;
+
+	if( battle_config.mob_hibernate_time )
+	{
+		for( m = 0; m < map_num; m++ )
+			if( !map[m].hibernate && map[m].users == 0 && DIFF_TICK(tick, map[m].idle_tick) >= battle_config.mob_hibernate_time )
+				mob_hibernate(m, tick);
+	}
 	map_foreachmob(mob_ai_sub_lazy,tick);
 	return 0;
 }
@@ -1648,11 +1850,19 @@ static int mob_ai_lazy(int tid, unsigned int tick, int id, intptr_t data)
  *------------------------------------------*/
 static int mob_ai_hard(int tid, unsigned int tick, int id, intptr_t data)
 {
+	int calls;
 
+	mob_ai_round++;
 	if (battle_config.mob_ai&0x20)
 		map_foreachmob(mob_ai_sub_lazy,tick);
 	else
-		map_foreachpc(mob_ai_sub_foreachclient,tick);
+	{// every mob around a PC thinks once, no matter how many PCs are around it
+		map_foreachpc(mob_ai_sub_foreachclient);
+		calls = map_foreachinactiveblock(mob_ai_sub_hard_timer, BL_MOB, tick);
+		mob_ai_calls += calls;
+		if( calls > mob_ai_calls_max )
+			mob_ai_calls_max = calls;
+	}
 
 	return 0;
 }
@@ -2062,11 +2272,11 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 		(!map[m].flag.nobaseexp || !map[m].flag.nojobexp) //Gives Exp
 	) { //Experience calculation.
 		int bonus = 100; //Bonus on top of your share (common to all attackers).
-		if (md->sc.data[SC_RICHMANKIM])
-			bonus += md->sc.data[SC_RICHMANKIM]->val2;
+		if (sc_get(&md->sc,SC_RICHMANKIM))
+			bonus += sc_get(&md->sc,SC_RICHMANKIM)->val2;
 		if(sd) {
 			temp = status_get_class(&md->bl);
-			if(sd->sc.data[SC_MIRACLE]) i = 2; //All mobs are Star Targets
+			if(sc_get(&sd->sc,SC_MIRACLE)) i = 2; //All mobs are Star Targets
 			else
 			ARR_FIND(0, MAX_PC_FEELHATE, i, temp == sd->hate_mob[i] &&
 				(battle_config.allow_skill_without_day || sg_info[i].day_func()));
@@ -2223,8 +2433,8 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 				drop_rate = (int)(drop_rate*1.25); // pk_mode increase drops if 20 level difference [Valaris]
 
 			// Increase drop rate if user has SC_ITEMBOOST
-			if (sd && sd->sc.data[SC_ITEMBOOST]) // now rig the drop rate to never be over 90% unless it is originally >90%.
-				drop_rate = max(drop_rate,cap_value((int)(0.5+drop_rate*(sd->sc.data[SC_ITEMBOOST]->val1)/100.),0,9000));
+			if (sd && sc_get(&sd->sc,SC_ITEMBOOST)) // now rig the drop rate to never be over 90% unless it is originally >90%.
+				drop_rate = max(drop_rate,cap_value((int)(0.5+drop_rate*(sc_get(&sd->sc,SC_ITEMBOOST)->val1)/100.),0,9000));
 
 			// attempt to drop the item
 			if (rand() % 10000 >= drop_rate)
@@ -2391,7 +2601,7 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 	  	//Emperium destroyed by script. Discard mvp character. [Skotlex]
 		mvp_sd = NULL;
 
-	rebirth =  ( md->sc.data[SC_KAIZEL] || (md->sc.data[SC_REBIRTH] && !md->state.rebirth) );
+	rebirth =  ( sc_get(&md->sc,SC_KAIZEL) || (sc_get(&md->sc,SC_REBIRTH) && !md->state.rebirth) );
 	if( !rebirth )
 	{ // Only trigger event on final kill
 		md->status.hp = 0; //So that npc_event invoked functions KNOW that mob is dead
@@ -2864,11 +3074,11 @@ int mob_getfriendstatus_sub(struct block_list *bl,va_list ap)
 	if( cond2==-1 ){
 		int j;
 		for(j=SC_COMMON_MIN;j<=SC_COMMON_MAX && !flag;j++){
-			if ((flag=(md->sc.data[j] != NULL))) //Once an effect was found, break out. [Skotlex]
+			if ((flag=(sc_get(&md->sc,j) != NULL))) //Once an effect was found, break out. [Skotlex]
 				break;
 		}
 	}else
-		flag=( md->sc.data[cond2] != NULL );
+		flag=( sc_get(&md->sc,cond2) != NULL );
 	if( flag^( cond1==MSC_FRIENDSTATUSOFF ) )
 		(*fr)=md;
 
@@ -2952,10 +3162,10 @@ int mobskill_use(struct mob_data *md, unsigned int tick, int event)
 						flag = 0;
 					} else if (ms[i].cond2 == -1) {
 						for (j = SC_COMMON_MIN; j <= SC_COMMON_MAX; j++)
-							if ((flag = (md->sc.data[j]!=NULL)) != 0)
+							if ((flag = (sc_get(&md->sc,j)!=NULL)) != 0)
 								break;
 					} else {
-						flag = (md->sc.data[ms[i].cond2]!=NULL);
+						flag = (sc_get(&md->sc,ms[i].cond2)!=NULL);
 					}
 					flag ^= (ms[i].cond1 == MSC_MYSTATUSOFF); break;
 				case MSC_FRIENDHPLTMAXRATE:	// friend HP < maxhp%
@@ -4344,6 +4554,8 @@ int do_init_mob(void)
 int do_final_mob(void)
 {
 	int i;
+	if( mob_ai_round )
+		ShowInfo("Mob AI: %u rounds, %u mobs visited per round on average (%u at most).\n", mob_ai_round, mob_ai_calls/mob_ai_round, mob_ai_calls_max);
 	if (mob_dummy)
 	{
 		aFree(mob_dummy);
@@ -4365,6 +4577,12 @@ int do_final_mob(void)
 			mob_chat_db[i] = NULL;
 		}
 	}
+	if (mob_candidate)
+	{
+		aFree(mob_candidate);
+		mob_candidate = NULL;
+		mob_candidate_count = mob_candidate_max = 0;
+	}
 	ers_destroy(item_drop_ers);
 	ers_destroy(item_drop_list_ers);
 	return 0;
@@ -8,16 +8,18 @@
 #include "map.h"
 #include "battle.h"
 #include "path.h"
+#include "unit.h" // dirx, diry
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 
-#define MAX_HEAP 150
+#define MAX_HEAP 150 // open set size at which path_search gives up
 
-struct tmp_path { short x,y,dist,before,cost,flag;};
-#define calc_index(x,y) (((x)+(y)*MAX_WALKPATH) & (MAX_WALKPATH*MAX_WALKPATH-1))
+struct tmp_path { short x,y,dist,before,cost,flag; int heap_pos; unsigned int gen; };
+#define MAX_TMP_PATH (MAX_WALKPATH*MAX_WALKPATH)
+#define calc_index(x,y) (((x)+(y)*MAX_WALKPATH) & (MAX_TMP_PATH-1))
 
 const char walk_choices [3][3] =
 {
@@ -26,71 +28,87 @@ const char walk_choices [3][3] =
 	{3,4,5},
 };
 
+/// Search workspace, reused between path_search calls.
+/// Entries whose gen differs from path_gen are unused, so a new search only has to bump path_gen.
+static struct tmp_path tp[MAX_TMP_PATH];
+static unsigned int path_gen = 0;
+
+/// Open set, a binary heap of tp indexes ordered by cost.
+/// tp[].heap_pos is the position of each entry in it (-1 if not in the heap).
+/// Every tp entry is in it at most once, so it can't outgrow the workspace.
+static int heap[MAX_TMP_PATH];
+static int heap_len;
+
 /*==========================================
- * heap push (helper function)
+ * heap sift up (helper function)
  *------------------------------------------*/
-static void push_heap_path(int *heap,struct tmp_path *tp,int index)
+static void sift_up_heap_path(int h)
 {
-	int i,h;
+	int index = heap[h];
 
-	h = heap[0];
-	heap[0]++;
+	while( h > 0 && tp[index].cost < tp[heap[(h-1)/2]].cost )
+	{
+		heap[h] = heap[(h-1)/2];
+		tp[heap[h]].heap_pos = h;
+		h = (h-1)/2;
+	}
 
-	for( i = (h-1)/2; h > 0 && tp[index].cost < tp[heap[i+1]].cost; i = (h-1)/2 )
-		heap[h+1] = heap[i+1], h = i;
+	heap[h] = index;
+	tp[index].heap_pos = h;
+}
 
-	heap[h+1] = index;
+/*==========================================
+ * heap push (helper function)
+ *------------------------------------------*/
+static void push_heap_path(int index)
+{
+	heap[heap_len] = index;
+	sift_up_heap_path(heap_len++);
 }
 
 /*==========================================
  * heap update (helper function)
  * cost̂ō̕ֈړ
  *------------------------------------------*/
-static void update_heap_path(int *heap,struct tmp_path *tp,int index)
+static void update_heap_path(int index)
 {
-	int i,h;
-
-	ARR_FIND( 0, heap[0], h, heap[h+1] == index );
-	if( h == heap[0] )
+	if( tp[index].heap_pos < 0 )
 	{
 		ShowError("update_heap_path bug\n");
-		exit(EXIT_FAILURE);
+		push_heap_path(index);
+		return;
 	}
 
-	for( i = (h-1)/2; h > 0 && tp[index].cost < tp[heap[i+1]].cost; i = (h-1)/2 )
-		heap[h+1] = heap[i+1], h = i;
-
-	heap[h+1] = index;
+	sift_up_heap_path(tp[index].heap_pos);
 }
 
 /*==========================================
  * heap pop (helper function)
  *------------------------------------------*/
-static int pop_heap_path(int *heap,struct tmp_path *tp)
+static int pop_heap_path(void)
 {
-	int i,h,k;
-	int ret,last;
+	int h, k, ret, last;
 
-	if( heap[0] <= 0 )
+	if( heap_len <= 0 )
 		return -1;
-	ret = heap[1];
-	last = heap[heap[0]];
-	heap[0]--;
+	ret = heap[0];
+	tp[ret].heap_pos = -1;
+	last = heap[--heap_len];
+	if( heap_len == 0 )
+		return ret;
 
-	for( h = 0, k = 2; k < heap[0]; k = k*2+2 )
+	for( h = 0, k = 1; k < heap_len; h = k, k = k*2+1 )
 	{
-		if( tp[heap[k+1]].cost > tp[heap[k]].cost )
-			k--;
-		heap[h+1] = heap[k+1], h = k;
+		if( k+1 < heap_len && tp[heap[k+1]].cost < tp[heap[k]].cost )
+			k++;
+		if( tp[heap[k]].cost >= tp[last].cost )
+			break;
+		heap[h] = heap[k];
+		tp[heap[h]].heap_pos = h;
 	}
 
-	if( k == heap[0] )
-		heap[h+1] = heap[k], h = k-1;
-
-	for( i = (h-1)/2; h > 0 && tp[heap[i+1]].cost > tp[last].cost; i = (h-1)/2 )
-		heap[h+1] = heap[i+1], h = i;
-
-	heap[h+1]=last;
+	heap[h] = last;
+	tp[last].heap_pos = h;
 
 	return ret;
 }
@@ -108,13 +126,13 @@ static int calc_cost(struct tmp_path *p,int x1,int y1)
 /*==========================================
  * attach/adjust path if neccessary
  *------------------------------------------*/
-static int add_path(int *heap,struct tmp_path *tp,int x,int y,int dist,int before,int cost)
+static int add_path(int x,int y,int dist,int before,int cost)
 {
 	int i;
 
 	i = calc_index(x,y);
 
-	if( tp[i].x == x && tp[i].y == y )
+	if( tp[i].gen == path_gen && tp[i].x == x && tp[i].y == y )
 	{
 		if( tp[i].dist > dist )
 		{
@@ -122,24 +140,25 @@ static int add_path(int *heap,struct tmp_path *tp,int x,int y,int dist,int befor
 			tp[i].before = before;
 			tp[i].cost = cost;
 			if( tp[i].flag )
-				push_heap_path(heap,tp,i);
+				push_heap_path(i);
 			else
-				update_heap_path(heap,tp,i);
+				update_heap_path(i);
 			tp[i].flag = 0;
 		}
 		return 0;
 	}
 
-	if( tp[i].x || tp[i].y )
+	if( tp[i].gen == path_gen )
 		return 1;
 
+	tp[i].gen = path_gen;
 	tp[i].x = x;
 	tp[i].y = y;
 	tp[i].dist = dist;
 	tp[i].before = before;
 	tp[i].cost = cost;
 	tp[i].flag = 0;
-	push_heap_path(heap,tp,i);
+	push_heap_path(i);
 
 	return 0;
 }
@@ -272,8 +291,6 @@ bool path_search_long(struct shootpath_data *spd,int m,int x0,int y0,int x1,int
  *------------------------------------------*/
 bool path_search(struct walkpath_data *wpd,int m,int x0,int y0,int x1,int y1,int flag,cell_chk cell)
 {
-	int heap[MAX_HEAP+1];
-	struct tmp_path tp[MAX_WALKPATH*MAX_WALKPATH];
 	register int i,j,len,x,y,dx,dy;
 	int rp,xs,ys;
 	struct map_data *md;
@@ -331,17 +348,22 @@ bool path_search(struct walkpath_data *wpd,int m,int x0,int y0,int x1,int y1,int
 	if( flag&1 )
 		return false;
 
-	memset(tp,0,sizeof(tp));
+	if( ++path_gen == 0 )
+	{// generation counter wrapped, really clear the workspace this time
+		memset(tp,0,sizeof(tp));
+		path_gen = 1;
+	}
 
 	i=calc_index(x0,y0);
+	tp[i].gen=path_gen;
 	tp[i].x=x0;
 	tp[i].y=y0;
 	tp[i].dist=0;
 	tp[i].before=0;
 	tp[i].cost=calc_cost(&tp[i],x1,y1);
 	tp[i].flag=0;
-	heap[0]=0;
-	push_heap_path(heap,tp,calc_index(x0,y0));
+	heap_len=0;
+	push_heap_path(calc_index(x0,y0));
 	xs = md->xs-1; // 炩߂PZĂ
 	ys = md->ys-1;
 
@@ -349,9 +371,9 @@ bool path_search(struct walkpath_data *wpd,int m,int x0,int y0,int x1,int y1,int
 	{
 		int e=0,f=0,dist,cost,dc[4]={0,0,0,0};
 
-		if(heap[0]==0)
+		if(heap_len==0)
 			return false;
-		rp   = pop_heap_path(heap,tp);
+		rp   = pop_heap_path();
 		x    = tp[rp].x;
 		y    = tp[rp].y;
 		dist = tp[rp].dist + 10;
@@ -367,30 +389,30 @@ bool path_search(struct walkpath_data *wpd,int m,int x0,int y0,int x1,int y1,int
 
 		if(y < ys && !map_getcellp(md,x  ,y+1,cell)) {
 			f |= 1; dc[0] = (y >= y1 ? 20 : 0);
-			e+=add_path(heap,tp,x  ,y+1,dist,rp,cost+dc[0]); // (x,   y+1)
+			e+=add_path(x  ,y+1,dist,rp,cost+dc[0]); // (x,   y+1)
 		}
 		if(x > 0  && !map_getcellp(md,x-1,y  ,cell)) {
 			f |= 2; dc[1] = (x <= x1 ? 20 : 0);
-			e+=add_path(heap,tp,x-1,y  ,dist,rp,cost+dc[1]); // (x-1, y  )
+			e+=add_path(x-1,y  ,dist,rp,cost+dc[1]); // (x-1, y  )
 		}
 		if(y > 0  && !map_getcellp(md,x  ,y-1,cell)) {
 			f |= 4; dc[2] = (y <= y1 ? 20 : 0);
-			e+=add_path(heap,tp,x  ,y-1,dist,rp,cost+dc[2]); // (x  , y-1)
+			e+=add_path(x  ,y-1,dist,rp,cost+dc[2]); // (x  , y-1)
 		}
 		if(x < xs && !map_getcellp(md,x+1,y  ,cell)) {
 			f |= 8; dc[3] = (x >= x1 ? 20 : 0);
-			e+=add_path(heap,tp,x+1,y  ,dist,rp,cost+dc[3]); // (x+1, y  )
+			e+=add_path(x+1,y  ,dist,rp,cost+dc[3]); // (x+1, y  )
 		}
 		if( (f & (2+1)) == (2+1) && !map_getcellp(md,x-1,y+1,cell))
-			e+=add_path(heap,tp,x-1,y+1,dist+4,rp,cost+dc[1]+dc[0]-6);		// (x-1, y+1)
+			e+=add_path(x-1,y+1,dist+4,rp,cost+dc[1]+dc[0]-6);		// (x-1, y+1)
 		if( (f & (2+4)) == (2+4) && !map_getcellp(md,x-1,y-1,cell))
-			e+=add_path(heap,tp,x-1,y-1,dist+4,rp,cost+dc[1]+dc[2]-6);		// (x-1, y-1)
+			e+=add_path(x-1,y-1,dist+4,rp,cost+dc[1]+dc[2]-6);		// (x-1, y-1)
 		if( (f & (8+4)) == (8+4) && !map_getcellp(md,x+1,y-1,cell))
-			e+=add_path(heap,tp,x+1,y-1,dist+4,rp,cost+dc[3]+dc[2]-6);		// (x+1, y-1)
+			e+=add_path(x+1,y-1,dist+4,rp,cost+dc[3]+dc[2]-6);		// (x+1, y-1)
 		if( (f & (8+1)) == (8+1) && !map_getcellp(md,x+1,y+1,cell))
-			e+=add_path(heap,tp,x+1,y+1,dist+4,rp,cost+dc[3]+dc[0]-6);		// (x+1, y+1)
+			e+=add_path(x+1,y+1,dist+4,rp,cost+dc[3]+dc[0]-6);		// (x+1, y+1)
 		tp[rp].flag=1;
-		if(e || heap[0]>=MAX_HEAP-5)
+		if(e || heap_len>=MAX_HEAP-5)
 			return false;
 	}
 
@@ -421,6 +443,277 @@ bool path_search(struct walkpath_data *wpd,int m,int x0,int y0,int x1,int y1,int
 }
 
 
+#ifndef CELL_NOSTACK
+/*==========================================
+ * Flow fields (shared path searches)
+ *
+ * When several units chase the same target they all search for a path to
+ * the same cell. Instead of running path_search for each of them, the
+ * distances from the cells around such a goal to the goal are computed
+ * (dijkstra, outwards from the goal) and the path of each chaser is read
+ * off by walking downhill.
+ * The distances are only computed as far as the units asking for them
+ * need, and resumed when a unit further away asks, so chasers close to
+ * their target stay cheap. Only one field can be resumed at a time; a
+ * field left unfinished is started over when it needs more.
+ * A field covers FLOW_RADIUS cells around its goal; units further away, and
+ * goals only requested once, use a plain path_search.
+ * Fields are dropped when a walkable flag of their map changes (path_flow_clear).
+ *------------------------------------------*/
+#define FLOW_RADIUS (MAX_WALKPATH/2)
+#define FLOW_SIZE (FLOW_RADIUS*2+1)
+#define FLOW_WIDTH (FLOW_SIZE+2) // the area has a border of blocked cells
+#define FLOW_CELLS (FLOW_WIDTH*FLOW_WIDTH)
+#define MAX_FLOW_CACHE 32
+#define FLOW_MIN_REQUESTS 2
+#define FLOW_UNREACHABLE 0xFFFF
+#define FLOW_MAX_DIST (MAX_WALKPATH*14) // no walkpath is longer than this
+
+struct flow_field {
+	int m; // map of the goal
+	short x, y; // goal cell
+	cell_chk cell; // type of obstruction the field was built for
+	unsigned int last_use; // for replacement (flow_clock value, 0 = unused)
+	unsigned short requests; // searches made for this goal
+	int settled; // distances up to this value are final (-1 = not started)
+	bool complete; // all distances are final
+	unsigned short dist[FLOW_CELLS]; // cost to reach the goal (10 straight, 14 diagonal)
+	bool pass[FLOW_CELLS]; // cell can be entered
+};
+
+static struct flow_field flow_cache[MAX_FLOW_CACHE];
+static unsigned int flow_clock = 0;
+static const int flow_offset[8] = { // index offset of each direction (dirx/diry)
+	FLOW_WIDTH, FLOW_WIDTH-1, -1, -FLOW_WIDTH-1, -FLOW_WIDTH, -FLOW_WIDTH+1, 1, FLOW_WIDTH+1
+};
+
+// dijkstra queue of the field being computed, one bucket per distance modulo
+// the largest step cost + 1 (a bucket only ever holds one distance value, so
+// each cell is in it at most once)
+#define FLOW_BUCKETS 15
+static short flow_bucket[FLOW_BUCKETS][FLOW_CELLS];
+static int flow_bucket_len[FLOW_BUCKETS];
+static int flow_queued;
+static struct flow_field* flow_owner = NULL;
+
+#define flow_index(f,cx,cy) (((cy)-(f)->y+FLOW_RADIUS+1)*FLOW_WIDTH + ((cx)-(f)->x+FLOW_RADIUS+1))
+
+/// Whether a step from cell i in direction dir is allowed, same rules as path_search.
+static bool flow_canstep(struct flow_field* f, int i, int dir)
+{
+	if( !f->pass[i+flow_offset[dir]] )
+		return false;
+	if( (dir&1) && (!f->pass[i+flow_offset[(dir+1)&7]] || !f->pass[i+flow_offset[(dir+7)&7]]) )
+		return false; // diagonal step, both adjacent cells must be free
+	return true;
+}
+
+/// (Re)starts computing the distances of a field.
+static void flow_start(struct flow_field* f, struct map_data* md)
+{
+	int x, y, i;
+
+	memset(f->pass, 0, sizeof(f->pass));
+	for( y = max(f->y-FLOW_RADIUS, 0); y <= f->y+FLOW_RADIUS && y < md->ys; y++ )
+		for( x = max(f->x-FLOW_RADIUS, 0); x <= f->x+FLOW_RADIUS && x < md->xs; x++ )
+			f->pass[flow_index(f,x,y)] = !map_getcellp(md,x,y,f->cell);
+
+	for( i = 0; i < FLOW_CELLS; i++ )
+		f->dist[i] = FLOW_UNREACHABLE;
+	memset(flow_bucket_len, 0, sizeof(flow_bucket_len));
+
+	i = flow_index(f,f->x,f->y);
+	f->dist[i] = 0;
+	flow_bucket[0][flow_bucket_len[0]++] = i;
+	flow_queued = 1;
+	f->settled = -1;
+	f->complete = false;
+	flow_owner = f;
+}
+
+/// Finalizes the cells of the next distance value.
+static void flow_step(struct flow_field* f)
+{
+	int d = f->settled + 1;
+	int b = d%FLOW_BUCKETS;
+
+	while( flow_bucket_len[b] > 0 )
+	{
+		int i = flow_bucket[b][--flow_bucket_len[b]];
+		int dir;
+
+		flow_queued--;
+		if( f->dist[i] != d )
+			continue; // outdated entry
+
+		for( dir = 0; dir < 8; dir++ )
+		{
+			int ni = i + flow_offset[dir];
+			int nd = d + ( (dir&1) ? 14 : 10 );
+
+			// walking the reverse step ni->i checks the same cells
+			if( f->dist[ni] <= nd || !flow_canstep(f,i,dir) )
+				continue;
+			f->dist[ni] = nd;
+			flow_bucket[nd%FLOW_BUCKETS][flow_bucket_len[nd%FLOW_BUCKETS]++] = ni;
+			flow_queued++;
+		}
+	}
+
+	f->settled = d;
+	if( flow_queued == 0 )
+	{
+		f->complete = true;
+		flow_owner = NULL;
+	}
+}
+
+/// Returns the best direction to step in from cell i, or -1 if the goal can't be reached from there.
+/// Computes more of the field if the distances around i aren't final yet.
+static int flow_direction(struct flow_field* f, int i)
+{
+	for(;;)
+	{
+		int dir, best = -1, best_cost = FLOW_UNREACHABLE;
+
+		for( dir = 0; dir < 8; dir++ )
+		{
+			int cost = f->dist[i+flow_offset[dir]];
+			if( cost == FLOW_UNREACHABLE || !flow_canstep(f,i,dir) )
+				continue;
+			cost += (dir&1) ? 14 : 10;
+			if( cost < best_cost )
+				best = dir, best_cost = cost;
+		}
+
+		// a neighbour that isn't final yet is more than 'settled' away, so
+		// stepping to it would cost more than 'settled'+10
+		if( f->complete || (best != -1 && best_cost - 10 <= f->settled) )
+			return best;
+		if( f->settled >= FLOW_MAX_DIST )
+			return -1; // too far to be walked anyway
+
+		if( flow_owner != f )
+			flow_start(f, &map[f->m]);
+		flow_step(f);
+	}
+}
+
+/// Finds (or allocates) the cache entry for the given goal.
+/// Returns NULL if the goal isn't requested often enough to share the search.
+static struct flow_field* flow_get(int m, int x, int y, cell_chk cell)
+{
+	struct flow_field* f;
+	int i, oldest = 0;
+
+	for( i = 0; i < MAX_FLOW_CACHE; i++ )
+	{
+		f = &flow_cache[i];
+		if( f->m == m && f->x == x && f->y == y && f->cell == cell && f->last_use )
+			break;
+		if( flow_cache[i].last_use < flow_cache[oldest].last_use )
+			oldest = i;
+	}
+
+	if( i == MAX_FLOW_CACHE )
+	{// first request for this goal, just start counting
+		f = &flow_cache[oldest];
+		if( flow_owner == f )
+			flow_owner = NULL;
+		f->m = m;
+		f->x = x;
+		f->y = y;
+		f->cell = cell;
+		f->requests = 0;
+		f->settled = -1;
+		f->complete = false;
+	}
+
+	f->last_use = ++flow_clock;
+	if( f->requests < FLOW_MIN_REQUESTS && ++f->requests < FLOW_MIN_REQUESTS )
+		return NULL;
+	return f;
+}
+
+/// Drops all flow fields of a map (m = -1 for all maps).
+/// Must be called whenever the walkable state of a cell changes.
+void path_flow_clear(int m)
+{
+	int i;
+
+	for( i = 0; i < MAX_FLOW_CACHE; i++ )
+	{
+		if( m != -1 && flow_cache[i].m != m )
+			continue;
+		flow_cache[i].last_use = 0;
+		if( flow_owner == &flow_cache[i] )
+			flow_owner = NULL;
+	}
+}
+
+/*==========================================
+ * path search (x0,y0)->(x1,y1) for units chasing a common target
+ * Same as a hard path_search, but the search is shared with other units
+ * heading for the same cell (see flow fields above).
+ *------------------------------------------*/
+bool path_search_flow(struct walkpath_data *wpd,int m,int x0,int y0,int x1,int y1,cell_chk cell)
+{
+	struct flow_field* f;
+	struct map_data* md;
+	struct walkpath_data s_wpd;
+	int i, len;
+
+	if( wpd == NULL )
+		wpd = &s_wpd; // use dummy output variable
+
+	if( !map[m].cell )
+		return false;
+	md = &map[m];
+
+	if( path_search(wpd,m,x0,y0,x1,y1,1,cell) )
+		return true; // direct path, no need for anything else
+
+	if( abs(x1-x0) > FLOW_RADIUS || abs(y1-y0) > FLOW_RADIUS
+	||  x1 < 0 || x1 >= md->xs || y1 < 0 || y1 >= md->ys || map_getcellp(md,x1,y1,cell) )
+		return path_search(wpd,m,x0,y0,x1,y1,0,cell);
+
+	f = flow_get(m,x1,y1,cell);
+	if( f == NULL )
+		return path_search(wpd,m,x0,y0,x1,y1,0,cell);
+	if( f->settled < 0 && flow_owner != f )
+		flow_start(f, md);
+
+	// walk downhill
+	i = flow_index(f,x0,y0);
+	for( len = 0; f->dist[i] != 0 && len < MAX_WALKPATH; len++ )
+	{
+		int dir = flow_direction(f,i);
+		if( dir == -1 )
+			break;
+		wpd->path[len] = dir;
+		i += flow_offset[dir];
+	}
+
+	if( f->dist[i] != 0 )
+		return false; // not reachable within the field's area, or too far
+
+	wpd->path_len = len;
+	wpd->path_pos = 0;
+	return true;
+}
+#else
+/// Cells are blocked by units with CELL_NOSTACK, so searches can't be shared.
+void path_flow_clear(int m)
+{
+}
+
+bool path_search_flow(struct walkpath_data *wpd,int m,int x0,int y0,int x1,int y1,cell_chk cell)
+{
+	return path_search(wpd,m,x0,y0,x1,y1,0,cell);
+}
+#endif
+
+
 //Distance functions, taken from http://www.flipcode.com/articles/article_fastdistance.shtml
 int check_distance(int dx, int dy, int distance)
 {
@@ -525,7 +525,7 @@ int pc_makesavestatus(struct map_session_data *sd)
 	//status change load/saving. [Skotlex]
 	sd->status.option = sd->sc.option&(OPTION_CART|OPTION_FALCON|OPTION_RIDING);
 		
-	if (sd->sc.data[SC_JAILED])
+	if (sc_get(&sd->sc,SC_JAILED))
 	{	//When Jailed, do not move last point.
 		if(pc_isdead(sd)){
 			pc_setrestartvalue(sd,0);
@@ -865,16 +865,16 @@ int pc_isequip(struct map_session_data *sd,int n)
 
 	if (sd->sc.count) {
 			
-		if(item->equip & EQP_ARMS && item->type == IT_WEAPON && sd->sc.data[SC_STRIPWEAPON]) // Also works with left-hand weapons [DracoRPG]
+		if(item->equip & EQP_ARMS && item->type == IT_WEAPON && sc_get(&sd->sc,SC_STRIPWEAPON)) // Also works with left-hand weapons [DracoRPG]
 			return 0;
-		if(item->equip & EQP_SHIELD && item->type == IT_ARMOR && sd->sc.data[SC_STRIPSHIELD])
+		if(item->equip & EQP_SHIELD && item->type == IT_ARMOR && sc_get(&sd->sc,SC_STRIPSHIELD))
 			return 0;
-		if(item->equip & EQP_ARMOR && sd->sc.data[SC_STRIPARMOR])
+		if(item->equip & EQP_ARMOR && sc_get(&sd->sc,SC_STRIPARMOR))
 			return 0;
-		if(item->equip & EQP_HELM && sd->sc.data[SC_STRIPHELM])
+		if(item->equip & EQP_HELM && sc_get(&sd->sc,SC_STRIPHELM))
 			return 0;
 
-		if (sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SUPERNOVICE) {
+		if (sc_get(&sd->sc,SC_SPIRIT) && sc_get(&sd->sc,SC_SPIRIT)->val2 == SL_SUPERNOVICE) {
 			//Spirit of Super Novice equip bonuses. [Skotlex]
 			if (sd->status.base_level > 90 && item->equip & EQP_HELM)
 				return 1; //Can equip all helms
@@ -1251,7 +1251,7 @@ int pc_calc_skilltree(struct map_session_data *sd)
 			sd->status.skill[i].flag = SKILL_FLAG_PERMANENT;
 		}
 
-		if( sd->sc.count && sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_BARDDANCER && i >= DC_HUMMING && i<= DC_SERVICEFORYOU )
+		if( sd->sc.count && sc_get(&sd->sc,SC_SPIRIT) && sc_get(&sd->sc,SC_SPIRIT)->val2 == SL_BARDDANCER && i >= DC_HUMMING && i<= DC_SERVICEFORYOU )
 		{ //Enable Bard/Dancer spirit linked skills.
 			if( sd->status.sex )
 			{ //Link dancer skills to bard.
@@ -1323,7 +1323,7 @@ int pc_calc_skilltree(struct map_session_data *sd)
 				if(!sd->status.skill[id].lv && (
 					(inf2&INF2_QUEST_SKILL && !battle_config.quest_skill_learn) ||
 					inf2&INF2_WEDDING_SKILL ||
-					(inf2&INF2_SPIRIT_SKILL && !sd->sc.data[SC_SPIRIT])
+					(inf2&INF2_SPIRIT_SKILL && !sc_get(&sd->sc,SC_SPIRIT))
 				))
 					continue; //Cannot be learned via normal means. Note this check DOES allows raising already known skills.
 
@@ -1422,7 +1422,7 @@ static void pc_check_skilltree(struct map_session_data *sd, int skill)
 			if( !sd->status.skill[id].lv && (
 				(j&INF2_QUEST_SKILL && !battle_config.quest_skill_learn) ||
 				j&INF2_WEDDING_SKILL ||
-				(j&INF2_SPIRIT_SKILL && !sd->sc.data[SC_SPIRIT])
+				(j&INF2_SPIRIT_SKILL && !sc_get(&sd->sc,SC_SPIRIT))
 			) )
 				continue; //Cannot be learned via normal means.
 
@@ -1495,7 +1495,7 @@ int pc_updateweightstatus(struct map_session_data *sd)
 
 	nullpo_retr(1, sd);
 
-	old_overweight = (sd->sc.data[SC_WEIGHT90]) ? 2 : (sd->sc.data[SC_WEIGHT50]) ? 1 : 0;
+	old_overweight = (sc_get(&sd->sc,SC_WEIGHT90)) ? 2 : (sc_get(&sd->sc,SC_WEIGHT50)) ? 1 : 0;
 	new_overweight = (pc_is90overweight(sd)) ? 2 : (pc_is50overweight(sd)) ? 1 : 0;
 
 	if( old_overweight == new_overweight )
@@ -3738,7 +3738,7 @@ int pc_isUseitem(struct map_session_data *sd,int n)
 			break;
 		case 12210: // Bubble Gum
 		case 12264: // Comp Bubble Gum
-			if( sd->sc.data[SC_ITEMBOOST] )
+			if( sc_get(&sd->sc,SC_ITEMBOOST) )
 				return 0;
 			break;
 		case 12208: // Battle Manual
@@ -3748,11 +3748,11 @@ int pc_isUseitem(struct map_session_data *sd,int n)
 		case 14532: // Battle_Manual25
 		case 14533: // Battle_Manual100
 		case 14545: // Battle_Manual300
-			if( sd->sc.data[SC_EXPBOOST] )
+			if( sc_get(&sd->sc,SC_EXPBOOST) )
 				return 0;
 			break;
 		case 14592: // JOB_Battle_Manual
-			if( sd->sc.data[SC_JEXPBOOST] )
+			if( sc_get(&sd->sc,SC_JEXPBOOST) )
 				return 0;
 			break;
 
@@ -3765,7 +3765,7 @@ int pc_isUseitem(struct map_session_data *sd,int n)
 		case 12243: // Mercenary's Berserk Potion
 			if( sd->md == NULL || sd->md->db == NULL )
 				return 0;
-			if( sd->md->sc.data[SC_BERSERK] )
+			if( sc_get(&sd->md->sc,SC_BERSERK) )
 				return 0;
 			if( nameid == 12242 && sd->md->db->lv < 40 )
 				return 0;
@@ -3845,11 +3845,11 @@ int pc_useitem(struct map_session_data *sd,int n)
 		return 0;
 
 	if( sd->sc.count && (
-		sd->sc.data[SC_BERSERK] ||
-		(sd->sc.data[SC_GRAVITATION] && sd->sc.data[SC_GRAVITATION]->val3 == BCT_SELF) ||
-		sd->sc.data[SC_TRICKDEAD] ||
-		sd->sc.data[SC_HIDING] ||
-		(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOITEM)
+		sc_get(&sd->sc,SC_BERSERK) ||
+		(sc_get(&sd->sc,SC_GRAVITATION) && sc_get(&sd->sc,SC_GRAVITATION)->val3 == BCT_SELF) ||
+		sc_get(&sd->sc,SC_TRICKDEAD) ||
+		sc_get(&sd->sc,SC_HIDING) ||
+		(sc_get(&sd->sc,SC_NOCHAT) && sc_get(&sd->sc,SC_NOCHAT)->val1&MANNER_NOITEM)
 	))
 		return 0;
 
@@ -3912,7 +3912,7 @@ int pc_useitem(struct map_session_data *sd,int n)
 		pc_famerank(MakeDWord(sd->status.inventory[n].card[2],sd->status.inventory[n].card[3]), MAPID_ALCHEMIST))
 	{
 	    potion_flag = 2; // Famous player's potions have 50% more efficiency
-		 if (sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_ROGUE)
+		 if (sc_get(&sd->sc,SC_SPIRIT) && sc_get(&sd->sc,SC_SPIRIT)->val2 == SL_ROGUE)
 			 potion_flag = 3; //Even more effective potions.
 	}
 
@@ -4188,7 +4188,7 @@ int pc_steal_coin(struct map_session_data *sd,struct block_list *target)
 		return 0;
 
 	md = (TBL_MOB*)target;
-	if( md->state.steal_coin_flag || md->sc.data[SC_STONE] || md->sc.data[SC_FREEZE] || md->status.mode&MD_BOSS )
+	if( md->state.steal_coin_flag || sc_get(&md->sc,SC_STONE) || sc_get(&md->sc,SC_FREEZE) || md->status.mode&MD_BOSS )
 		return 0;
 
 	if( (md->class_ >= 1324 && md->class_ < 1364) || (md->class_ >= 1938 && md->class_ < 1946) )
@@ -4256,7 +4256,7 @@ int pc_setpos(struct map_session_data* sd, unsigned short mapindex, int x, int y
 		sd->state.pmap = sd->bl.m;
 		if (sd->sc.count)
 		{ // Cancel some map related stuff.
-			if (sd->sc.data[SC_JAILED])
+			if (sc_get(&sd->sc,SC_JAILED))
 				return 1; //You may not get out!
 			status_change_end(&sd->bl, SC_BOSSMAPINFO, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_WARM, INVALID_TIMER);
@@ -4264,11 +4264,9 @@ int pc_setpos(struct map_session_data* sd, unsigned short mapindex, int x, int y
 			status_change_end(&sd->bl, SC_MOON_COMFORT, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_STAR_COMFORT, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_MIRACLE, INVALID_TIMER);
-			if (sd->sc.data[SC_KNOWLEDGE]) {
-				struct status_change_entry *sce = sd->sc.data[SC_KNOWLEDGE];
-				if (sce->timer != INVALID_TIMER)
-					delete_timer(sce->timer, status_change_timer);
-				sce->timer = add_timer(gettick() + skill_get_time(SG_KNOWLEDGE, sce->val1), status_change_timer, sd->bl.id, SC_KNOWLEDGE);
+			if (sc_get(&sd->sc,SC_KNOWLEDGE)) {
+				struct status_change_entry *sce = sc_get(&sd->sc,SC_KNOWLEDGE);
+				status_change_settimer(&sd->bl, SC_KNOWLEDGE, gettick() + skill_get_time(SG_KNOWLEDGE, sce->val1));
 			}
 		}
 		if (battle_config.clear_unit_onwarp&BL_PC)
@@ -4550,18 +4548,18 @@ int pc_checkallowskill(struct map_session_data *sd)
 	
 	for (i = 0; i < ARRAYLENGTH(scw_list); i++)
 	{	// Skills requiring specific weapon types
-		if(sd->sc.data[scw_list[i]] &&
+		if(sc_get(&sd->sc,scw_list[i]) &&
 			!pc_check_weapontype(sd,skill_get_weapontype(status_sc2skill(scw_list[i]))))
 			status_change_end(&sd->bl, scw_list[i], INVALID_TIMER);
 	}
 	
-	if(sd->sc.data[SC_SPURT] && sd->status.weapon)
+	if(sc_get(&sd->sc,SC_SPURT) && sd->status.weapon)
 		// Spurt requires bare hands (feet, in fact xD)
 		status_change_end(&sd->bl, SC_SPURT, INVALID_TIMER);
 	
 	if(sd->status.shield <= 0) { // Skills requiring a shield
 		for (i = 0; i < ARRAYLENGTH(scs_list); i++)
-			if(sd->sc.data[scs_list[i]])
+			if(sc_get(&sd->sc,scs_list[i]))
 				status_change_end(&sd->bl, scs_list[i], INVALID_TIMER);
 	}
 	return 0;
@@ -5057,13 +5055,13 @@ static void pc_calcexp(struct map_session_data *sd, unsigned int *base_exp, unsi
 		(int)(status_get_lv(src) - sd->status.base_level) >= 20)
 		bonus += 15; // pk_mode additional exp if monster >20 levels [Valaris]	
 
-	if (sd->sc.data[SC_EXPBOOST])
-		bonus += sd->sc.data[SC_EXPBOOST]->val1;
+	if (sc_get(&sd->sc,SC_EXPBOOST))
+		bonus += sc_get(&sd->sc,SC_EXPBOOST)->val1;
 
 	*base_exp = (unsigned int) cap_value(*base_exp + (double)*base_exp * bonus/100., 1, UINT_MAX);
 
-	if (sd->sc.data[SC_JEXPBOOST])
-		bonus += sd->sc.data[SC_JEXPBOOST]->val1;
+	if (sc_get(&sd->sc,SC_JEXPBOOST))
+		bonus += sc_get(&sd->sc,SC_JEXPBOOST)->val1;
 
 	*job_exp = (unsigned int) cap_value(*job_exp + (double)*job_exp * bonus/100., 1, UINT_MAX);
 
@@ -5983,7 +5981,7 @@ int pc_dead(struct map_session_data *sd,struct block_list *src)
 	if(battle_config.death_penalty_type
 		&& (sd->class_&MAPID_UPPERMASK) != MAPID_NOVICE	// only novices will receive no penalty
 		&& !map[sd->bl.m].flag.noexppenalty && !map_flag_gvg(sd->bl.m)
-		&& !sd->sc.data[SC_BABY] && !sd->sc.data[SC_LIFEINSURANCE])
+		&& !sc_get(&sd->sc,SC_BABY) && !sc_get(&sd->sc,SC_LIFEINSURANCE))
 	{
 		unsigned int base_penalty =0;
 		if (battle_config.death_penalty_base > 0) {
@@ -6393,8 +6391,8 @@ int pc_itemheal(struct map_session_data *sd,int itemid, int hp,int sp)
 			hp = hp * bonus / 100;
 
 		// Recovery Potion
-		if( sd->sc.data[SC_INCHEALRATE] )
-			hp += (int)(hp * sd->sc.data[SC_INCHEALRATE]->val1/100.);
+		if( sc_get(&sd->sc,SC_INCHEALRATE) )
+			hp += (int)(hp * sc_get(&sd->sc,SC_INCHEALRATE)->val1/100.);
 	}
 	if(sp) {
 		bonus = 100 + (sd->battle_status.int_<<1)
@@ -6406,10 +6404,10 @@ int pc_itemheal(struct map_session_data *sd,int itemid, int hp,int sp)
 			sp = sp * bonus / 100;
 	}
 
-	if (sd->sc.data[SC_CRITICALWOUND])
+	if (sc_get(&sd->sc,SC_CRITICALWOUND))
 	{
-		hp -= hp * sd->sc.data[SC_CRITICALWOUND]->val2 / 100;
-		sp -= sp * sd->sc.data[SC_CRITICALWOUND]->val2 / 100;
+		hp -= hp * sc_get(&sd->sc,SC_CRITICALWOUND)->val2 / 100;
+		sp -= sp * sc_get(&sd->sc,SC_CRITICALWOUND)->val2 / 100;
 	}
 
 	return status_heal(&sd->bl, hp, sp, 1);
@@ -6516,7 +6514,7 @@ int pc_jobchange(struct map_session_data *sd,int job, int upper)
 		for(i = 0; i < MAX_SKILL_TREE && (id = skill_tree[class_][i].id) > 0; i++) {
 			//Remove status specific to your current tree skills.
 			enum sc_type sc = status_skill2sc(id);
-			if (sc > SC_COMMON_MAX && sd->sc.data[sc])
+			if (sc > SC_COMMON_MAX && sc_get(&sd->sc,sc))
 				status_change_end(&sd->bl, sc, INVALID_TIMER);
 		}
 	}
@@ -7303,7 +7301,7 @@ int pc_equipitem(struct map_session_data *sd,int n,int req_pos)
 		return 0;
 	}
 
-	if( sd->sc.data[SC_BERSERK] )
+	if( sc_get(&sd->sc,SC_BERSERK) )
 	{
 		clif_equipitemack(sd,n,0,0);	// fail
 		return 0;
@@ -7451,7 +7449,7 @@ int pc_unequipitem(struct map_session_data *sd,int n,int flag)
 	}
 
 	// if player is berserk then cannot unequip
-	if( !(flag&2) && sd->sc.count && sd->sc.data[SC_BERSERK] )
+	if( !(flag&2) && sd->sc.count && sc_get(&sd->sc,SC_BERSERK) )
 	{
 		clif_unequipitemack(sd,n,0,0);
 		return 0;
@@ -7503,7 +7501,7 @@ int pc_unequipitem(struct map_session_data *sd,int n,int flag)
 	clif_unequipitemack(sd,n,sd->status.inventory[n].equip,1);
 
 	if((sd->status.inventory[n].equip & EQP_ARMS) && 
-		sd->weapontype1 == 0 && sd->weapontype2 == 0 && (!sd->sc.data[SC_SEVENWIND] || sd->sc.data[SC_ASPERSIO])) //Check for seven wind (but not level seven!)
+		sd->weapontype1 == 0 && sd->weapontype2 == 0 && (!sc_get(&sd->sc,SC_SEVENWIND) || sc_get(&sd->sc,SC_ASPERSIO))) //Check for seven wind (but not level seven!)
 		skill_enchant_elemental_end(&sd->bl,-1);
 
 	if(sd->status.inventory[n].equip & EQP_ARMOR) {
@@ -7522,7 +7520,7 @@ int pc_unequipitem(struct map_session_data *sd,int n,int flag)
 		status_calc_pc(sd,0);
 	}
 
-	if(sd->sc.data[SC_SIGNUMCRUCIS] && !battle_check_undead(sd->battle_status.race,sd->battle_status.def_ele))
+	if(sc_get(&sd->sc,SC_SIGNUMCRUCIS) && !battle_check_undead(sd->battle_status.race,sd->battle_status.def_ele))
 		status_change_end(&sd->bl, SC_SIGNUMCRUCIS, INVALID_TIMER);
 
 	//OnUnEquip script [Skotlex]
@@ -1096,7 +1096,7 @@ int pet_recovery_timer(int tid, unsigned int tick, int id, intptr_t data)
 		return 0;
 	}
 
-	if(sd->sc.data[pd->recovery->type])
+	if(sc_get(&sd->sc,pd->recovery->type))
 	{	//Display a heal animation? 
 		//Detoxify is chosen for now.
 		clif_skill_nodamage(&pd->bl,&sd->bl,TF_DETOXIFY,1,1);
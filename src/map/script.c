@@ -9031,7 +9031,7 @@ BUILDIN_FUNC(sc_end)
 	if( type >= 0 && type < SC_MAX )
 	{
 		struct status_change *sc = status_get_sc(bl);
-		struct status_change_entry *sce = sc?sc->data[type]:NULL;
+		struct status_change_entry *sce = sc?sc_get(sc,type):NULL;
 		if (!sce) return 0;
 		//This should help status_change_end force disabling the SC in case it has no limit.
 		sce->val1 = sce->val2 = sce->val3 = sce->val4 = 0;
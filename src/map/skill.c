@@ -40,6 +40,7 @@
 
 
 #define SKILLUNITTIMER_INTERVAL	100
+#define SKILLUNIT_WHEEL_SIZE	256 // buckets of SKILLUNITTIMER_INTERVAL each
 
 // ranges reserved for mapping skill ids to skilldb offsets
 #define GD_SKILLRANGEMIN 900
@@ -52,6 +53,13 @@
 static struct eri *skill_unit_ers = NULL; //For handling skill_unit's [Skotlex]
 static struct eri *skill_timer_ers = NULL; //For handling skill_timerskills [Skotlex]
 
+// skill unit groups waiting for skill_unit_timer, bucketed by due tick
+static struct skill_unit_group* skillunit_wheel[SKILLUNIT_WHEEL_SIZE];
+static int skillunit_wheel_pos = 0;
+static unsigned int skillunit_wheel_tick = 0; // tick of the bucket at skillunit_wheel_pos
+static int* skillunit_due = NULL; // group ids collected by skill_unit_timer
+static int skillunit_due_max = 0;
+
 DBMap* skillunit_db = NULL; // int id -> struct skill_unit*
 
 DBMap* skilldb_name2id = NULL;
@@ -312,10 +320,10 @@ int skill_calc_heal(struct block_list *src, struct block_list *target, int skill
 	sc = status_get_sc(target);
 	if( sc && sc->count )
 	{
-		if( sc->data[SC_CRITICALWOUND] && heal ) // Critical Wound has no effect on offensive heal. [Inkfish]
-			hp -= hp * sc->data[SC_CRITICALWOUND]->val2/100;
-		if( sc->data[SC_INCHEALRATE] && skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN )
-			hp += hp * sc->data[SC_INCHEALRATE]->val1/100; // Only affects Heal, Sanctuary and PotionPitcher.(like bHealPower) [Inkfish]
+		if( sc_get(sc,SC_CRITICALWOUND) && heal ) // Critical Wound has no effect on offensive heal. [Inkfish]
+			hp -= hp * sc_get(sc,SC_CRITICALWOUND)->val2/100;
+		if( sc_get(sc,SC_INCHEALRATE) && skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN )
+			hp += hp * sc_get(sc,SC_INCHEALRATE)->val1/100; // Only affects Heal, Sanctuary and PotionPitcher.(like bHealPower) [Inkfish]
 	}
 
 	return hp;
@@ -597,24 +605,24 @@ int skill_additional_effect (struct block_list* src, struct block_list *bl, int
 					clif_skill_fail(sd,RG_SNATCHER,USESKILL_FAIL_LEVEL,0);
 			}
 			// Chance to trigger Taekwon kicks [Dralnu]
-			if(sc && !sc->data[SC_COMBO]) {
-				if(sc->data[SC_READYSTORM] &&
+			if(sc && !sc_get(sc,SC_COMBO)) {
+				if(sc_get(sc,SC_READYSTORM) &&
 					sc_start(src,SC_COMBO, 15, TK_STORMKICK,
 						(2000 - 4*sstatus->agi - 2*sstatus->dex)))
 					; //Stance triggered
-				else if(sc->data[SC_READYDOWN] &&
+				else if(sc_get(sc,SC_READYDOWN) &&
 					sc_start(src,SC_COMBO, 15, TK_DOWNKICK,
 						(2000 - 4*sstatus->agi - 2*sstatus->dex)))
 					; //Stance triggered
-				else if(sc->data[SC_READYTURN] &&
+				else if(sc_get(sc,SC_READYTURN) &&
 					sc_start(src,SC_COMBO, 15, TK_TURNKICK,
 						(2000 - 4*sstatus->agi - 2*sstatus->dex)))
 					; //Stance triggered
-				else if(sc->data[SC_READYCOUNTER])
+				else if(sc_get(sc,SC_READYCOUNTER))
 				{	//additional chance from SG_FRIEND [Komurka]
 					rate = 20;
-					if (sc->data[SC_SKILLRATE_UP] && sc->data[SC_SKILLRATE_UP]->val1 == TK_COUNTER) {
-						rate += rate*sc->data[SC_SKILLRATE_UP]->val2/100;
+					if (sc_get(sc,SC_SKILLRATE_UP) && sc_get(sc,SC_SKILLRATE_UP)->val1 == TK_COUNTER) {
+						rate += rate*sc_get(sc,SC_SKILLRATE_UP)->val2/100;
 						status_change_end(src, SC_SKILLRATE_UP, INVALID_TIMER);
 					}
 					sc_start4(src,SC_COMBO, rate, TK_COUNTER, bl->id,0,0,
@@ -626,11 +634,11 @@ int skill_additional_effect (struct block_list* src, struct block_list *bl, int
 		if (sc) {
 			struct status_change_entry *sce;
 			// Enchant Poison gives a chance to poison attacked enemies
-			if((sce=sc->data[SC_ENCPOISON])) //Don't use sc_start since chance comes in 1/10000 rate.
+			if((sce=sc_get(sc,SC_ENCPOISON))) //Don't use sc_start since chance comes in 1/10000 rate.
 				status_change_start(bl,SC_POISON,sce->val2, sce->val1,0,0,0,
 					skill_get_time2(AS_ENCHANTPOISON,sce->val1),0);
 			// Enchant Deadly Poison gives a chance to deadly poison attacked enemies
-			if((sce=sc->data[SC_EDP]))
+			if((sce=sc_get(sc,SC_EDP)))
 				sc_start4(bl,SC_DPOISON,sce->val2, sce->val1,0,0,0,
 					skill_get_time2(ASC_EDP,sce->val1));
 		}
@@ -838,7 +846,7 @@ int skill_additional_effect (struct block_list* src, struct block_list *bl, int
 		break;
 
 	case PF_FOGWALL:
-		if (src != bl && !tsc->data[SC_DELUGE])
+		if (src != bl && !sc_get(tsc,SC_DELUGE))
 			status_change_start(bl,SC_BLIND,10000,skilllv,0,0,0,skill_get_time2(skillid,skilllv),8);
 		break;
 
@@ -885,7 +893,7 @@ int skill_additional_effect (struct block_list* src, struct block_list *bl, int
 		break;
 
 	case TK_JUMPKICK:
-		if( dstsd && dstsd->class_ != MAPID_SOUL_LINKER && !tsc->data[SC_PRESERVE] )
+		if( dstsd && dstsd->class_ != MAPID_SOUL_LINKER && !sc_get(tsc,SC_PRESERVE) )
 		{// debuff the following statuses
 			status_change_end(bl, SC_SPIRIT, INVALID_TIMER);
 			status_change_end(bl, SC_ADRENALINE2, INVALID_TIMER);
@@ -952,9 +960,9 @@ int skill_additional_effect (struct block_list* src, struct block_list *bl, int
 			rate = battle_config.equip_natural_break_rate;
 			if( sc )
 			{
-				if(sc->data[SC_OVERTHRUST])
+				if(sc_get(sc,SC_OVERTHRUST))
 					rate += 10;
-				if(sc->data[SC_MAXOVERTHRUST])
+				if(sc_get(sc,SC_MAXOVERTHRUST))
 					rate += 10;
 			}
 			if( rate )
@@ -966,8 +974,8 @@ int skill_additional_effect (struct block_list* src, struct block_list *bl, int
 			rate = 0;
 			if( sd )
 				rate += sd->break_weapon_rate;
-			if( sc && sc->data[SC_MELTDOWN] )
-				rate += sc->data[SC_MELTDOWN]->val2;
+			if( sc && sc_get(sc,SC_MELTDOWN) )
+				rate += sc_get(sc,SC_MELTDOWN)->val2;
 			if( rate )
 				skill_break_equip(bl, EQP_WEAPON, rate, BCT_ENEMY);
 
@@ -975,8 +983,8 @@ int skill_additional_effect (struct block_list* src, struct block_list *bl, int
 			rate = 0;
 			if( sd )
 				rate += sd->break_armor_rate;
-			if( sc && sc->data[SC_MELTDOWN] )
-				rate += sc->data[SC_MELTDOWN]->val3;
+			if( sc && sc_get(sc,SC_MELTDOWN) )
+				rate += sc_get(sc,SC_MELTDOWN)->val3;
 			if( rate )
 				skill_break_equip(bl, EQP_ARMOR, rate, BCT_ENEMY);
 		}
@@ -1389,7 +1397,7 @@ int skill_break_equip (struct block_list *bl, unsigned short where, int rate, in
 
 	for (i = 0; i < 4; i++) {
 		if (where&where_list[i]) {
-			if (sc && sc->count && sc->data[scdef[i]])
+			if (sc && sc->count && sc_get(sc,scdef[i]))
 				where&=~where_list[i];
 			else if (rand()%10000 >= rate)
 				where&=~where_list[i];
@@ -1454,7 +1462,7 @@ int skill_strip_equip(struct block_list *bl, unsigned short where, int rate, int
 		return 0;
 
 	for (i = 0; i < ARRAYLENGTH(pos); i++) {
-		if (where&pos[i] && sc->data[sc_def[i]])
+		if (where&pos[i] && sc_get(sc,sc_def[i]))
 			where&=~pos[i];
 	}
 	if (!where) return 0;
@@ -1499,7 +1507,7 @@ int skill_blown(struct block_list* src, struct block_list* target, int count, in
 		case BL_PC:
 		{
 			struct map_session_data *sd = BL_CAST(BL_PC, target);
-			if( sd->sc.data[SC_BASILICA] && sd->sc.data[SC_BASILICA]->val4 == sd->bl.id && !is_boss(src))
+			if( sc_get(&sd->sc,SC_BASILICA) && sc_get(&sd->sc,SC_BASILICA)->val4 == sd->bl.id && !is_boss(src))
 				return 0; // Basilica caster can't be knocked-back by normal monsters.
 			if( src != target && sd->special_state.no_knockback )
 				return 0;
@@ -1543,13 +1551,13 @@ static int skill_magic_reflect(struct block_list* src, struct block_list* bl, in
 	if( !sc || sc->count == 0 )
 		return 0;
 
-	if( sc->data[SC_MAGICMIRROR] && rand()%100 < sc->data[SC_MAGICMIRROR]->val2 )
+	if( sc_get(sc,SC_MAGICMIRROR) && rand()%100 < sc_get(sc,SC_MAGICMIRROR)->val2 )
 		return 1;
 
-	if( sc->data[SC_KAITE] && (src->type == BL_PC || status_get_lv(src) <= 80) )
+	if( sc_get(sc,SC_KAITE) && (src->type == BL_PC || status_get_lv(src) <= 80) )
 	{// Kaite only works against non-players if they are low-level.
 		clif_specialeffect(bl, 438, AREA);
-		if( --sc->data[SC_KAITE]->val2 <= 0 )
+		if( --sc_get(sc,SC_KAITE)->val2 <= 0 )
 			status_change_end(bl, SC_KAITE, INVALID_TIMER);
 		return 2;
 	}
@@ -1607,7 +1615,7 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 	if(skillid == WZ_FROSTNOVA && dsrc->x == bl->x && dsrc->y == bl->y)
 		return 0;
 	 //Trick Dead protects you from damage, but not from buffs and the like, hence it's placed here.
-	if (sc && sc->data[SC_TRICKDEAD] && !(sstatus->mode&MD_BOSS))
+	if (sc && sc_get(sc,SC_TRICKDEAD) && !(sstatus->mode&MD_BOSS))
 		return 0;
 
 	dmg = battle_calc_attack(attack_type,src,bl,skillid,skilllv,flag&0xFFF);
@@ -1644,28 +1652,28 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 				sc = NULL; //Don't need it.
 
 			//Spirit of Wizard blocks Kaite's reflection
-			if( type == 2 && sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_WIZARD )
+			if( type == 2 && sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_WIZARD )
 			{	//Consume one Fragment per hit of the casted skill? [Skotlex]
 			  	type = tsd?pc_search_inventory (tsd, 7321):0;
 				if (type >= 0) {
 					if ( tsd ) pc_delitem(tsd, type, 1, 0, 1);
 					dmg.damage = dmg.damage2 = 0;
 					dmg.dmg_lv = ATK_MISS;
-					sc->data[SC_SPIRIT]->val3 = skillid;
-					sc->data[SC_SPIRIT]->val4 = dsrc->id;
+					sc_get(sc,SC_SPIRIT)->val3 = skillid;
+					sc_get(sc,SC_SPIRIT)->val4 = dsrc->id;
 				}
 			}
 		}
 
-		if(sc && sc->data[SC_MAGICROD] && src == dsrc) {
+		if(sc && sc_get(sc,SC_MAGICROD) && src == dsrc) {
 			int sp = skill_get_sp(skillid,skilllv);
 			dmg.damage = dmg.damage2 = 0;
 			dmg.dmg_lv = ATK_MISS; //This will prevent skill additional effect from taking effect. [Skotlex]
-			sp = sp * sc->data[SC_MAGICROD]->val2 / 100;
+			sp = sp * sc_get(sc,SC_MAGICROD)->val2 / 100;
 			if(skillid == WZ_WATERBALL && skilllv > 1)
 				sp = sp/((skilllv|1)*(skilllv|1)); //Estimate SP cost of a single water-ball
 			status_heal(bl, 0, sp, 2);
-			clif_skill_nodamage(bl,bl,SA_MAGICROD,sc->data[SC_MAGICROD]->val1,1);
+			clif_skill_nodamage(bl,bl,SA_MAGICROD,sc_get(sc,SC_MAGICROD)->val1,1);
 		}
 	}
 
@@ -1673,7 +1681,7 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 
 	if( (skillid == AL_INCAGI || skillid == AL_BLESSING || 
 		skillid == CASH_BLESSING || skillid == CASH_INCAGI ||
-		skillid == MER_INCAGI || skillid == MER_BLESSING) && tsd->sc.data[SC_CHANGEUNDEAD] )
+		skillid == MER_INCAGI || skillid == MER_BLESSING) && sc_get(&tsd->sc,SC_CHANGEUNDEAD) )
 		damage = 1;
 
 	if( damage > 0 && dmg.flag&BF_WEAPON && src != bl && ( src == dsrc || ( dsrc->type == BL_SKILL && ( skillid == SG_SUN_WARM || skillid == SG_MOON_WARM || skillid == SG_STAR_WARM ) ) )
@@ -1701,7 +1709,7 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 	if(sd) {
 		int flag = 0; //Used to signal if this skill can be combo'ed later on.
 		struct status_change_entry *sce;
-		if ((sce = sd->sc.data[SC_COMBO]))
+		if ((sce = sc_get(&sd->sc,SC_COMBO)))
 		{	//End combo state after skill is invoked. [Skotlex]
 			switch (skillid) {
 			case TK_TURNKICK:
@@ -1712,8 +1720,7 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 			  	{	//Extend combo time.
 					sce->val1 = skillid; //Update combo-skill
 					sce->val3 = skillid;
-					delete_timer(sce->timer, status_change_timer);
-					sce->timer = add_timer(tick+sce->val4, status_change_timer, src->id, SC_COMBO);
+					status_change_settimer(src, SC_COMBO, tick+sce->val4);
 					break;
 				}
 				unit_cancel_combo(src); // Cancel combo wait
@@ -1742,7 +1749,7 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 				if (!flag && pc_checkskill(sd, CH_CHAINCRUSH) > 0 && sd->spiritball > 1)
 					flag=1;
 			case CH_CHAINCRUSH:
-				if (!flag && pc_checkskill(sd, MO_EXTREMITYFIST) > 0 && sd->spiritball > 0 && sd->sc.data[SC_EXPLOSIONSPIRITS])
+				if (!flag && pc_checkskill(sd, MO_EXTREMITYFIST) > 0 && sd->spiritball > 0 && sc_get(&sd->sc,SC_EXPLOSIONSPIRITS))
 					flag=1;
 				break;
 			case AC_DOUBLE:
@@ -1762,7 +1769,7 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 				break;
 			case SL_STIN:
 			case SL_STUN:
-				if (skilllv >= 7 && !sd->sc.data[SC_SMA])
+				if (skilllv >= 7 && !sc_get(&sd->sc,SC_SMA))
 					sc_start(src,SC_SMA,100,skilllv,skill_get_time(SL_SMA, skilllv));
 				break;
 			case GS_FULLBUSTER:
@@ -1816,7 +1823,7 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 
 	if(damage > 0 && dmg.flag&BF_SKILL && tsd
 		&& pc_checkskill(tsd,RG_PLAGIARISM)
-	  	&& (!sc || !sc->data[SC_PRESERVE])
+	  	&& (!sc || !sc_get(sc,SC_PRESERVE))
 		&& (unsigned int)damage < tsd->battle_status.hp)
 	{	//Updated to not be able to copy skills if the blow will kill you. [Skotlex]
 		if ((tsd->status.skill[skillid].id == 0 || tsd->status.skill[skillid].flag == SKILL_FLAG_PLAGIARIZED) &&
@@ -1864,7 +1871,7 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 
 	if( !dmg.amotion )
 	{ //Instant damage
-		if( !sc || !sc->data[SC_DEVOTION] )
+		if( !sc || !sc_get(sc,SC_DEVOTION) )
 			status_fix_damage(src,bl,damage,dmg.dmotion); //Deal damage before knockback to allow stuff like firewall+storm gust combo.
 		if( !status_isdead(bl) )
 			skill_additional_effect(src,bl,skillid,skilllv,dmg.flag,dmg.dmg_lv,tick);
@@ -1890,9 +1897,9 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 	if (dmg.amotion)
 		battle_delay_damage(tick, dmg.amotion,src,bl,dmg.flag,skillid,skilllv,damage,dmg.dmg_lv,dmg.dmotion);
 
-	if( sc && sc->data[SC_DEVOTION] && skillid != PA_PRESSURE )
+	if( sc && sc_get(sc,SC_DEVOTION) && skillid != PA_PRESSURE )
 	{
-		struct status_change_entry *sce = sc->data[SC_DEVOTION];
+		struct status_change_entry *sce = sc_get(sc,SC_DEVOTION);
 		struct block_list *d_bl = map_id2bl(sce->val1);
 
 		if( d_bl && (
@@ -1943,8 +1950,8 @@ int skill_attack (int attack_type, struct block_list* src, struct block_list *ds
 			skillid == MG_COLDBOLT || skillid == MG_FIREBOLT || skillid == MG_LIGHTNINGBOLT
 		) &&
 		(sc = status_get_sc(src)) &&
-		sc->data[SC_DOUBLECAST] &&
-		rand() % 100 < sc->data[SC_DOUBLECAST]->val2)
+		sc_get(sc,SC_DOUBLECAST) &&
+		rand() % 100 < sc_get(sc,SC_DOUBLECAST)->val2)
 	{
 //		skill_addtimerskill(src, tick + dmg.div_*dmg.amotion, bl->id, 0, 0, skillid, skilllv, BF_MAGIC, flag|2);
 		skill_addtimerskill(src, tick + dmg.amotion, bl->id, 0, 0, skillid, skilllv, BF_MAGIC, flag|2);
@@ -2118,8 +2125,8 @@ int skill_guildaura_sub (struct map_session_data* sd, int id, int strvit, int ag
 	if(id == sd->bl.id && battle_config.guild_aura&16)
 		return 0;  // Do not affect guild leader
 
-	if (sd->sc.data[SC_GUILDAURA]) {
-		struct status_change_entry *sce = sd->sc.data[SC_GUILDAURA];
+	if (sc_get(&sd->sc,SC_GUILDAURA)) {
+		struct status_change_entry *sce = sc_get(&sd->sc,SC_GUILDAURA);
 		if (sce->val3 != strvit || sce->val4 != agidex) {
 			sce->val3 = strvit;
 			sce->val4 = agidex;
@@ -2326,10 +2333,10 @@ static int skill_timerskill(int tid, unsigned int tick, int id, intptr_t data)
 						struct status_change *sc = status_get_sc(src);
 						if(sc) {
 							status_change_end(src, SC_MAGICPOWER, INVALID_TIMER);
-							if(sc->data[SC_SPIRIT] &&
-								sc->data[SC_SPIRIT]->val2 == SL_WIZARD &&
-								sc->data[SC_SPIRIT]->val3 == skl->skill_id)
-								sc->data[SC_SPIRIT]->val3 = 0; //Clear bounced spell check.
+							if(sc_get(sc,SC_SPIRIT) &&
+								sc_get(sc,SC_SPIRIT)->val2 == SL_WIZARD &&
+								sc_get(sc,SC_SPIRIT)->val3 == skl->skill_id)
+								sc_get(sc,SC_SPIRIT)->val3 = 0; //Clear bounced spell check.
 						}
 					}
 					break;
@@ -2575,7 +2582,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, int
 		break;
 
 	case MO_COMBOFINISH:
-		if (!(flag&1) && sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_MONK)
+		if (!(flag&1) && sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_MONK)
 		{	//Becomes a splash attack when Soul Linked.
 			map_foreachinrange(skill_area_sub, bl,
 				skill_get_splash(skillid, skilllv),splash_target(src),
@@ -3160,7 +3167,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 
 	type = status_skill2sc(skillid);
 	tsc = status_get_sc(bl);
-	tsce = (tsc && type != -1)?tsc->data[type]:NULL;
+	tsce = (tsc && type != -1)?sc_get(tsc,type):NULL;
 
 	if (src!=bl && type > -1 &&
 		(i = skill_get_ele(skillid, skilllv)) > ELE_NEUTRAL &&
@@ -3185,9 +3192,9 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 
 			if( tsc && tsc->count )
 			{
-				if( tsc->data[SC_KAITE] && !(sstatus->mode&MD_BOSS) )
+				if( sc_get(tsc,SC_KAITE) && !(sstatus->mode&MD_BOSS) )
 				{ //Bounce back heal
-					if (--tsc->data[SC_KAITE]->val2 <= 0)
+					if (--sc_get(tsc,SC_KAITE)->val2 <= 0)
 						status_change_end(bl, SC_KAITE, INVALID_TIMER);
 					if (src == bl)
 						heal=0; //When you try to heal yourself under Kaite, the heal is voided.
@@ -3196,7 +3203,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 						dstsd = sd;
 					}
 				} else
-				if (tsc->data[SC_BERSERK])
+				if (sc_get(tsc,SC_BERSERK))
 					heal = 0; //Needed so that it actually displays 0 when healing.
 			}
 			heal_get_jobexp = status_heal(bl,heal,0,0);
@@ -3252,7 +3259,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 			break;
 		{
 			int per = 0, sper = 0;
-			if (tsc && tsc->data[SC_HELLPOWER])
+			if (tsc && sc_get(tsc,SC_HELLPOWER))
 				break;
 
 			if (map[bl->m].flag.pvp && dstsd && dstsd->pvp_point < 0)
@@ -3421,9 +3428,9 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 			{
 				const enum sc_type scs[] = { SC_QUAGMIRE, SC_PROVOKE, SC_ROKISWEIL, SC_GRAVITATION, SC_SUITON, SC_STRIPWEAPON, SC_STRIPSHIELD, SC_STRIPARMOR, SC_STRIPHELM, SC_BLADESTOP };
 				for (i = SC_COMMON_MIN; i <= SC_COMMON_MAX; i++)
-					if (tsc->data[i]) status_change_end(bl, (sc_type)i, INVALID_TIMER);
+					if (sc_get(tsc,i)) status_change_end(bl, (sc_type)i, INVALID_TIMER);
 				for (i = 0; i < ARRAYLENGTH(scs); i++)
-					if (tsc->data[scs[i]]) status_change_end(bl, scs[i], INVALID_TIMER);
+					if (sc_get(tsc,scs[i])) status_change_end(bl, scs[i], INVALID_TIMER);
 			}
 		}
 		break;
@@ -3478,15 +3485,15 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 
 			if( sc && tsc )
 			{
-				if( !sc->data[SC_MARIONETTE] && !tsc->data[SC_MARIONETTE2] )
+				if( !sc_get(sc,SC_MARIONETTE) && !sc_get(tsc,SC_MARIONETTE2) )
 				{
 					sc_start(src,SC_MARIONETTE,100,bl->id,skill_get_time(skillid,skilllv));
 					sc_start(bl,SC_MARIONETTE2,100,src->id,skill_get_time(skillid,skilllv));
 					clif_skill_nodamage(src,bl,skillid,skilllv,1);
 				}
 				else
-				if(  sc->data[SC_MARIONETTE ] &&  sc->data[SC_MARIONETTE ]->val1 == bl->id &&
-					tsc->data[SC_MARIONETTE2] && tsc->data[SC_MARIONETTE2]->val1 == src->id )
+				if(  sc_get(sc,SC_MARIONETTE ) &&  sc_get(sc,SC_MARIONETTE )->val1 == bl->id &&
+					sc_get(tsc,SC_MARIONETTE2) && sc_get(tsc,SC_MARIONETTE2)->val1 == src->id )
 				{
 					status_change_end(src, SC_MARIONETTE, INVALID_TIMER);
 					status_change_end(bl, SC_MARIONETTE2, INVALID_TIMER);
@@ -3513,15 +3520,15 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 	case SA_SEISMICWEAPON:
 		if (dstsd) {
 			if(dstsd->status.weapon == W_FIST ||
-				(dstsd->sc.count && !dstsd->sc.data[type] &&
+				(dstsd->sc.count && !sc_get(&dstsd->sc,type) &&
 				(	//Allow re-enchanting to lenghten time. [Skotlex]
-					dstsd->sc.data[SC_FIREWEAPON] ||
-					dstsd->sc.data[SC_WATERWEAPON] ||
-					dstsd->sc.data[SC_WINDWEAPON] ||
-					dstsd->sc.data[SC_EARTHWEAPON] ||
-					dstsd->sc.data[SC_SHADOWWEAPON] ||
-					dstsd->sc.data[SC_GHOSTWEAPON] ||
-					dstsd->sc.data[SC_ENCPOISON]
+					sc_get(&dstsd->sc,SC_FIREWEAPON) ||
+					sc_get(&dstsd->sc,SC_WATERWEAPON) ||
+					sc_get(&dstsd->sc,SC_WINDWEAPON) ||
+					sc_get(&dstsd->sc,SC_EARTHWEAPON) ||
+					sc_get(&dstsd->sc,SC_SHADOWWEAPON) ||
+					sc_get(&dstsd->sc,SC_GHOSTWEAPON) ||
+					sc_get(&dstsd->sc,SC_ENCPOISON)
 				))
 				) {
 				if (sd) clif_skill_fail(sd,skillid,USESKILL_FAIL_LEVEL,0);
@@ -3591,7 +3598,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 	case AL_BLESSING:
 	case MER_INCAGI:
 	case MER_BLESSING:
-		if (dstsd != NULL && tsc->data[SC_CHANGEUNDEAD]) {
+		if (dstsd != NULL && sc_get(tsc,SC_CHANGEUNDEAD)) {
 			skill_attack(BF_MISC,src,src,bl,skillid,skilllv,tick,flag);
 			break;
 		}
@@ -3703,13 +3710,13 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 
 	case AS_ENCHANTPOISON: // Prevent spamming [Valaris]
 		if (sd && dstsd && dstsd->sc.count) {
-			if (dstsd->sc.data[SC_FIREWEAPON] ||
-				dstsd->sc.data[SC_WATERWEAPON] ||
-				dstsd->sc.data[SC_WINDWEAPON] ||
-				dstsd->sc.data[SC_EARTHWEAPON] ||
-				dstsd->sc.data[SC_SHADOWWEAPON] ||
-				dstsd->sc.data[SC_GHOSTWEAPON]
-			//	dstsd->sc.data[SC_ENCPOISON] //People say you should be able to recast to lengthen the timer. [Skotlex]
+			if (sc_get(&dstsd->sc,SC_FIREWEAPON) ||
+				sc_get(&dstsd->sc,SC_WATERWEAPON) ||
+				sc_get(&dstsd->sc,SC_WINDWEAPON) ||
+				sc_get(&dstsd->sc,SC_EARTHWEAPON) ||
+				sc_get(&dstsd->sc,SC_SHADOWWEAPON) ||
+				sc_get(&dstsd->sc,SC_GHOSTWEAPON)
+			//	sc_get(&dstsd->sc,SC_ENCPOISON) //People say you should be able to recast to lengthen the timer. [Skotlex]
 			) {
 					clif_skill_nodamage(src,bl,skillid,skilllv,0);
 					clif_skill_fail(sd,skillid,USESKILL_FAIL_LEVEL,0);
@@ -3784,7 +3791,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 		if( tsc && tsc->count )
 		{
 			status_change_end(bl, SC_FREEZE, INVALID_TIMER);
-			if( tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE )
+			if( sc_get(tsc,SC_STONE) && tsc->opt1 == OPT1_STONE )
 				status_change_end(bl, SC_STONE, INVALID_TIMER);
 			status_change_end(bl, SC_SLEEP, INVALID_TIMER);
 		}
@@ -3810,10 +3817,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 			if( (lv = status_get_lv(src) - dstsd->status.base_level) < 0 )
 				lv = -lv;
 			if( lv > battle_config.devotion_level_difference || // Level difference requeriments
-				(dstsd->sc.data[type] && dstsd->sc.data[type]->val1 != src->id) || // Cannot Devote a player devoted from another source
+				(sc_get(&dstsd->sc,type) && sc_get(&dstsd->sc,type)->val1 != src->id) || // Cannot Devote a player devoted from another source
 				(skillid == ML_DEVOTION && (!mer || mer != dstsd->md)) || // Mercenary only can devote owner
 				(dstsd->class_&MAPID_UPPERMASK) == MAPID_CRUSADER || // Crusader Cannot be devoted
-				(dstsd->sc.data[SC_HELLPOWER])) // Players affected by SC_HELLPOWERR cannot be devoted.
+				(sc_get(&dstsd->sc,SC_HELLPOWER))) // Players affected by SC_HELLPOWERR cannot be devoted.
 			{
 				if( sd )
 					clif_skill_fail(sd,skillid,USESKILL_FAIL_LEVEL,0);
@@ -4049,7 +4056,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 	case SL_KAUPE:
 		if (sd) {
 			if (!dstsd || !(
-				(sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SOULLINKER) ||
+				(sc_get(&sd->sc,SC_SPIRIT) && sc_get(&sd->sc,SC_SPIRIT)->val2 == SL_SOULLINKER) ||
 				(dstsd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER ||
 				dstsd->status.char_id == sd->status.char_id ||
 				dstsd->status.char_id == sd->status.partner_id ||
@@ -4111,7 +4118,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 		break;
 
 	case BD_ADAPTATION:
-		if(tsc && tsc->data[SC_DANCING]){
+		if(tsc && sc_get(tsc,SC_DANCING)){
 			clif_skill_nodamage(src,bl,skillid,skilllv,1);
 			status_change_end(bl, SC_DANCING, INVALID_TIMER);
 		}
@@ -4185,7 +4192,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 			if(status_isimmune(bl) || !tsc)
 				break;
 
-			if (tsc->data[SC_STONE]) {
+			if (sc_get(tsc,SC_STONE)) {
 				status_change_end(bl, SC_STONE, INVALID_TIMER);
 				if (sd) clif_skill_fail(sd,skillid,USESKILL_FAIL_LEVEL,0);
 				break;
@@ -4447,7 +4454,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 		}
 
 		//Special message when trying to use strip on FCP [Jobbie]
-		if( sd && skillid == ST_FULLSTRIP && tsc && tsc->data[SC_CP_WEAPON] && tsc->data[SC_CP_HELM] && tsc->data[SC_CP_ARMOR] && tsc->data[SC_CP_SHIELD] )
+		if( sd && skillid == ST_FULLSTRIP && tsc && sc_get(tsc,SC_CP_WEAPON) && sc_get(tsc,SC_CP_HELM) && sc_get(tsc,SC_CP_ARMOR) && sc_get(tsc,SC_CP_SHIELD) )
 		{
 			clif_gospel_info(sd, 0x28);
 			break;
@@ -4502,7 +4509,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 				potion_target = bl->id;
 				run_script(sd->inventory_data[i]->script,0,sd->bl.id,0);
 				potion_flag = potion_target = 0;
-				if( sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_ALCHEMIST )
+				if( sc_get(&sd->sc,SC_SPIRIT) && sc_get(&sd->sc,SC_SPIRIT)->val2 == SL_ALCHEMIST )
 					bonus += sd->status.base_level;
 				if( potion_per_hp > 0 || potion_per_sp > 0 )
 				{
@@ -4556,10 +4563,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 				hp += hp * i / 100;
 				sp += sp * i / 100;
 			}
-			if( tsc && tsc->data[SC_CRITICALWOUND] )
+			if( tsc && sc_get(tsc,SC_CRITICALWOUND) )
 			{
-				hp -= hp * tsc->data[SC_CRITICALWOUND]->val2 / 100;
-				sp -= sp * tsc->data[SC_CRITICALWOUND]->val2 / 100;
+				hp -= hp * sc_get(tsc,SC_CRITICALWOUND)->val2 / 100;
+				sp -= sp * sc_get(tsc,SC_CRITICALWOUND)->val2 / 100;
 			}
 			clif_skill_nodamage(src,bl,skillid,skilllv,1);
 			if( hp > 0 || (skillid == AM_POTIONPITCHER && sp <= 0) )
@@ -4617,7 +4624,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 		{
 			clif_skill_nodamage(src,bl,skillid,skilllv,1);
 			if((dstsd && (dstsd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER)
-				|| (tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_ROGUE) //Rogue's spirit defends againt dispel.
+				|| (tsc && sc_get(tsc,SC_SPIRIT) && sc_get(tsc,SC_SPIRIT)->val2 == SL_ROGUE) //Rogue's spirit defends againt dispel.
 				|| rand()%100 >= 50+10*skilllv)
 			{
 				if (sd)
@@ -4628,7 +4635,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 				break;
 			for(i=0;i<SC_MAX;i++)
 			{
-				if (!tsc->data[i])
+				if (!sc_get(tsc,i))
 					continue;
 				switch (i) {
 				case SC_WEIGHT50:		case SC_WEIGHT90:		case SC_HALLUCINATION:
@@ -4666,7 +4673,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 						continue;
 					break;
 				}
-				if(i==SC_BERSERK) tsc->data[i]->val2=0; //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
+				if(i==SC_BERSERK) sc_get(tsc,i)->val2=0; //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
 				status_change_end(bl, (sc_type)i, INVALID_TIMER);
 			}
 			break;
@@ -4718,12 +4725,12 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 	case SA_SPELLBREAKER:
 		{
 			int sp;
-			if(tsc && tsc->data[SC_MAGICROD]) {
+			if(tsc && sc_get(tsc,SC_MAGICROD)) {
 				sp = skill_get_sp(skillid,skilllv);
-				sp = sp * tsc->data[SC_MAGICROD]->val2 / 100;
+				sp = sp * sc_get(tsc,SC_MAGICROD)->val2 / 100;
 				if(sp < 1) sp = 1;
 				status_heal(bl,0,sp,2);
-				clif_skill_nodamage(bl,bl,SA_MAGICROD,tsc->data[SC_MAGICROD]->val1,1);
+				clif_skill_nodamage(bl,bl,SA_MAGICROD,sc_get(tsc,SC_MAGICROD)->val1,1);
 				status_percent_damage(bl, src, 0, -20, false); //20% max SP damage.
 			} else {
 				struct unit_data *ud = unit_bl2ud(bl);
@@ -4773,7 +4780,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 			static const int spellarray[3] = { MG_COLDBOLT,MG_FIREBOLT,MG_LIGHTNINGBOLT };
 			if(skilllv >= 10) {
 				spellid = MG_FROSTDIVER;
-//				if (tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SA_SAGE)
+//				if (tsc && sc_get(tsc,SC_SPIRIT) && sc_get(tsc,SC_SPIRIT)->val2 == SA_SAGE)
 //					maxlv = 10;
 //				else
 					maxlv = skilllv - 9;
@@ -5159,7 +5166,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 
 			if(tsc && tsc->count){
 				status_change_end(bl, SC_FREEZE, INVALID_TIMER);
-				if(tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)
+				if(sc_get(tsc,SC_STONE) && tsc->opt1 == OPT1_STONE)
 					status_change_end(bl, SC_STONE, INVALID_TIMER);
 				status_change_end(bl, SC_SLEEP, INVALID_TIMER);
 			}
@@ -5206,10 +5213,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 				if (sp)
 					sp = sp * (100 + pc_checkskill(dstsd,MG_SRECOVERY)*10 + pc_skillheal2_bonus(dstsd, skillid))/100;
 			}
-			if (tsc && tsc->data[SC_CRITICALWOUND])
+			if (tsc && sc_get(tsc,SC_CRITICALWOUND))
 			{
-				hp -= hp * tsc->data[SC_CRITICALWOUND]->val2 / 100;
-				sp -= sp * tsc->data[SC_CRITICALWOUND]->val2 / 100;
+				hp -= hp * sc_get(tsc,SC_CRITICALWOUND)->val2 / 100;
+				sp -= sp * sc_get(tsc,SC_CRITICALWOUND)->val2 / 100;
 			}
 			if(hp > 0)
 				clif_skill_nodamage(NULL,bl,AL_HEAL,hp,1);
@@ -5241,7 +5248,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, in
 
 	case CG_LONGINGFREEDOM:
 		{
-			if (tsc && !tsce && (tsce=tsc->data[SC_DANCING]) && tsce->val4
+			if (tsc && !tsce && (tsce=sc_get(tsc,SC_DANCING)) && tsce->val4
 				&& (tsce->val1&0xFFFF) != CG_MOONLIT) //Can't use Longing for Freedom while under Moonlight Petals. [Skotlex]
 			{
 				clif_skill_nodamage(src,bl,skillid,skilllv,
@@ -5763,7 +5770,7 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 		if( ud->skillid == PR_LEXDIVINA || ud->skillid == MER_LEXDIVINA )
 		{
 			sc = status_get_sc(target);
-			if( battle_check_target(src,target, BCT_ENEMY) <= 0 && (!sc || !sc->data[SC_SILENCE]) )
+			if( battle_check_target(src,target, BCT_ENEMY) <= 0 && (!sc || !sc_get(sc,SC_SILENCE)) )
 			{ //If it's not an enemy, and not silenced, you can't use the skill on them. [Skotlex]
 				clif_skill_nodamage (src, target, ud->skillid, ud->skilllv, 0);
 				break;
@@ -5801,7 +5808,7 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 				break;
 
 			if(inf&BCT_ENEMY && (sc = status_get_sc(target)) &&
-				sc->data[SC_FOGWALL] &&
+				sc_get(sc,SC_FOGWALL) &&
 				rand()%100 < 75)
 		  	{	//Fogwall makes all offensive-type targetted skills fail at 75%
 				if (sd) clif_skill_fail(sd,ud->skillid,USESKILL_FAIL_LEVEL,0);
@@ -5860,10 +5867,10 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 				break;
 			case CR_GRANDCROSS:
 			case NPC_GRANDDARKNESS:
-				if( (sc = status_get_sc(src)) && sc->data[SC_STRIPSHIELD] )
+				if( (sc = status_get_sc(src)) && sc_get(sc,SC_STRIPSHIELD) )
 				{
-					const struct TimerData *timer = get_timer(sc->data[SC_STRIPSHIELD]->timer);
-					if( timer && timer->func == status_change_timer && DIFF_TICK(timer->tick,gettick()+skill_get_time(ud->skillid, ud->skilllv)) > 0 )
+					const struct status_change_entry *sce = sc_get(sc,SC_STRIPSHIELD);
+					if( sce->timed && DIFF_TICK(sce->tick,gettick()+skill_get_time(ud->skillid, ud->skilllv)) > 0 )
 						break;
 				}
 				sc_start2(src, SC_STRIPSHIELD, 100, 0, 1, skill_get_time(ud->skillid, ud->skilllv));
@@ -5885,16 +5892,16 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 
 		sc = status_get_sc(src);
 		if(sc && sc->count) {
-		  	if(sc->data[SC_MAGICPOWER] &&
+		  	if(sc_get(sc,SC_MAGICPOWER) &&
 				ud->skillid != HW_MAGICPOWER && ud->skillid != WZ_WATERBALL)
 				status_change_end(src, SC_MAGICPOWER, INVALID_TIMER);
-			if(sc->data[SC_SPIRIT] &&
-				sc->data[SC_SPIRIT]->val2 == SL_WIZARD &&
-				sc->data[SC_SPIRIT]->val3 == ud->skillid &&
+			if(sc_get(sc,SC_SPIRIT) &&
+				sc_get(sc,SC_SPIRIT)->val2 == SL_WIZARD &&
+				sc_get(sc,SC_SPIRIT)->val3 == ud->skillid &&
 			  	ud->skillid != WZ_WATERBALL)
-				sc->data[SC_SPIRIT]->val3 = 0; //Clear bounced spell check.
+				sc_get(sc,SC_SPIRIT)->val3 = 0; //Clear bounced spell check.
 
-			if( sc->data[SC_DANCING] && skill_get_inf2(ud->skillid)&INF2_SONG_DANCE && sd )
+			if( sc_get(sc,SC_DANCING) && skill_get_inf2(ud->skillid)&INF2_SONG_DANCE && sd )
 				skill_blockpc_start(sd,BD_ADAPTATION,3000);
 		}
 
@@ -5911,7 +5918,7 @@ int skill_castend_id(int tid, unsigned int tick, int id, intptr_t data)
 	} while(0);
 
 	//Skill failed.
-	if (ud->skillid == MO_EXTREMITYFIST && sd && !(sc && sc->data[SC_FOGWALL]))
+	if (ud->skillid == MO_EXTREMITYFIST && sd && !(sc && sc_get(sc,SC_FOGWALL)))
   	{	//When Asura fails... (except when it fails from Fog of Wall)
 		//Consume SP/spheres
 		skill_consume_requirement(sd,ud->skillid, ud->skilllv,1);
@@ -6126,7 +6133,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, int skillid, int sk
 
 	sc = status_get_sc(src);
 	type = status_skill2sc(skillid);
-	sce = (sc && type != -1)?sc->data[type]:NULL;
+	sce = (sc && type != -1)?sc_get(sc,type):NULL;
 
 	switch (skillid) { //Skill effect.
 		case WZ_METEOR:
@@ -6187,7 +6194,10 @@ int skill_castend_pos2(struct block_list* src, int x, int y, int skillid, int sk
 				return 0; // not to consume items
 			}
 			else
+			{
 				sg->limit = 0; //Disable it.
+				skill_unit_schedule(sg, gettick());
+			}
 		}
 		skill_unitsetting(src,skillid,skilllv,x,y,0);
 		break;
@@ -6267,7 +6277,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, int skillid, int sk
 		flag|=1;
 		break;
 	case HP_BASILICA:
-		if( sc->data[SC_BASILICA] )
+		if( sc_get(sc,SC_BASILICA) )
 			status_change_end(src, SC_BASILICA, INVALID_TIMER); // Cancel Basilica
 		else
 		{ // Create Basilica. Start SC on caster. Unit timer start SC on others.
@@ -6294,7 +6304,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, int skillid, int sk
 			int flag = 0, area = skill_get_splash(skillid, skilllv);
 			short tmpx = 0, tmpy = 0, x1 = 0, y1 = 0;
 
-			if( sc && sc->data[SC_MAGICPOWER] )
+			if( sc && sc_get(sc,SC_MAGICPOWER) )
 				flag = flag|2; //Store the magic power flag for future use. [Skotlex]
 
 			for( i = 0; i < 2 + (skilllv>>1); i++ )
@@ -6545,14 +6555,14 @@ int skill_castend_map (struct map_session_data *sd, short skill_num, const char
 		return 0;
 	}
 	if(sd->sc.count && (
-		sd->sc.data[SC_SILENCE] ||
-		sd->sc.data[SC_ROKISWEIL] ||
-		sd->sc.data[SC_AUTOCOUNTER] ||
-		sd->sc.data[SC_STEELBODY] ||
-		sd->sc.data[SC_DANCING] ||
-		sd->sc.data[SC_BERSERK] ||
-		sd->sc.data[SC_BASILICA] ||
-		sd->sc.data[SC_MARIONETTE]
+		sc_get(&sd->sc,SC_SILENCE) ||
+		sc_get(&sd->sc,SC_ROKISWEIL) ||
+		sc_get(&sd->sc,SC_AUTOCOUNTER) ||
+		sc_get(&sd->sc,SC_STEELBODY) ||
+		sc_get(&sd->sc,SC_DANCING) ||
+		sc_get(&sd->sc,SC_BERSERK) ||
+		sc_get(&sd->sc,SC_BASILICA) ||
+		sc_get(&sd->sc,SC_MARIONETTE)
 	 )) {
 		skill_failed(sd);
 		return 0;
@@ -6788,7 +6798,7 @@ struct skill_unit_group* skill_unitsetting (struct block_list *src, short skilli
 		val2=skilllv+1;
 		break;
 	case MG_FIREWALL:
-		if(sc && sc->data[SC_VIOLENTGALE])
+		if(sc && sc_get(sc,SC_VIOLENTGALE))
 			limit = limit*3/2;
 		val2=4+skilllv;
 		break;
@@ -6998,7 +7008,7 @@ struct skill_unit_group* skill_unitsetting (struct block_list *src, short skilli
 	group->val3=val3;
 	group->target_flag=target;
 	group->bl_flag= skill_get_unit_bl_target(skillid);
-	group->state.magic_power = (flag&2 || (sc && sc->data[SC_MAGICPOWER])); //Store the magic power flag. [Skotlex]
+	group->state.magic_power = (flag&2 || (sc && sc_get(sc,SC_MAGICPOWER))); //Store the magic power flag. [Skotlex]
 	group->state.ammo_consume = (sd && sd->state.arrow_atk && skillid != GS_GROUNDDRIFT); //Store if this skill needs to consume ammo.
 	group->state.song_dance = (unit_flag&(UF_DANCE|UF_SONG)?1:0)|(unit_flag&UF_ENSEMBLE?2:0); //Signals if this is a song/dance/duet
 
@@ -7147,14 +7157,14 @@ static int skill_unit_onplace (struct skill_unit *src, struct block_list *bl, un
 		return 0; //Hidden characters are immune to AoE skills except Heaven's Drive. [Skotlex]
 
 	type = status_skill2sc(sg->skill_id);
-	sce = (sc && type != -1)?sc->data[type]:NULL;
+	sce = (sc && type != -1)?sc_get(sc,type):NULL;
 	skillid = sg->skill_id; //In case the group is deleted, we need to return the correct skill id, still.
 	switch (sg->unit_id)
 	{
 	case UNT_SPIDERWEB:
-		if( sc && sc->data[SC_SPIDERWEB] && sc->data[SC_SPIDERWEB]->val1 > 0 )
+		if( sc && sc_get(sc,SC_SPIDERWEB) && sc_get(sc,SC_SPIDERWEB)->val1 > 0 )
 		{ // If you are fiberlocked and can't move, it will only increase your fireweakness level. [Inkfish]
-			sc->data[SC_SPIDERWEB]->val2++;
+			sc_get(sc,SC_SPIDERWEB)->val2++;
 			break;
 		}
 		else if( sc )
@@ -7162,9 +7172,9 @@ static int skill_unit_onplace (struct skill_unit *src, struct block_list *bl, un
 			int sec = skill_get_time2(sg->skill_id,sg->skill_lv);
 			if( status_change_start(bl,type,10000,sg->skill_lv,1,sg->group_id,0,sec,8) )
 			{
-				const struct TimerData* td = sc->data[type]?get_timer(sc->data[type]->timer):NULL; 
-				if( td )
-					sec = DIFF_TICK(td->tick, tick);
+				const struct status_change_entry* sce = sc_get(sc,type);
+				if( sce && sce->timed )
+					sec = DIFF_TICK(sce->tick, tick);
 				map_moveblock(bl, src->bl.x, src->bl.y, tick);
 				clif_fixpos(bl);
 				sg->val2 = bl->id;
@@ -7172,6 +7182,7 @@ static int skill_unit_onplace (struct skill_unit *src, struct block_list *bl, un
 			else
 				sec = 3000; //Couldn't trap it?
 			sg->limit = DIFF_TICK(tick,sg->tick)+sec;
+			skill_unit_schedule(sg, tick);
 		}
 		break;
 	case UNT_SAFETYWALL:
@@ -7239,7 +7250,7 @@ static int skill_unit_onplace (struct skill_unit *src, struct block_list *bl, un
 	case UNT_INTOABYSS:
 	case UNT_SIEGFRIED:
 		 //Needed to check when a dancer/bard leaves their ensemble area.
-		if (sg->src_id==bl->id && !(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER))
+		if (sg->src_id==bl->id && !(sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_BARDDANCER))
 			return skillid;
 		if (!sce)
 			sc_start4(bl,type,100,sg->skill_lv,sg->val1,sg->val2,0,sg->limit);
@@ -7252,7 +7263,7 @@ static int skill_unit_onplace (struct skill_unit *src, struct block_list *bl, un
 	case UNT_DONTFORGETME:
 	case UNT_FORTUNEKISS:
 	case UNT_SERVICEFORYOU:
-		if (sg->src_id==bl->id && !(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER))
+		if (sg->src_id==bl->id && !(sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_BARDDANCER))
 			return 0;
 		if (!sc) return 0;
 		if (!sce)
@@ -7260,8 +7271,7 @@ static int skill_unit_onplace (struct skill_unit *src, struct block_list *bl, un
 		else if (sce->val4 == 1) {
 			//Readjust timers since the effect will not last long.
 			sce->val4 = 0;
-			delete_timer(sce->timer, status_change_timer);
-			sce->timer = add_timer(tick+sg->limit, status_change_timer, bl->id, type);
+			status_change_settimer(bl, type, tick+sg->limit);
 		}
 		break;
 
@@ -7288,7 +7298,7 @@ static int skill_unit_onplace (struct skill_unit *src, struct block_list *bl, un
 
 	case UNT_MOONLIT:
 		//Knockback out of area if affected char isn't in Moonlit effect
-		if (sc && sc->data[SC_DANCING] && (sc->data[SC_DANCING]->val1&0xFFFF) == CG_MOONLIT)
+		if (sc && sc_get(sc,SC_DANCING) && (sc_get(sc,SC_DANCING)->val1&0xFFFF) == CG_MOONLIT)
 			break;
 		if (ss == bl) //Also needed to prevent infinite loop crash.
 			break;
@@ -7357,7 +7367,7 @@ int skill_unit_onplace_timer (struct skill_unit *src, struct block_list *bl, uns
 			ts->tick += sg->interval*(map_count_oncell(bl->m,bl->x,bl->y,BL_CHAR)-1);
 	}
 	//Temporarily set magic power to have it take effect. [Skotlex]
-	if (sg->state.magic_power && sc && !sc->data[SC_MAGICPOWER])
+	if (sg->state.magic_power && sc && !sc_get(sc,SC_MAGICPOWER))
 	{	//Store previous values.
 		swap(sstatus->matk_min, sc->mp_matk_min);
 		swap(sstatus->matk_max, sc->mp_matk_max);
@@ -7498,9 +7508,9 @@ int skill_unit_onplace_timer (struct skill_unit *src, struct block_list *bl, uns
 				int sec = skill_get_time2(sg->skill_id,sg->skill_lv);
 				if( status_change_start(bl,type,10000,sg->skill_lv,sg->group_id,0,0,sec, 8) )
 				{
-					const struct TimerData* td = tsc->data[type]?get_timer(tsc->data[type]->timer):NULL; 
-					if( td )
-						sec = DIFF_TICK(td->tick, tick);
+					const struct status_change_entry* sce = sc_get(tsc,type);
+					if( sce && sce->timed )
+						sec = DIFF_TICK(sce->tick, tick);
 					unit_movepos(bl, src->bl.x, src->bl.y, 0, 0);
 					clif_fixpos(bl);
 					sg->val2 = bl->id;
@@ -7515,7 +7525,7 @@ int skill_unit_onplace_timer (struct skill_unit *src, struct block_list *bl, uns
 			break;
 
 		case UNT_VENOMDUST:
-			if(tsc && !tsc->data[type])
+			if(tsc && !sc_get(tsc,type))
 				status_change_start(bl,type,10000,sg->skill_lv,sg->group_id,0,0,skill_get_time2(sg->skill_id,sg->skill_lv),8);
 			break;
 
@@ -7564,7 +7574,7 @@ int skill_unit_onplace_timer (struct skill_unit *src, struct block_list *bl, uns
 		case UNT_APPLEIDUN: //Apple of Idun [Skotlex]
 		{
 			int heal;
-			if( sg->src_id == bl->id && !(tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_BARDDANCER) )
+			if( sg->src_id == bl->id && !(tsc && sc_get(tsc,SC_SPIRIT) && sc_get(tsc,SC_SPIRIT)->val2 == SL_BARDDANCER) )
 				break; // affects self only when soullinked
 			heal = skill_calc_heal(ss,bl,sg->skill_id, sg->skill_lv, true);
 			clif_skill_nodamage(&src->bl, bl, AL_HEAL, heal, 1);
@@ -7710,7 +7720,7 @@ int skill_unit_onplace_timer (struct skill_unit *src, struct block_list *bl, uns
 			break;
 	}
 
-	if (sg->state.magic_power && sc && !sc->data[SC_MAGICPOWER])
+	if (sg->state.magic_power && sc && !sc_get(sc,SC_MAGICPOWER))
 	{	//Unset magic power.
 		swap(sstatus->matk_min, sc->mp_matk_min);
 		swap(sstatus->matk_max, sc->mp_matk_max);
@@ -7736,7 +7746,7 @@ int skill_unit_onout (struct skill_unit *src, struct block_list *bl, unsigned in
 	nullpo_ret(sg=src->group);
 	sc = status_get_sc(bl);
 	type = status_skill2sc(sg->skill_id);
-	sce = (sc && type != -1)?sc->data[type]:NULL;
+	sce = (sc && type != -1)?sc_get(sc,type):NULL;
 
 	if( bl->prev==NULL ||
 		(status_isdead(bl) && sg->unit_id != UNT_ANKLESNARE && sg->unit_id != UNT_SPIDERWEB) ) //Need to delete the trap if the source died.
@@ -7767,6 +7777,7 @@ int skill_unit_onout (struct skill_unit *src, struct block_list *bl, unsigned in
 				if (sce && sce->val3 == sg->group_id)
 					status_change_end(bl, type, INVALID_TIMER);
 				sg->limit = DIFF_TICK(tick,sg->tick)+1000;
+				skill_unit_schedule(sg, tick);
 			}
 			break;
 		}
@@ -7788,7 +7799,7 @@ static int skill_unit_onleft (int skill_id, struct block_list *bl, unsigned int
 		sc = NULL;
 
 	type = status_skill2sc(skill_id);
-	sce = (sc && type != -1)?sc->data[type]:NULL;
+	sce = (sc && type != -1)?sc_get(sc,type):NULL;
 
 	switch (skill_id)
 	{
@@ -7807,7 +7818,7 @@ static int skill_unit_onleft (int skill_id, struct block_list *bl, unsigned int
 		case BD_ROKISWEIL:
 		case BD_INTOABYSS:
 		case BD_SIEGFRIED:
-			if(sc && sc->data[SC_DANCING] && (sc->data[SC_DANCING]->val1&0xFFFF) == skill_id)
+			if(sc && sc_get(sc,SC_DANCING) && (sc_get(sc,SC_DANCING)->val1&0xFFFF) == skill_id)
 			{	//Check if you just stepped out of your ensemble skill to cancel dancing. [Skotlex]
 				//We don't check for SC_LONGING because someone could always have knocked you back and out of the song/dance.
 				//FIXME: This code is not perfect, it doesn't checks for the real ensemble's owner,
@@ -7838,25 +7849,22 @@ static int skill_unit_onleft (int skill_id, struct block_list *bl, unsigned int
 		case DC_SERVICEFORYOU:
 			if (sce)
 			{
-				delete_timer(sce->timer, status_change_timer);
 				//NOTE: It'd be nice if we could get the skill_lv for a more accurate extra time, but alas...
 				//not possible on our current implementation.
 				sce->val4 = 1; //Store the fact that this is a "reduced" duration effect.
-				sce->timer = add_timer(tick+skill_get_time2(skill_id,1), status_change_timer, bl->id, type);
+				status_change_settimer(bl, type, tick+skill_get_time2(skill_id,1));
 			}
 			break;
 		case PF_FOGWALL:
 			if (sce)
 			{
 				status_change_end(bl, type, INVALID_TIMER);
-				if ((sce=sc->data[SC_BLIND]))
+				if ((sce=sc_get(sc,SC_BLIND)))
 				{
 					if (bl->type == BL_PC) //Players get blind ended inmediately, others have it still for 30 secs. [Skotlex]
 						status_change_end(bl, SC_BLIND, INVALID_TIMER);
-					else {
-						delete_timer(sce->timer, status_change_timer);
-						sce->timer = add_timer(30000+tick, status_change_timer, bl->id, SC_BLIND);
-					}
+					else
+						status_change_settimer(bl, SC_BLIND, 30000+tick);
 				}
 			}
 			break;
@@ -7975,7 +7983,7 @@ static int skill_check_condition_char_sub (struct block_list *bl, va_list ap)
 	if(pc_isdead(tsd))
 		return 0;
 
-	if (tsd->sc.data[SC_SILENCE] || tsd->sc.opt1)
+	if (sc_get(&tsd->sc,SC_SILENCE) || tsd->sc.opt1)
 		return 0;
 
 	switch(skillid)
@@ -8000,7 +8008,7 @@ static int skill_check_condition_char_sub (struct block_list *bl, va_list ap)
 						(tsd->weapontype1==W_MUSICAL || tsd->weapontype1==W_WHIP) &&
 						sd->status.party_id && tsd->status.party_id &&
 						sd->status.party_id == tsd->status.party_id &&
-						!tsd->sc.data[SC_DANCING])
+						!sc_get(&tsd->sc,SC_DANCING))
 				{
 					p_sd[(*c)++]=tsd->bl.id;
 					return skilllv;
@@ -8039,10 +8047,10 @@ int skill_check_pc_partner (struct map_session_data *sd, short skill_id, short*
 				}
 				return c;
 			default: //Warning: Assuming Ensemble skills here (for speed)
-				if (c > 0 && sd->sc.data[SC_DANCING] && (tsd = map_id2sd(p_sd[0])) != NULL)
+				if (c > 0 && sc_get(&sd->sc,SC_DANCING) && (tsd = map_id2sd(p_sd[0])) != NULL)
 				{
-					sd->sc.data[SC_DANCING]->val4 = tsd->bl.id;
-					sc_start4(&tsd->bl,SC_DANCING,100,skill_id,sd->sc.data[SC_DANCING]->val2,*skill_lv,sd->bl.id,skill_get_time(skill_id,*skill_lv)+1000);
+					sc_get(&sd->sc,SC_DANCING)->val4 = tsd->bl.id;
+					sc_start4(&tsd->bl,SC_DANCING,100,skill_id,sc_get(&sd->sc,SC_DANCING)->val2,*skill_lv,sd->bl.id,skill_get_time(skill_id,*skill_lv)+1000);
 					clif_skill_nodamage(&tsd->bl, &sd->bl, skill_id, *skill_lv, 1);
 					tsd->skillid_dance = skill_id;
 					tsd->skilllv_dance = *skill_lv;
@@ -8155,7 +8163,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 			}
 			//Consume
 			sd->itemid = sd->itemindex = -1;
-			if( skill == WZ_EARTHSPIKE && sc && sc->data[SC_EARTHSCROLL] && rand()%100 > sc->data[SC_EARTHSCROLL]->val2 ) // [marquis007]
+			if( skill == WZ_EARTHSPIKE && sc && sc_get(sc,SC_EARTHSCROLL) && rand()%100 > sc_get(sc,SC_EARTHSCROLL)->val2 ) // [marquis007]
 				; //Do not consume item.
 			else if( sd->status.inventory[i].expire_time == 0 )
 				pc_delitem(sd,i,1,0,0); // Rental usable items are not consumed until expiration
@@ -8175,7 +8183,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 	case ML_AUTOGUARD:		case CR_DEFENDER:	case ML_DEFENDER:		case ST_CHASEWALK:		case PA_GOSPEL:
 	case CR_SHRINK:			case TK_RUN:		case GS_GATLINGFEVER:	case TK_READYCOUNTER:	case TK_READYDOWN:
 	case TK_READYSTORM:		case TK_READYTURN:	case SG_FUSION:
-		if( sc && sc->data[status_skill2sc(skill)] )
+		if( sc && sc_get(sc,status_skill2sc(skill)) )
 			return 1;
 	}
 
@@ -8218,33 +8226,33 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 	case MO_CHAINCOMBO:
 		if(!sc)
 			return 0;
-		if(sc->data[SC_BLADESTOP])
+		if(sc_get(sc,SC_BLADESTOP))
 			break;
-		if(sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_TRIPLEATTACK)
+		if(sc_get(sc,SC_COMBO) && sc_get(sc,SC_COMBO)->val1 == MO_TRIPLEATTACK)
 			break;
 		return 0;
 	case MO_COMBOFINISH:
-		if(!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_CHAINCOMBO))
+		if(!(sc && sc_get(sc,SC_COMBO) && sc_get(sc,SC_COMBO)->val1 == MO_CHAINCOMBO))
 			return 0;
 		break;
 	case CH_TIGERFIST:
-		if(!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_COMBOFINISH))
+		if(!(sc && sc_get(sc,SC_COMBO) && sc_get(sc,SC_COMBO)->val1 == MO_COMBOFINISH))
 			return 0;
 		break;
 	case CH_CHAINCRUSH:
-		if(!(sc && sc->data[SC_COMBO]))
+		if(!(sc && sc_get(sc,SC_COMBO)))
 			return 0;
-		if(sc->data[SC_COMBO]->val1 != MO_COMBOFINISH && sc->data[SC_COMBO]->val1 != CH_TIGERFIST)
+		if(sc_get(sc,SC_COMBO)->val1 != MO_COMBOFINISH && sc_get(sc,SC_COMBO)->val1 != CH_TIGERFIST)
 			return 0;
 		break;
 	case MO_EXTREMITYFIST:
-//		if(sc && sc->data[SC_EXTREMITYFIST]) //To disable Asura during the 5 min skill block uncomment this...
+//		if(sc && sc_get(sc,SC_EXTREMITYFIST)) //To disable Asura during the 5 min skill block uncomment this...
 //			return 0;
-		if( sc && sc->data[SC_BLADESTOP] )
+		if( sc && sc_get(sc,SC_BLADESTOP) )
 			break;
-		if( sc && sc->data[SC_COMBO] )
+		if( sc && sc_get(sc,SC_COMBO) )
 		{
-			switch(sc->data[SC_COMBO]->val1) {
+			switch(sc_get(sc,SC_COMBO)->val1) {
 				case MO_COMBOFINISH:
 				case CH_TIGERFIST:
 				case CH_CHAINCRUSH:
@@ -8286,18 +8294,18 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 	case TK_COUNTER:
 		if ((sd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER)
 			return 0; //Anti-Soul Linker check in case you job-changed with Stances active.
-		if(!(sc && sc->data[SC_COMBO]))
+		if(!(sc && sc_get(sc,SC_COMBO)))
 			return 0; //Combo needs to be ready
 
-		if (sc->data[SC_COMBO]->val3)
+		if (sc_get(sc,SC_COMBO)->val3)
 		{	//Kick chain
 			//Do not repeat a kick.
-			if (sc->data[SC_COMBO]->val3 != skill)
+			if (sc_get(sc,SC_COMBO)->val3 != skill)
 				break;
 			status_change_end(&sd->bl, SC_COMBO, INVALID_TIMER);
 			return 0;
 		}
-		if(sc->data[SC_COMBO]->val1 != skill)
+		if(sc_get(sc,SC_COMBO)->val1 != skill)
 		{	//Cancel combo wait.
 			unit_cancel_combo(&sd->bl);
 			return 0;
@@ -8306,15 +8314,15 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 	case BD_ADAPTATION:
 		{
 			int time;
-			if(!(sc && sc->data[SC_DANCING]))
+			if(!(sc && sc_get(sc,SC_DANCING)))
 			{
 				clif_skill_fail(sd,skill,USESKILL_FAIL_LEVEL,0);
 				return 0;
 			}
-			time = 1000*(sc->data[SC_DANCING]->val3>>16);
+			time = 1000*(sc_get(sc,SC_DANCING)->val3>>16);
 			if (skill_get_time(
-				(sc->data[SC_DANCING]->val1&0xFFFF), //Dance Skill ID
-				(sc->data[SC_DANCING]->val1>>16)) //Dance Skill LV
+				(sc_get(sc,SC_DANCING)->val1&0xFFFF), //Dance Skill ID
+				(sc_get(sc,SC_DANCING)->val1>>16)) //Dance Skill LV
 				- time < skill_get_time2(skill,lv))
 			{
 				clif_skill_fail(sd,skill,USESKILL_FAIL_LEVEL,0);
@@ -8332,12 +8340,12 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 		break;
 
 	case SL_SMA:
-		if(!(sc && sc->data[SC_SMA]))
+		if(!(sc && sc_get(sc,SC_SMA)))
 			return 0;
 		break;
 
 	case HT_POWER:
-		if(!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill))
+		if(!(sc && sc_get(sc,SC_COMBO) && sc_get(sc,SC_COMBO)->val1 == skill))
 			return 0;
 		break;
 
@@ -8383,7 +8391,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 	case SG_SUN_WARM:
 	case SG_MOON_WARM:
 	case SG_STAR_WARM:
-		if (sc && sc->data[SC_MIRACLE])
+		if (sc && sc_get(sc,SC_MIRACLE))
 			break;
 		i = skill-SG_SUN_WARM;
 		if (sd->bl.m == sd->feel_map[i].m)
@@ -8394,7 +8402,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 	case SG_SUN_COMFORT:
 	case SG_MOON_COMFORT:
 	case SG_STAR_COMFORT:
-		if (sc && sc->data[SC_MIRACLE])
+		if (sc && sc_get(sc,SC_MIRACLE))
 			break;
 		i = skill-SG_SUN_COMFORT;
 		if (sd->bl.m == sd->feel_map[i].m &&
@@ -8403,7 +8411,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 		clif_skill_fail(sd,skill,USESKILL_FAIL_LEVEL,0);
 		return 0;
 	case SG_FUSION:
-		if (sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_STAR)
+		if (sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_STAR)
 			break;
 		//Auron insists we should implement SP consumption when you are not Soul Linked. [Skotlex]
 		//Only invoke on skill begin cast (instant cast skill). [Kevin]
@@ -8441,7 +8449,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 			return 0;
 		}
 	case NJ_BUNSINJYUTSU:
-		if (!(sc && sc->data[SC_NEN])) {
+		if (!(sc && sc_get(sc,SC_NEN))) {
 			clif_skill_fail(sd,skill,USESKILL_FAIL_LEVEL,0);
 			return 0;
 	  	}
@@ -8504,7 +8512,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 		}
 		break;
 	case ST_CARTBOOST:
-		if(!(sc && sc->data[SC_CARTBOOST])) {
+		if(!(sc && sc_get(sc,SC_CARTBOOST))) {
 			clif_skill_fail(sd,skill,USESKILL_FAIL_LEVEL,0);
 			return 0;
 		}
@@ -8521,13 +8529,13 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 		}
 		break;
 	case ST_SIGHT:
-		if(!(sc && sc->data[SC_SIGHT])) {
+		if(!(sc && sc_get(sc,SC_SIGHT))) {
 			clif_skill_fail(sd,skill,USESKILL_FAIL_LEVEL,0);
 			return 0;
 		}
 		break;
 	case ST_EXPLOSIONSPIRITS:
-		if(!(sc && sc->data[SC_EXPLOSIONSPIRITS])) {
+		if(!(sc && sc_get(sc,SC_EXPLOSIONSPIRITS))) {
 			clif_skill_fail(sd,skill,USESKILL_FAIL_LEVEL,0);
 			return 0;
 		}
@@ -8539,7 +8547,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 		}
 		break;
 	case ST_MOVE_ENABLE:
-		if (sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill)
+		if (sc && sc_get(sc,SC_COMBO) && sc_get(sc,SC_COMBO)->val1 == skill)
 			sd->ud.canmove_tick = gettick(); //When using a combo, cancel the can't move delay to enable the skill. [Skotlex]
 
 		if (!unit_can_move(&sd->bl)) {
@@ -8548,7 +8556,7 @@ int skill_check_condition_castbegin(struct map_session_data* sd, short skill, sh
 		}
 		break;
 	case ST_WATER:
-		if (sc && (sc->data[SC_DELUGE] || sc->data[SC_SUITON]))
+		if (sc && (sc_get(sc,SC_DELUGE) || sc_get(sc,SC_SUITON)))
 			break;
 		if (map_getcell(sd->bl.m,sd->bl.x,sd->bl.y,CELL_CHKWATER))
 			break;
@@ -8743,7 +8751,7 @@ int skill_consume_requirement( struct map_session_data *sd, short skill, short l
 			if( !req.itemid[i] )
 				continue;
 
-			if( itemid_isgemstone(req.itemid[i]) && skill != HW_GANBANTEIN && sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_WIZARD )
+			if( itemid_isgemstone(req.itemid[i]) && skill != HW_GANBANTEIN && sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_WIZARD )
 				continue; //Gemstones are checked, but not substracted from inventory.
 
 			if( (n = pc_search_inventory(sd,req.itemid[i])) >= 0 )
@@ -8779,7 +8787,7 @@ struct skill_condition skill_get_requirement(struct map_session_data* sd, short
 	case ML_AUTOGUARD:		case CR_DEFENDER:	case ML_DEFENDER:		case ST_CHASEWALK:		case PA_GOSPEL:
 	case CR_SHRINK:			case TK_RUN:		case GS_GATLINGFEVER:	case TK_READYCOUNTER:	case TK_READYDOWN:
 	case TK_READYSTORM:		case TK_READYTURN:	case SG_FUSION:
-		if( sc && sc->data[status_skill2sc(skill)] )
+		if( sc && sc_get(sc,status_skill2sc(skill)) )
 			return req;
 	}
 
@@ -8856,7 +8864,7 @@ struct skill_condition skill_get_requirement(struct map_session_data* sd, short
 				if( --req.amount[i] < 1 )
 					req.itemid[i] = 0;
 			}
-			if(sc && sc->data[SC_INTOABYSS])
+			if(sc && sc_get(sc,SC_INTOABYSS))
 			{
 				if( skill != SA_ABRACADABRA )
 					req.itemid[i] = req.amount[i] = 0;
@@ -8873,7 +8881,7 @@ struct skill_condition skill_get_requirement(struct map_session_data* sd, short
 				req.zeny -= req.zeny*10/100;
 			break;
 		case AL_HOLYLIGHT:
-			if(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_PRIEST)
+			if(sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_PRIEST)
 				req.sp *= 5;
 			break;
 		case SL_SMA:
@@ -8897,21 +8905,21 @@ struct skill_condition skill_get_requirement(struct map_session_data* sd, short
 		case MO_COMBOFINISH:
 		case CH_TIGERFIST:
 		case CH_CHAINCRUSH:
-			if(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_MONK)
+			if(sc && sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_MONK)
 				req.sp -= req.sp*25/100; //FIXME: Need real data. this is a custom value.
 			break;
 		case MO_BODYRELOCATION:
-			if( sc && sc->data[SC_EXPLOSIONSPIRITS] )
+			if( sc && sc_get(sc,SC_EXPLOSIONSPIRITS) )
 				req.spiritball = 0;
 			break;
 		case MO_EXTREMITYFIST:
 			if( sc )
 			{
-				if( sc->data[SC_BLADESTOP] )
+				if( sc_get(sc,SC_BLADESTOP) )
 					req.spiritball--;
-				else if( sc->data[SC_COMBO] )
+				else if( sc_get(sc,SC_COMBO) )
 				{
-					switch( sc->data[SC_COMBO]->val1 )
+					switch( sc_get(sc,SC_COMBO)->val1 )
 					{
 						case MO_COMBOFINISH:
 							req.spiritball = 4;
@@ -8983,19 +8991,19 @@ int skill_castfix_sc (struct block_list *bl, int time)
 	struct status_change *sc = status_get_sc(bl);
 
 	if (sc && sc->count) {
-		if (sc->data[SC_SLOWCAST])
-			time += time * sc->data[SC_SLOWCAST]->val2 / 100;
-		if (sc->data[SC_SUFFRAGIUM]) {
-			time -= time * sc->data[SC_SUFFRAGIUM]->val2 / 100;
+		if (sc_get(sc,SC_SLOWCAST))
+			time += time * sc_get(sc,SC_SLOWCAST)->val2 / 100;
+		if (sc_get(sc,SC_SUFFRAGIUM)) {
+			time -= time * sc_get(sc,SC_SUFFRAGIUM)->val2 / 100;
 			status_change_end(bl, SC_SUFFRAGIUM, INVALID_TIMER);
 		}
-		if (sc->data[SC_MEMORIZE]) {
+		if (sc_get(sc,SC_MEMORIZE)) {
 			time>>=1;
-			if ((--sc->data[SC_MEMORIZE]->val2) <= 0)
+			if ((--sc_get(sc,SC_MEMORIZE)->val2) <= 0)
 				status_change_end(bl, SC_MEMORIZE, INVALID_TIMER);
 		}
-		if (sc->data[SC_POEMBRAGI])
-			time -= time * sc->data[SC_POEMBRAGI]->val2 / 100;
+		if (sc_get(sc,SC_POEMBRAGI))
+			time -= time * sc_get(sc,SC_POEMBRAGI)->val2 / 100;
 	}
 	return (time > 0) ? time : 0;
 }
@@ -9033,7 +9041,7 @@ int skill_delayfix (struct block_list *bl, int skill_id, int skill_lv)
 		time -= 4*status_get_agi(bl) - 2*status_get_dex(bl);
 		break;
 	case HP_BASILICA:
-		if( sc && !sc->data[SC_BASILICA] )
+		if( sc && !sc_get(sc,SC_BASILICA) )
 			time = 0; // There is no Delay on Basilica creation, only on cancel
 		break;
 	default:
@@ -9055,15 +9063,15 @@ int skill_delayfix (struct block_list *bl, int skill_id, int skill_lv)
 		}
 	}
 
-	if ( sc && sc->data[SC_SPIRIT] )
+	if ( sc && sc_get(sc,SC_SPIRIT) )
 	{
 		switch (skill_id) {
 			case CR_SHIELDBOOMERANG:
-				if (sc->data[SC_SPIRIT]->val2 == SL_CRUSADER)
+				if (sc_get(sc,SC_SPIRIT)->val2 == SL_CRUSADER)
 					time /= 2;
 				break;
 			case AS_SONICBLOW:
-				if (!map_flag_gvg(bl->m) && !map[bl->m].flag.battleground && sc->data[SC_SPIRIT]->val2 == SL_ASSASIN)
+				if (!map_flag_gvg(bl->m) && !map[bl->m].flag.battleground && sc_get(sc,SC_SPIRIT)->val2 == SL_ASSASIN)
 					time /= 2;
 				break;
 		}
@@ -9072,8 +9080,8 @@ int skill_delayfix (struct block_list *bl, int skill_id, int skill_lv)
 	if (!(delaynodex&2))
 	{
 		if (sc && sc->count) {
-			if (sc->data[SC_POEMBRAGI])
-				time -= time * sc->data[SC_POEMBRAGI]->val3 / 100;
+			if (sc_get(sc,SC_POEMBRAGI))
+				time -= time * sc_get(sc,SC_POEMBRAGI)->val3 / 100;
 		}
 	}
 
@@ -9420,7 +9428,7 @@ int skill_autospell (struct map_session_data *sd, int skillid)
 
 	if(skillid==MG_NAPALMBEAT)	maxlv=3;
 	else if(skillid==MG_COLDBOLT || skillid==MG_FIREBOLT || skillid==MG_LIGHTNINGBOLT){
-		if (sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SAGE)
+		if (sc_get(&sd->sc,SC_SPIRIT) && sc_get(&sd->sc,SC_SPIRIT)->val2 == SL_SAGE)
 			maxlv =10; //Soul Linker bonus. [Skotlex]
 		else if(skilllv==2) maxlv=1;
 		else if(skilllv==3) maxlv=2;
@@ -9904,7 +9912,7 @@ int skill_enchant_elemental_end (struct block_list *bl, int type)
 	if (!sc->count) return 0;
 
 	for (i = 0; i < ARRAYLENGTH(scs); i++)
-		if (type != scs[i] && sc->data[scs[i]])
+		if (type != scs[i] && sc_get(sc,scs[i]))
 			status_change_end(bl, scs[i], INVALID_TIMER);
 
 	return 0;
@@ -10145,6 +10153,8 @@ struct skill_unit_group* skill_initunitgroup (struct block_list* src, int count,
 		group->tick += 1500;
 
 	idb_put(group_db, group->group_id, group);
+	group->wheel_prev = NULL;
+	skill_unit_schedule(group, gettick());
 	return group;
 }
 
@@ -10172,9 +10182,9 @@ int skill_delunitgroup_(struct skill_unit_group *group, const char* file, int li
 	if (skill_get_unit_flag(group->skill_id)&(UF_DANCE|UF_SONG|UF_ENSEMBLE))
 	{
 		struct status_change* sc = status_get_sc(src);
-		if (sc && sc->data[SC_DANCING])
+		if (sc && sc_get(sc,SC_DANCING))
 		{
-			sc->data[SC_DANCING]->val2 = 0 ; //This prevents status_change_end attempting to redelete the group. [Skotlex]
+			sc_get(sc,SC_DANCING)->val2 = 0 ; //This prevents status_change_end attempting to redelete the group. [Skotlex]
 			status_change_end(src, SC_DANCING, INVALID_TIMER);
 		}
 	}
@@ -10183,8 +10193,8 @@ int skill_delunitgroup_(struct skill_unit_group *group, const char* file, int li
 	// (needs to be done when the group is deleted by other means than skill deactivation)
 	if (group->unit_id == UNT_GOSPEL) {
 		struct status_change *sc = status_get_sc(src);
-		if(sc && sc->data[SC_GOSPEL]) {
-			sc->data[SC_GOSPEL]->val3 = 0; //Remove reference to this group. [Skotlex]
+		if(sc && sc_get(sc,SC_GOSPEL)) {
+			sc_get(sc,SC_GOSPEL)->val3 = 0; //Remove reference to this group. [Skotlex]
 			status_change_end(src, SC_GOSPEL, INVALID_TIMER);
 		}
 	}
@@ -10193,8 +10203,8 @@ int skill_delunitgroup_(struct skill_unit_group *group, const char* file, int li
 		group->skill_id == SG_MOON_WARM ||
 		group->skill_id == SG_STAR_WARM) {
 		struct status_change *sc = status_get_sc(src);
-		if(sc && sc->data[SC_WARM]) {
-			sc->data[SC_WARM]->val4 = 0;
+		if(sc && sc_get(sc,SC_WARM)) {
+			sc_get(sc,SC_WARM)->val4 = 0;
 			status_change_end(src, SC_WARM, INVALID_TIMER);
 		}
 	}
@@ -10217,6 +10227,7 @@ int skill_delunitgroup_(struct skill_unit_group *group, const char* file, int li
 	}
 
 	idb_remove(group_db, group->group_id);
+	skill_unit_schedule(group, 0);
 	map_freeblock(&group->unit->bl); // schedules deallocation of whole array (HACK)
 	group->unit=NULL;
 	group->group_id=0;
@@ -10321,11 +10332,9 @@ int skill_unit_timer_sub_onplace (struct block_list* bl, va_list ap)
 /*==========================================
  *
  *------------------------------------------*/
-static int skill_unit_timer_sub (DBKey key, void* data, va_list ap)
+static int skill_unit_timer_sub (struct skill_unit* unit, unsigned int tick)
 {
-	struct skill_unit* unit = (struct skill_unit*)data;
 	struct skill_unit_group* group = unit->group;
-	unsigned int tick = va_arg(ap,unsigned int);
   	bool dissonance;
 	struct block_list* bl = &unit->bl;
 
@@ -10474,14 +10483,144 @@ static int skill_unit_timer_sub (DBKey key, void* data, va_list ap)
 
 	return 0;
 }
+
+/*==========================================
+ * Puts a unit group in the bucket of the skill unit timer run
+ * that is due at due_tick. Code that shortens the limit of a group
+ * has to reschedule it, since groups that don't look for targets
+ * are only visited when they expire.
+ * A group that is being deleted is taken out with due_tick 0.
+ *------------------------------------------*/
+void skill_unit_schedule(struct skill_unit_group* group, unsigned int due_tick)
+{
+	int diff, slot;
+
+	nullpo_retv(group);
+
+	if( group->wheel_prev != NULL )
+	{// unlink
+		*group->wheel_prev = group->wheel_next;
+		if( group->wheel_next )
+			group->wheel_next->wheel_prev = group->wheel_prev;
+		group->wheel_next = NULL;
+		group->wheel_prev = NULL;
+	}
+	if( group->group_id == 0 || due_tick == 0 )
+		return;
+
+	// first bucket that is not earlier than due_tick (at least the next one)
+	diff = DIFF_TICK(due_tick, skillunit_wheel_tick);
+	slot = ( diff <= SKILLUNITTIMER_INTERVAL ) ? 1 : (diff + SKILLUNITTIMER_INTERVAL - 1)/SKILLUNITTIMER_INTERVAL;
+	if( slot >= SKILLUNIT_WHEEL_SIZE )
+		slot = SKILLUNIT_WHEEL_SIZE - 1; // looked at again one turn later
+	slot = (skillunit_wheel_pos + slot)%SKILLUNIT_WHEEL_SIZE;
+
+	group->due_tick = due_tick;
+	group->wheel_next = skillunit_wheel[slot];
+	group->wheel_prev = &skillunit_wheel[slot];
+	if( group->wheel_next )
+		group->wheel_next->wheel_prev = &group->wheel_next;
+	skillunit_wheel[slot] = group;
+}
+
+/*==========================================
+ * Next time the skill unit timer has to look at a unit group.
+ * Groups that look for targets in range, songs and dances, ice walls
+ * and traps are checked on every run, the rest only when one of their
+ * units expires.
+ *------------------------------------------*/
+static unsigned int skill_unit_next_due(struct skill_unit_group* group, unsigned int tick)
+{
+	int i, limit = group->limit;
+
+	if( group->state.song_dance&0x1 )
+		return tick + SKILLUNITTIMER_INTERVAL; // overlapped cells deal Dissonance/Ugly Dance damage through skill_dance_switch
+
+	switch( group->unit_id )
+	{
+	case UNT_ICEWALL:
+	case UNT_SKIDTRAP:
+	case UNT_LANDMINE:
+	case UNT_SHOCKWAVE:
+	case UNT_SANDMAN:
+	case UNT_FLASHER:
+	case UNT_FREEZINGTRAP:
+	case UNT_TALKIEBOX:
+	case UNT_ANKLESNARE:
+		return tick + SKILLUNITTIMER_INTERVAL;
+	}
+
+	for( i = 0; i < group->unit_count; i++ )
+	{
+		struct skill_unit* unit = &group->unit[i];
+		if( !unit->alive )
+			continue;
+		if( unit->range >= 0 && group->interval != -1 )
+			return tick + SKILLUNITTIMER_INTERVAL;
+		if( unit->limit < limit )
+			limit = unit->limit;
+	}
+
+	return group->tick + limit;
+}
+
 /*==========================================
- * Executes on all skill units every SKILLUNITTIMER_INTERVAL miliseconds.
+ * Executes on the skill units of the groups that are due,
+ * every SKILLUNITTIMER_INTERVAL miliseconds.
  *------------------------------------------*/
 int skill_unit_timer(int tid, unsigned int tick, int id, intptr_t data)
 {
+	struct skill_unit_group* group;
+	int i, j, count = 0;
+
 	map_freeblock_lock();
 
-	skillunit_db->foreach(skillunit_db, skill_unit_timer_sub, tick);
+	// take out the groups of the buckets that have passed, the ones that aren't due yet go back in
+	for( i = 0; i < SKILLUNIT_WHEEL_SIZE && DIFF_TICK(tick, skillunit_wheel_tick) >= SKILLUNITTIMER_INTERVAL; i++ )
+	{
+		skillunit_wheel_pos = (skillunit_wheel_pos + 1)%SKILLUNIT_WHEEL_SIZE;
+		skillunit_wheel_tick += SKILLUNITTIMER_INTERVAL;
+		group = skillunit_wheel[skillunit_wheel_pos];
+		skillunit_wheel[skillunit_wheel_pos] = NULL;
+		while( group )
+		{
+			struct skill_unit_group* next = group->wheel_next;
+			group->wheel_prev = NULL;
+			group->wheel_next = NULL;
+
+			if( DIFF_TICK(group->due_tick, tick) > 0 )
+				skill_unit_schedule(group, group->due_tick);
+			else
+			{
+				if( count == skillunit_due_max )
+				{
+					skillunit_due_max += 256;
+					RECREATE(skillunit_due, int, skillunit_due_max);
+				}
+				skillunit_due[count++] = group->group_id;
+			}
+			group = next;
+		}
+	}
+	if( i == SKILLUNIT_WHEEL_SIZE )
+		skillunit_wheel_tick = tick; // went around once after a long stall, catch up
+
+	for( i = 0; i < count; i++ )
+	{
+		int group_id = skillunit_due[i];
+
+		if( (group = skill_id2group(group_id)) == NULL )
+			continue; // deleted by an earlier group
+
+		for( j = 0; j < group->unit_count; j++ )
+		{
+			skill_unit_timer_sub(&group->unit[j], tick);
+			if( skill_id2group(group_id) != group )
+				break; // whole group expired
+		}
+		if( skill_id2group(group_id) == group )
+			skill_unit_schedule(group, skill_unit_next_due(group, tick));
+	}
 
 	map_freeblock_unlock();
 
@@ -10616,7 +10755,8 @@ int skill_unit_move (struct block_list *bl, unsigned int tick, int flag)
 		memset(skill_unit_temp, 0, sizeof(skill_unit_temp));
 	}
 
-	map_foreachincell(skill_unit_move_sub,bl->m,bl->x,bl->y,BL_SKILL,bl,tick,flag);
+	if( map_getcell(bl->m,bl->x,bl->y,CELL_CHKSKILLUNIT) )
+		map_foreachincell(skill_unit_move_sub,bl->m,bl->x,bl->y,BL_SKILL,bl,tick,flag);
 
 	if( flag&2 && flag&1 )
 	{	//Onplace, check any skill units you have left.
@@ -11875,7 +12015,7 @@ int do_init_skill (void)
 	skill_readdb();
 
 	group_db = idb_alloc(DB_OPT_BASE);
-	skillunit_db = idb_alloc(DB_OPT_BASE);
+	skillunit_db = idb_alloc(DB_OPT_OPEN_HASH);
 	skill_unit_ers = ers_new(sizeof(struct skill_unit_group));
 	skill_timer_ers  = ers_new(sizeof(struct skill_timerskill));
 
@@ -11885,6 +12025,7 @@ int do_init_skill (void)
 	add_timer_func_list(skill_timerskill,"skill_timerskill");
 	add_timer_func_list(skill_blockpc_end, "skill_blockpc_end");
 
+	skillunit_wheel_tick = gettick();
 	add_timer_interval(gettick()+SKILLUNITTIMER_INTERVAL,skill_unit_timer,0,0,SKILLUNITTIMER_INTERVAL);
 
 	return 0;
@@ -11894,6 +12035,8 @@ int do_final_skill(void)
 {
 	db_destroy(skilldb_name2id);
 	db_destroy(group_db);
+	if( skillunit_due )
+		aFree(skillunit_due);
 	db_destroy(skillunit_db);
 	ers_destroy(skill_unit_ers);
 	ers_destroy(skill_timer_ers);
@@ -149,6 +149,8 @@ struct skill_unit_group {
 	int group_id;
 	int unit_count,alive_count;
 	struct skill_unit *unit;
+	unsigned int due_tick; // next time skill_unit_timer has to look at the group (see skill_unit_schedule)
+	struct skill_unit_group *wheel_next, **wheel_prev; // bucket list of the skill unit timer
 	struct {
 		unsigned ammo_consume : 1;
 		unsigned magic_power : 1;
@@ -278,6 +280,7 @@ int skill_break_equip(struct block_list *bl, unsigned short where, int rate, int
 int skill_strip_equip(struct block_list *bl, unsigned short where, int rate, int lv, int time);
 // jbgXL
 struct skill_unit_group* skill_id2group(int group_id);
+void skill_unit_schedule(struct skill_unit_group* group, unsigned int due_tick);
 struct skill_unit_group *skill_unitsetting(struct block_list* src, short skillid, short skilllv, short x, short y, int flag);
 struct skill_unit *skill_initunit (struct skill_unit_group *group, int idx, int x, int y, int val1, int val2);
 int skill_delunit(struct skill_unit *unit);
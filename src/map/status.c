@@ -713,13 +713,13 @@ int status_damage(struct block_list *src,struct block_list *target,int hp, int s
 //		return 0; //Cannot damage a bl not on a map, except when "charging" hp/sp
 
 	sc = status_get_sc(target);
-	if( hp && battle_config.invincible_nodamage && src && sc && sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+	if( hp && battle_config.invincible_nodamage && src && sc && sc_get(sc,SC_INVINCIBLE) && !sc_get(sc,SC_INVINCIBLEOFF) )
 		hp = 1;
 
 	if( hp && !(flag&1) ) {
 		if( sc ) {
 			struct status_change_entry *sce;
-			if (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+			if (sc_get(sc,SC_STONE) && sc->opt1 == OPT1_STONE)
 				status_change_end(target, SC_STONE, INVALID_TIMER);
 			status_change_end(target, SC_FREEZE, INVALID_TIMER);
 			status_change_end(target, SC_SLEEP, INVALID_TIMER);
@@ -729,13 +729,13 @@ int status_damage(struct block_list *src,struct block_list *target,int hp, int s
 			status_change_end(target, SC_HIDING, INVALID_TIMER);
 			status_change_end(target, SC_CLOAKING, INVALID_TIMER);
 			status_change_end(target, SC_CHASEWALK, INVALID_TIMER);
-			if ((sce=sc->data[SC_ENDURE]) && !sce->val4) {
+			if ((sce=sc_get(sc,SC_ENDURE)) && !sce->val4) {
 				//Endure count is only reduced by non-players on non-gvg maps.
 				//val4 signals infinite endure. [Skotlex]
 				if (src && src->type != BL_PC && !map_flag_gvg(target->m) && !map[target->m].flag.battleground && --(sce->val2) < 0)
 					status_change_end(target, SC_ENDURE, INVALID_TIMER);
 			}
-			if ((sce=sc->data[SC_GRAVITATION]) && sce->val3 == BCT_SELF)
+			if ((sce=sc_get(sc,SC_GRAVITATION)) && sce->val3 == BCT_SELF)
 			{
 				struct skill_unit_group* sg = skill_id2group(sce->val4);
 				if (sg) {
@@ -744,7 +744,7 @@ int status_damage(struct block_list *src,struct block_list *target,int hp, int s
 					status_change_end(target, SC_GRAVITATION, INVALID_TIMER);
 				}
 			}
-			if(sc->data[SC_DANCING] && (unsigned int)hp > status->max_hp>>2)
+			if(sc_get(sc,SC_DANCING) && (unsigned int)hp > status->max_hp>>2)
 				status_change_end(target, SC_DANCING, INVALID_TIMER);
 		}
 		unit_skillcastcancel(target, 2);
@@ -754,11 +754,11 @@ int status_damage(struct block_list *src,struct block_list *target,int hp, int s
 	status->sp-= sp;
 
 	if (sc && hp && status->hp) {
-		if (sc->data[SC_AUTOBERSERK] &&
-			(!sc->data[SC_PROVOKE] || !sc->data[SC_PROVOKE]->val2) &&
+		if (sc_get(sc,SC_AUTOBERSERK) &&
+			(!sc_get(sc,SC_PROVOKE) || !sc_get(sc,SC_PROVOKE)->val2) &&
 			status->hp < status->max_hp>>2)
 			sc_start4(target,SC_PROVOKE,100,10,1,0,0,0);
-		if (sc->data[SC_BERSERK] && status->hp <= 100)
+		if (sc_get(sc,SC_BERSERK) && status->hp <= 100)
 			status_change_end(target, SC_BERSERK, INVALID_TIMER);
 	}
 
@@ -814,14 +814,14 @@ int status_damage(struct block_list *src,struct block_list *target,int hp, int s
 		}
 	}
    
-	if( sc && sc->data[SC_KAIZEL] )
+	if( sc && sc_get(sc,SC_KAIZEL) )
 	{ //flag&8 = disable Kaizel
-		int time = skill_get_time2(SL_KAIZEL,sc->data[SC_KAIZEL]->val1);
+		int time = skill_get_time2(SL_KAIZEL,sc_get(sc,SC_KAIZEL)->val1);
 		//Look for Osiris Card's bonus effect on the character and revive 100% or revive normally
 		if ( target->type == BL_PC && BL_CAST(BL_PC,target)->special_state.restart_full_recover )
 			status_revive(target, 100, 100);
 		else
-			status_revive(target, sc->data[SC_KAIZEL]->val2, 0);
+			status_revive(target, sc_get(sc,SC_KAIZEL)->val2, 0);
 		status_change_clear(target,0);
 		clif_skill_nodamage(target,target,ALL_RESURRECTION,1,1);
 		sc_start(target,status_skill2sc(PR_KYRIE),100,10,time);
@@ -832,9 +832,9 @@ int status_damage(struct block_list *src,struct block_list *target,int hp, int s
 		return hp+sp;
 	}
 
-	if( target->type == BL_MOB && sc && sc->data[SC_REBIRTH] && !((TBL_MOB*)target)->state.rebirth )
+	if( target->type == BL_MOB && sc && sc_get(sc,SC_REBIRTH) && !((TBL_MOB*)target)->state.rebirth )
 	{// Ensure the monster has not already rebirthed before doing so.
-		status_revive(target, sc->data[SC_REBIRTH]->val2, 0);
+		status_revive(target, sc_get(sc,SC_REBIRTH)->val2, 0);
 		status_change_clear(target,0);
 		((TBL_MOB*)target)->state.rebirth = 1;
 
@@ -884,7 +884,7 @@ int status_heal(struct block_list *bl,int hp,int sp, int flag)
 	}
 
 	if(hp) {
-		if (!(flag&1) && sc && sc->data[SC_BERSERK])
+		if (!(flag&1) && sc && sc_get(sc,SC_BERSERK))
 			hp = 0;
 
 		if((unsigned int)hp > status->max_hp - status->hp)
@@ -908,9 +908,9 @@ int status_heal(struct block_list *bl,int hp,int sp, int flag)
 	status->sp+= sp;
 
 	if(hp && sc &&
-		sc->data[SC_AUTOBERSERK] &&
-		sc->data[SC_PROVOKE] &&
-		sc->data[SC_PROVOKE]->val2==1 &&
+		sc_get(sc,SC_AUTOBERSERK) &&
+		sc_get(sc,SC_PROVOKE) &&
+		sc_get(sc,SC_PROVOKE)->val2==1 &&
 		status->hp>=status->max_hp>>2
 	)	//End auto berserk.
 		status_change_end(bl, SC_PROVOKE, INVALID_TIMER);
@@ -1089,21 +1089,21 @@ int status_check_skilluse(struct block_list *src, struct block_list *target, int
 		}
 
 		if (
-			(sc->data[SC_TRICKDEAD] && skill_num != NV_TRICKDEAD)
-			|| (sc->data[SC_AUTOCOUNTER] && !flag)
-			|| (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF && skill_num != PA_GOSPEL)
-			|| (sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF && flag != 2)
+			(sc_get(sc,SC_TRICKDEAD) && skill_num != NV_TRICKDEAD)
+			|| (sc_get(sc,SC_AUTOCOUNTER) && !flag)
+			|| (sc_get(sc,SC_GOSPEL) && sc_get(sc,SC_GOSPEL)->val4 == BCT_SELF && skill_num != PA_GOSPEL)
+			|| (sc_get(sc,SC_GRAVITATION) && sc_get(sc,SC_GRAVITATION)->val3 == BCT_SELF && flag != 2)
 		)
 			return 0;
 
-		if (sc->data[SC_WINKCHARM] && target && !flag)
+		if (sc_get(sc,SC_WINKCHARM) && target && !flag)
 		{	//Prevents skill usage
 			clif_emotion(src, E_LV);
 			return 0;
 		}
 
-		if (sc->data[SC_BLADESTOP]) {
-			switch (sc->data[SC_BLADESTOP]->val1)
+		if (sc_get(sc,SC_BLADESTOP)) {
+			switch (sc_get(sc,SC_BLADESTOP)->val1)
 			{
 				case 5: if (skill_num == MO_EXTREMITYFIST) break;
 				case 4: if (skill_num == MO_CHAINCOMBO) break;
@@ -1113,9 +1113,9 @@ int status_check_skilluse(struct block_list *src, struct block_list *target, int
 			}
 		}
 
-		if (sc->data[SC_DANCING] && flag!=2)
+		if (sc_get(sc,SC_DANCING) && flag!=2)
 		{
-			if(sc->data[SC_LONGING])
+			if(sc_get(sc,SC_LONGING))
 			{	//Allow everything except dancing/re-dancing. [Skotlex]
 				if (skill_num == BD_ENCORE ||
 					skill_get_inf2(skill_num)&(INF2_SONG_DANCE|INF2_ENSEMBLE_SKILL)
@@ -1131,7 +1131,7 @@ int status_check_skilluse(struct block_list *src, struct block_list *target, int
 			default:
 				return 0;
 			}
-			if ((sc->data[SC_DANCING]->val1&0xFFFF) == CG_HERMODE && skill_num == BD_ADAPTATION)
+			if ((sc_get(sc,SC_DANCING)->val1&0xFFFF) == CG_HERMODE && skill_num == BD_ADAPTATION)
 				return 0;	//Can't amp out of Wand of Hermode :/ [Skotlex]
 		}
 
@@ -1139,20 +1139,20 @@ int status_check_skilluse(struct block_list *src, struct block_list *target, int
 			(src->type != BL_PC || ((TBL_PC*)src)->skillitem != skill_num)
 		) {	//Skills blocked through status changes...
 			if (!flag && ( //Blocked only from using the skill (stuff like autospell may still go through
-				sc->data[SC_SILENCE] ||
-				(sc->data[SC_MARIONETTE] && skill_num != CG_MARIONETTE) || //Only skill you can use is marionette again to cancel it
-				(sc->data[SC_MARIONETTE2] && skill_num == CG_MARIONETTE) || //Cannot use marionette if you are being buffed by another
-				sc->data[SC_STEELBODY] ||
-				sc->data[SC_BERSERK]
+				sc_get(sc,SC_SILENCE) ||
+				(sc_get(sc,SC_MARIONETTE) && skill_num != CG_MARIONETTE) || //Only skill you can use is marionette again to cancel it
+				(sc_get(sc,SC_MARIONETTE2) && skill_num == CG_MARIONETTE) || //Cannot use marionette if you are being buffed by another
+				sc_get(sc,SC_STEELBODY) ||
+				sc_get(sc,SC_BERSERK)
 			))
 				return 0;
 
 			//Skill blocking.
 			if (
-				(sc->data[SC_VOLCANO] && skill_num == WZ_ICEWALL) ||
-				(sc->data[SC_ROKISWEIL] && skill_num != BD_ADAPTATION) ||
-				(sc->data[SC_HERMODE] && skill_get_inf(skill_num) & INF_SUPPORT_SKILL) ||
-				(sc->data[SC_NOCHAT] && sc->data[SC_NOCHAT]->val1&MANNER_NOSKILL)
+				(sc_get(sc,SC_VOLCANO) && skill_num == WZ_ICEWALL) ||
+				(sc_get(sc,SC_ROKISWEIL) && skill_num != BD_ADAPTATION) ||
+				(sc_get(sc,SC_HERMODE) && skill_get_inf(skill_num) & INF_SUPPORT_SKILL) ||
+				(sc_get(sc,SC_NOCHAT) && sc_get(sc,SC_NOCHAT)->val1&MANNER_NOSKILL)
 			)
 				return 0;
 
@@ -1185,12 +1185,12 @@ int status_check_skilluse(struct block_list *src, struct block_list *target, int
 	
 	if(tsc && tsc->count)
 	{	
-		if(!skill_num && !(status->mode&MD_BOSS) && tsc->data[SC_TRICKDEAD])
+		if(!skill_num && !(status->mode&MD_BOSS) && sc_get(tsc,SC_TRICKDEAD))
 			return 0;
 		if((skill_num == WZ_STORMGUST || skill_num == WZ_FROSTNOVA || skill_num == NJ_HYOUSYOURAKU)
-			&& tsc->data[SC_FREEZE])
+			&& sc_get(tsc,SC_FREEZE))
 			return 0;
-		if(skill_num == PR_LEXAETERNA && (tsc->data[SC_FREEZE] || (tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)))
+		if(skill_num == PR_LEXAETERNA && (sc_get(tsc,SC_FREEZE) || (sc_get(tsc,SC_STONE) && tsc->opt1 == OPT1_STONE)))
 			return 0;
 	}
 
@@ -2035,9 +2035,9 @@ int status_calc_pc_(struct map_session_data* sd, bool first)
 		}
 	}
 
-	if( sc->count && sc->data[SC_ITEMSCRIPT] )
+	if( sc->count && sc_get(sc,SC_ITEMSCRIPT) )
 	{
-		struct item_data *data = itemdb_exists(sc->data[SC_ITEMSCRIPT]->val1);
+		struct item_data *data = itemdb_exists(sc_get(sc,SC_ITEMSCRIPT)->val1);
 		if( data && data->script )
 			run_script(data->script,0,sd->bl.id,0);
 	}
@@ -2346,8 +2346,8 @@ int status_calc_pc_(struct map_session_data* sd, bool first)
 		sd->max_weight += 2000*skill;
 	if(pc_isriding(sd) && pc_checkskill(sd,KN_RIDING)>0)
 		sd->max_weight += 10000;
-	if(sc->data[SC_KNOWLEDGE])
-		sd->max_weight += sd->max_weight*sc->data[SC_KNOWLEDGE]->val1/10;
+	if(sc_get(sc,SC_KNOWLEDGE))
+		sd->max_weight += sd->max_weight*sc_get(sc,SC_KNOWLEDGE)->val1/10;
 	if((skill=pc_checkskill(sd,ALL_INCCARRY))>0)
 		sd->max_weight += 2000*skill;
 
@@ -2360,11 +2360,11 @@ int status_calc_pc_(struct map_session_data* sd, bool first)
 	if((skill=pc_checkskill(sd,HP_MANARECHARGE))>0 )
 		sd->dsprate -= 4*skill;
 
-	if(sc->data[SC_SERVICE4U])
-		sd->dsprate -= sc->data[SC_SERVICE4U]->val3;
+	if(sc_get(sc,SC_SERVICE4U))
+		sd->dsprate -= sc_get(sc,SC_SERVICE4U)->val3;
 
-	if(sc->data[SC_SPCOST_RATE])
-		sd->dsprate -= sc->data[SC_SPCOST_RATE]->val1;
+	if(sc_get(sc,SC_SPCOST_RATE))
+		sd->dsprate -= sc_get(sc,SC_SPCOST_RATE)->val1;
 
 	//Underflow protections.
 	if(sd->dsprate < 0)
@@ -2394,13 +2394,13 @@ int status_calc_pc_(struct map_session_data* sd, bool first)
 	}
 
 	if(sc->count){
-     	if(sc->data[SC_CONCENTRATE])
+     	if(sc_get(sc,SC_CONCENTRATE))
 		{	//Update the card-bonus data
-			sc->data[SC_CONCENTRATE]->val3 = sd->param_bonus[1]; //Agi
-			sc->data[SC_CONCENTRATE]->val4 = sd->param_bonus[4]; //Dex
+			sc_get(sc,SC_CONCENTRATE)->val3 = sd->param_bonus[1]; //Agi
+			sc_get(sc,SC_CONCENTRATE)->val4 = sd->param_bonus[4]; //Dex
 		}
-     	if(sc->data[SC_SIEGFRIED]){
-			i = sc->data[SC_SIEGFRIED]->val2;
+     	if(sc_get(sc,SC_SIEGFRIED)){
+			i = sc_get(sc,SC_SIEGFRIED)->val2;
 			sd->subele[ELE_WATER] += i;
 			sd->subele[ELE_EARTH] += i;
 			sd->subele[ELE_FIRE] += i;
@@ -2411,23 +2411,23 @@ int status_calc_pc_(struct map_session_data* sd, bool first)
 			sd->subele[ELE_GHOST] += i;
 			sd->subele[ELE_UNDEAD] += i;
 		}
-		if(sc->data[SC_PROVIDENCE]){
-			sd->subele[ELE_HOLY] += sc->data[SC_PROVIDENCE]->val2;
-			sd->subrace[RC_DEMON] += sc->data[SC_PROVIDENCE]->val2;
+		if(sc_get(sc,SC_PROVIDENCE)){
+			sd->subele[ELE_HOLY] += sc_get(sc,SC_PROVIDENCE)->val2;
+			sd->subrace[RC_DEMON] += sc_get(sc,SC_PROVIDENCE)->val2;
 		}
-		if(sc->data[SC_ARMOR_ELEMENT])
+		if(sc_get(sc,SC_ARMOR_ELEMENT))
 		{	//This status change should grant card-type elemental resist.
-			sd->subele[ELE_WATER] += sc->data[SC_ARMOR_ELEMENT]->val1;
-			sd->subele[ELE_EARTH] += sc->data[SC_ARMOR_ELEMENT]->val2;
-			sd->subele[ELE_FIRE] += sc->data[SC_ARMOR_ELEMENT]->val3;
-			sd->subele[ELE_WIND] += sc->data[SC_ARMOR_ELEMENT]->val4;
+			sd->subele[ELE_WATER] += sc_get(sc,SC_ARMOR_ELEMENT)->val1;
+			sd->subele[ELE_EARTH] += sc_get(sc,SC_ARMOR_ELEMENT)->val2;
+			sd->subele[ELE_FIRE] += sc_get(sc,SC_ARMOR_ELEMENT)->val3;
+			sd->subele[ELE_WIND] += sc_get(sc,SC_ARMOR_ELEMENT)->val4;
 		}
-		if(sc->data[SC_ARMOR_RESIST])
+		if(sc_get(sc,SC_ARMOR_RESIST))
 		{ // Undead Scroll
-			sd->subele[ELE_WATER] += sc->data[SC_ARMOR_RESIST]->val1;
-			sd->subele[ELE_EARTH] += sc->data[SC_ARMOR_RESIST]->val2;
-			sd->subele[ELE_FIRE] += sc->data[SC_ARMOR_RESIST]->val3;
-			sd->subele[ELE_WIND] += sc->data[SC_ARMOR_RESIST]->val4;
+			sd->subele[ELE_WATER] += sc_get(sc,SC_ARMOR_RESIST)->val1;
+			sd->subele[ELE_EARTH] += sc_get(sc,SC_ARMOR_RESIST)->val2;
+			sd->subele[ELE_FIRE] += sc_get(sc,SC_ARMOR_RESIST)->val3;
+			sd->subele[ELE_WIND] += sc_get(sc,SC_ARMOR_RESIST)->val4;
 		}
 	}
 
@@ -2702,39 +2702,39 @@ void status_calc_regen_rate(struct block_list *bl, struct regen_data *regen, str
 		return;
 
 	if (
-		(sc->data[SC_POISON] && !sc->data[SC_SLOWPOISON])
-		|| (sc->data[SC_DPOISON] && !sc->data[SC_SLOWPOISON])
-		|| sc->data[SC_BERSERK]
-		|| sc->data[SC_TRICKDEAD]
-		|| sc->data[SC_BLEEDING]
+		(sc_get(sc,SC_POISON) && !sc_get(sc,SC_SLOWPOISON))
+		|| (sc_get(sc,SC_DPOISON) && !sc_get(sc,SC_SLOWPOISON))
+		|| sc_get(sc,SC_BERSERK)
+		|| sc_get(sc,SC_TRICKDEAD)
+		|| sc_get(sc,SC_BLEEDING)
 	)	//No regen
 		regen->flag = 0;
 
 	if (
-		sc->data[SC_DANCING]
+		sc_get(sc,SC_DANCING)
 		|| (
 			bl->type == BL_PC && (((TBL_PC*)bl)->class_&MAPID_UPPERMASK) == MAPID_MONK &&
-			(sc->data[SC_EXTREMITYFIST] || (sc->data[SC_EXPLOSIONSPIRITS] && (!sc->data[SC_SPIRIT] || sc->data[SC_SPIRIT]->val2 != SL_MONK)))
+			(sc_get(sc,SC_EXTREMITYFIST) || (sc_get(sc,SC_EXPLOSIONSPIRITS) && (!sc_get(sc,SC_SPIRIT) || sc_get(sc,SC_SPIRIT)->val2 != SL_MONK)))
 			)
-		|| sc->data[SC_MAXIMIZEPOWER]
+		|| sc_get(sc,SC_MAXIMIZEPOWER)
 	)	//No natural SP regen
 		regen->flag &=~RGN_SP;
 
 	if(
-		sc->data[SC_TENSIONRELAX]
+		sc_get(sc,SC_TENSIONRELAX)
 	  ) {
 		regen->rate.hp += 2;
 		if (regen->sregen)
 			regen->sregen->rate.hp += 3;
 	}
-	if (sc->data[SC_MAGNIFICAT])
+	if (sc_get(sc,SC_MAGNIFICAT))
 	{
 		regen->rate.hp += 1;
 		regen->rate.sp += 1;
 	}
-	if (sc->data[SC_REGENERATION])
+	if (sc_get(sc,SC_REGENERATION))
 	{
-		const struct status_change_entry *sce = sc->data[SC_REGENERATION];
+		const struct status_change_entry *sce = sc_get(sc,SC_REGENERATION);
 		if (!sce->val4)
 		{
 			regen->rate.hp += sce->val2;
@@ -3010,7 +3010,7 @@ void status_calc_bl_main(struct block_list *bl, /*enum scb_flag*/int flag)
 		status->matk_min = status_calc_matk(bl, sc, status->matk_min);
 		status->matk_max = status_calc_matk(bl, sc, status->matk_max);
 
-		if(sc->data[SC_MAGICPOWER]) { //Store current matk values
+		if(sc_get(sc,SC_MAGICPOWER)) { //Store current matk values
 			sc->mp_matk_min = status->matk_min;
 			sc->mp_matk_max = status->matk_max;
 		}
@@ -3234,37 +3234,37 @@ static unsigned short status_calc_str(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(str,0,USHRT_MAX);
 
-	if(sc->data[SC_INCALLSTATUS])
-		str += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCSTR])
-		str += sc->data[SC_INCSTR]->val1;
-	if(sc->data[SC_STRFOOD])
-		str += sc->data[SC_STRFOOD]->val1;
-	if(sc->data[SC_FOOD_STR_CASH])
-		str += sc->data[SC_FOOD_STR_CASH]->val1;
-	if(sc->data[SC_BATTLEORDERS])
+	if(sc_get(sc,SC_INCALLSTATUS))
+		str += sc_get(sc,SC_INCALLSTATUS)->val1;
+	if(sc_get(sc,SC_INCSTR))
+		str += sc_get(sc,SC_INCSTR)->val1;
+	if(sc_get(sc,SC_STRFOOD))
+		str += sc_get(sc,SC_STRFOOD)->val1;
+	if(sc_get(sc,SC_FOOD_STR_CASH))
+		str += sc_get(sc,SC_FOOD_STR_CASH)->val1;
+	if(sc_get(sc,SC_BATTLEORDERS))
 		str += 5;
-	if(sc->data[SC_GUILDAURA] && sc->data[SC_GUILDAURA]->val3>>16)
-		str += (sc->data[SC_GUILDAURA]->val3)>>16;
-	if(sc->data[SC_LOUD])
+	if(sc_get(sc,SC_GUILDAURA) && sc_get(sc,SC_GUILDAURA)->val3>>16)
+		str += (sc_get(sc,SC_GUILDAURA)->val3)>>16;
+	if(sc_get(sc,SC_LOUD))
 		str += 4;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_get(sc,SC_TRUESIGHT))
 		str += 5;
-	if(sc->data[SC_SPURT])
+	if(sc_get(sc,SC_SPURT))
 		str += 10;
-	if(sc->data[SC_NEN])
-		str += sc->data[SC_NEN]->val1;
-	if(sc->data[SC_BLESSING]){
-		if(sc->data[SC_BLESSING]->val2)
-			str += sc->data[SC_BLESSING]->val2;
+	if(sc_get(sc,SC_NEN))
+		str += sc_get(sc,SC_NEN)->val1;
+	if(sc_get(sc,SC_BLESSING)){
+		if(sc_get(sc,SC_BLESSING)->val2)
+			str += sc_get(sc,SC_BLESSING)->val2;
 		else
 			str >>= 1;
 	}
-	if(sc->data[SC_MARIONETTE])
-		str -= ((sc->data[SC_MARIONETTE]->val3)>>16)&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		str += ((sc->data[SC_MARIONETTE2]->val3)>>16)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH && str < 50)
+	if(sc_get(sc,SC_MARIONETTE))
+		str -= ((sc_get(sc,SC_MARIONETTE)->val3)>>16)&0xFF;
+	if(sc_get(sc,SC_MARIONETTE2))
+		str += ((sc_get(sc,SC_MARIONETTE2)->val3)>>16)&0xFF;
+	if(sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_HIGH && str < 50)
 		str = 50;
 
 	return (unsigned short)cap_value(str,0,USHRT_MAX);
@@ -3275,35 +3275,35 @@ static unsigned short status_calc_agi(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(agi,0,USHRT_MAX);
 
-	if(sc->data[SC_CONCENTRATE] && !sc->data[SC_QUAGMIRE])
-		agi += (agi-sc->data[SC_CONCENTRATE]->val3)*sc->data[SC_CONCENTRATE]->val2/100;
-	if(sc->data[SC_INCALLSTATUS])
-		agi += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCAGI])
-		agi += sc->data[SC_INCAGI]->val1;
-	if(sc->data[SC_AGIFOOD])
-		agi += sc->data[SC_AGIFOOD]->val1;
-	if(sc->data[SC_FOOD_AGI_CASH])
-		agi += sc->data[SC_FOOD_AGI_CASH]->val1;
-	if(sc->data[SC_GUILDAURA] && (sc->data[SC_GUILDAURA]->val4)>>16)
-		agi += (sc->data[SC_GUILDAURA]->val4)>>16;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_get(sc,SC_CONCENTRATE) && !sc_get(sc,SC_QUAGMIRE))
+		agi += (agi-sc_get(sc,SC_CONCENTRATE)->val3)*sc_get(sc,SC_CONCENTRATE)->val2/100;
+	if(sc_get(sc,SC_INCALLSTATUS))
+		agi += sc_get(sc,SC_INCALLSTATUS)->val1;
+	if(sc_get(sc,SC_INCAGI))
+		agi += sc_get(sc,SC_INCAGI)->val1;
+	if(sc_get(sc,SC_AGIFOOD))
+		agi += sc_get(sc,SC_AGIFOOD)->val1;
+	if(sc_get(sc,SC_FOOD_AGI_CASH))
+		agi += sc_get(sc,SC_FOOD_AGI_CASH)->val1;
+	if(sc_get(sc,SC_GUILDAURA) && (sc_get(sc,SC_GUILDAURA)->val4)>>16)
+		agi += (sc_get(sc,SC_GUILDAURA)->val4)>>16;
+	if(sc_get(sc,SC_TRUESIGHT))
 		agi += 5;
-	if(sc->data[SC_INCREASEAGI])
-		agi += sc->data[SC_INCREASEAGI]->val2;
-	if(sc->data[SC_INCREASING])
+	if(sc_get(sc,SC_INCREASEAGI))
+		agi += sc_get(sc,SC_INCREASEAGI)->val2;
+	if(sc_get(sc,SC_INCREASING))
 		agi += 4;	// added based on skill updates [Reddozen]
-	if(sc->data[SC_DECREASEAGI])
-		agi -= sc->data[SC_DECREASEAGI]->val2;
-	if(sc->data[SC_QUAGMIRE])
-		agi -= sc->data[SC_QUAGMIRE]->val2;
-	if(sc->data[SC_SUITON] && sc->data[SC_SUITON]->val3)
-		agi -= sc->data[SC_SUITON]->val2;
-	if(sc->data[SC_MARIONETTE])
-		agi -= ((sc->data[SC_MARIONETTE]->val3)>>8)&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		agi += ((sc->data[SC_MARIONETTE2]->val3)>>8)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH && agi < 50)
+	if(sc_get(sc,SC_DECREASEAGI))
+		agi -= sc_get(sc,SC_DECREASEAGI)->val2;
+	if(sc_get(sc,SC_QUAGMIRE))
+		agi -= sc_get(sc,SC_QUAGMIRE)->val2;
+	if(sc_get(sc,SC_SUITON) && sc_get(sc,SC_SUITON)->val3)
+		agi -= sc_get(sc,SC_SUITON)->val2;
+	if(sc_get(sc,SC_MARIONETTE))
+		agi -= ((sc_get(sc,SC_MARIONETTE)->val3)>>8)&0xFF;
+	if(sc_get(sc,SC_MARIONETTE2))
+		agi += ((sc_get(sc,SC_MARIONETTE2)->val3)>>8)&0xFF;
+	if(sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_HIGH && agi < 50)
 		agi = 50;
 
 	return (unsigned short)cap_value(agi,0,USHRT_MAX);
@@ -3314,27 +3314,27 @@ static unsigned short status_calc_vit(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(vit,0,USHRT_MAX);
 
-	if(sc->data[SC_INCALLSTATUS])
-		vit += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCVIT])
-		vit += sc->data[SC_INCVIT]->val1;
-	if(sc->data[SC_VITFOOD])
-		vit += sc->data[SC_VITFOOD]->val1;
-	if(sc->data[SC_FOOD_VIT_CASH])
-		vit += sc->data[SC_FOOD_VIT_CASH]->val1;
-	if(sc->data[SC_CHANGE])
-		vit += sc->data[SC_CHANGE]->val2;
-	if(sc->data[SC_GUILDAURA] && sc->data[SC_GUILDAURA]->val3&0xFFFF)
-		vit += sc->data[SC_GUILDAURA]->val3&0xFFFF;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_get(sc,SC_INCALLSTATUS))
+		vit += sc_get(sc,SC_INCALLSTATUS)->val1;
+	if(sc_get(sc,SC_INCVIT))
+		vit += sc_get(sc,SC_INCVIT)->val1;
+	if(sc_get(sc,SC_VITFOOD))
+		vit += sc_get(sc,SC_VITFOOD)->val1;
+	if(sc_get(sc,SC_FOOD_VIT_CASH))
+		vit += sc_get(sc,SC_FOOD_VIT_CASH)->val1;
+	if(sc_get(sc,SC_CHANGE))
+		vit += sc_get(sc,SC_CHANGE)->val2;
+	if(sc_get(sc,SC_GUILDAURA) && sc_get(sc,SC_GUILDAURA)->val3&0xFFFF)
+		vit += sc_get(sc,SC_GUILDAURA)->val3&0xFFFF;
+	if(sc_get(sc,SC_TRUESIGHT))
 		vit += 5;
-	if(sc->data[SC_STRIPARMOR])
-		vit -= vit * sc->data[SC_STRIPARMOR]->val2/100;
-	if(sc->data[SC_MARIONETTE])
-		vit -= sc->data[SC_MARIONETTE]->val3&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		vit += sc->data[SC_MARIONETTE2]->val3&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH && vit < 50)
+	if(sc_get(sc,SC_STRIPARMOR))
+		vit -= vit * sc_get(sc,SC_STRIPARMOR)->val2/100;
+	if(sc_get(sc,SC_MARIONETTE))
+		vit -= sc_get(sc,SC_MARIONETTE)->val3&0xFF;
+	if(sc_get(sc,SC_MARIONETTE2))
+		vit += sc_get(sc,SC_MARIONETTE2)->val3&0xFF;
+	if(sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_HIGH && vit < 50)
 		vit = 50;
 
 	return (unsigned short)cap_value(vit,0,USHRT_MAX);
@@ -3345,35 +3345,35 @@ static unsigned short status_calc_int(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(int_,0,USHRT_MAX);
 
-	if(sc->data[SC_INCALLSTATUS])
-		int_ += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCINT])
-		int_ += sc->data[SC_INCINT]->val1;
-	if(sc->data[SC_INTFOOD])
-		int_ += sc->data[SC_INTFOOD]->val1;
-	if(sc->data[SC_FOOD_INT_CASH])
-		int_ += sc->data[SC_FOOD_INT_CASH]->val1;
-	if(sc->data[SC_CHANGE])
-		int_ += sc->data[SC_CHANGE]->val3;
-	if(sc->data[SC_BATTLEORDERS])
+	if(sc_get(sc,SC_INCALLSTATUS))
+		int_ += sc_get(sc,SC_INCALLSTATUS)->val1;
+	if(sc_get(sc,SC_INCINT))
+		int_ += sc_get(sc,SC_INCINT)->val1;
+	if(sc_get(sc,SC_INTFOOD))
+		int_ += sc_get(sc,SC_INTFOOD)->val1;
+	if(sc_get(sc,SC_FOOD_INT_CASH))
+		int_ += sc_get(sc,SC_FOOD_INT_CASH)->val1;
+	if(sc_get(sc,SC_CHANGE))
+		int_ += sc_get(sc,SC_CHANGE)->val3;
+	if(sc_get(sc,SC_BATTLEORDERS))
 		int_ += 5;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_get(sc,SC_TRUESIGHT))
 		int_ += 5;
-	if(sc->data[SC_BLESSING]){
-		if (sc->data[SC_BLESSING]->val2)
-			int_ += sc->data[SC_BLESSING]->val2;
+	if(sc_get(sc,SC_BLESSING)){
+		if (sc_get(sc,SC_BLESSING)->val2)
+			int_ += sc_get(sc,SC_BLESSING)->val2;
 		else
 			int_ >>= 1;
 	}
-	if(sc->data[SC_STRIPHELM])
-		int_ -= int_ * sc->data[SC_STRIPHELM]->val2/100;
-	if(sc->data[SC_NEN])
-		int_ += sc->data[SC_NEN]->val1;
-	if(sc->data[SC_MARIONETTE])
-		int_ -= ((sc->data[SC_MARIONETTE]->val4)>>16)&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		int_ += ((sc->data[SC_MARIONETTE2]->val4)>>16)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH && int_ < 50)
+	if(sc_get(sc,SC_STRIPHELM))
+		int_ -= int_ * sc_get(sc,SC_STRIPHELM)->val2/100;
+	if(sc_get(sc,SC_NEN))
+		int_ += sc_get(sc,SC_NEN)->val1;
+	if(sc_get(sc,SC_MARIONETTE))
+		int_ -= ((sc_get(sc,SC_MARIONETTE)->val4)>>16)&0xFF;
+	if(sc_get(sc,SC_MARIONETTE2))
+		int_ += ((sc_get(sc,SC_MARIONETTE2)->val4)>>16)&0xFF;
+	if(sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_HIGH && int_ < 50)
 		int_ = 50;
 
 	return (unsigned short)cap_value(int_,0,USHRT_MAX);
@@ -3384,38 +3384,38 @@ static unsigned short status_calc_dex(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(dex,0,USHRT_MAX);
 
-	if(sc->data[SC_CONCENTRATE] && !sc->data[SC_QUAGMIRE])
-		dex += (dex-sc->data[SC_CONCENTRATE]->val4)*sc->data[SC_CONCENTRATE]->val2/100;
-
-	if(sc->data[SC_INCALLSTATUS])
-		dex += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCDEX])
-		dex += sc->data[SC_INCDEX]->val1;
-	if(sc->data[SC_DEXFOOD])
-		dex += sc->data[SC_DEXFOOD]->val1;
-	if(sc->data[SC_FOOD_DEX_CASH])
-		dex += sc->data[SC_FOOD_DEX_CASH]->val1;
-	if(sc->data[SC_BATTLEORDERS])
+	if(sc_get(sc,SC_CONCENTRATE) && !sc_get(sc,SC_QUAGMIRE))
+		dex += (dex-sc_get(sc,SC_CONCENTRATE)->val4)*sc_get(sc,SC_CONCENTRATE)->val2/100;
+
+	if(sc_get(sc,SC_INCALLSTATUS))
+		dex += sc_get(sc,SC_INCALLSTATUS)->val1;
+	if(sc_get(sc,SC_INCDEX))
+		dex += sc_get(sc,SC_INCDEX)->val1;
+	if(sc_get(sc,SC_DEXFOOD))
+		dex += sc_get(sc,SC_DEXFOOD)->val1;
+	if(sc_get(sc,SC_FOOD_DEX_CASH))
+		dex += sc_get(sc,SC_FOOD_DEX_CASH)->val1;
+	if(sc_get(sc,SC_BATTLEORDERS))
 		dex += 5;
-	if(sc->data[SC_GUILDAURA] && sc->data[SC_GUILDAURA]->val4&0xFFFF)
-		dex += sc->data[SC_GUILDAURA]->val4&0xFFFF;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_get(sc,SC_GUILDAURA) && sc_get(sc,SC_GUILDAURA)->val4&0xFFFF)
+		dex += sc_get(sc,SC_GUILDAURA)->val4&0xFFFF;
+	if(sc_get(sc,SC_TRUESIGHT))
 		dex += 5;
-	if(sc->data[SC_QUAGMIRE])
-		dex -= sc->data[SC_QUAGMIRE]->val2;
-	if(sc->data[SC_BLESSING]){
-		if (sc->data[SC_BLESSING]->val2)
-			dex += sc->data[SC_BLESSING]->val2;
+	if(sc_get(sc,SC_QUAGMIRE))
+		dex -= sc_get(sc,SC_QUAGMIRE)->val2;
+	if(sc_get(sc,SC_BLESSING)){
+		if (sc_get(sc,SC_BLESSING)->val2)
+			dex += sc_get(sc,SC_BLESSING)->val2;
 		else
 			dex >>= 1;
 	}
-	if(sc->data[SC_INCREASING])
+	if(sc_get(sc,SC_INCREASING))
 		dex += 4;	// added based on skill updates [Reddozen]
-	if(sc->data[SC_MARIONETTE])
-		dex -= ((sc->data[SC_MARIONETTE]->val4)>>8)&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		dex += ((sc->data[SC_MARIONETTE2]->val4)>>8)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH && dex < 50)
+	if(sc_get(sc,SC_MARIONETTE))
+		dex -= ((sc_get(sc,SC_MARIONETTE)->val4)>>8)&0xFF;
+	if(sc_get(sc,SC_MARIONETTE2))
+		dex += ((sc_get(sc,SC_MARIONETTE2)->val4)>>8)&0xFF;
+	if(sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_HIGH && dex < 50)
 		dex  = 50;
 
 	return (unsigned short)cap_value(dex,0,USHRT_MAX);
@@ -3426,25 +3426,25 @@ static unsigned short status_calc_luk(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(luk,0,USHRT_MAX);
 
-	if(sc->data[SC_CURSE])
+	if(sc_get(sc,SC_CURSE))
 		return 0;
-	if(sc->data[SC_INCALLSTATUS])
-		luk += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCLUK])
-		luk += sc->data[SC_INCLUK]->val1;
-	if(sc->data[SC_LUKFOOD])
-		luk += sc->data[SC_LUKFOOD]->val1;
-	if(sc->data[SC_FOOD_LUK_CASH])
-		luk += sc->data[SC_FOOD_LUK_CASH]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc_get(sc,SC_INCALLSTATUS))
+		luk += sc_get(sc,SC_INCALLSTATUS)->val1;
+	if(sc_get(sc,SC_INCLUK))
+		luk += sc_get(sc,SC_INCLUK)->val1;
+	if(sc_get(sc,SC_LUKFOOD))
+		luk += sc_get(sc,SC_LUKFOOD)->val1;
+	if(sc_get(sc,SC_FOOD_LUK_CASH))
+		luk += sc_get(sc,SC_FOOD_LUK_CASH)->val1;
+	if(sc_get(sc,SC_TRUESIGHT))
 		luk += 5;
-	if(sc->data[SC_GLORIA])
+	if(sc_get(sc,SC_GLORIA))
 		luk += 30;
-	if(sc->data[SC_MARIONETTE])
-		luk -= sc->data[SC_MARIONETTE]->val4&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		luk += sc->data[SC_MARIONETTE2]->val4&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH && luk < 50)
+	if(sc_get(sc,SC_MARIONETTE))
+		luk -= sc_get(sc,SC_MARIONETTE)->val4&0xFF;
+	if(sc_get(sc,SC_MARIONETTE2))
+		luk += sc_get(sc,SC_MARIONETTE2)->val4&0xFF;
+	if(sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_HIGH && luk < 50)
 		luk = 50;
 
 	return (unsigned short)cap_value(luk,0,USHRT_MAX);
@@ -3455,32 +3455,32 @@ static unsigned short status_calc_batk(struct block_list *bl, struct status_chan
 	if(!sc || !sc->count)
 		return cap_value(batk,0,USHRT_MAX);
 
-	if(sc->data[SC_ATKPOTION])
-		batk += sc->data[SC_ATKPOTION]->val1;
-	if(sc->data[SC_BATKFOOD])
-		batk += sc->data[SC_BATKFOOD]->val1;
-	if(sc->data[SC_INCATKRATE])
-		batk += batk * sc->data[SC_INCATKRATE]->val1/100;
-	if(sc->data[SC_PROVOKE])
-		batk += batk * sc->data[SC_PROVOKE]->val3/100;
-	if(sc->data[SC_CONCENTRATION])
-		batk += batk * sc->data[SC_CONCENTRATION]->val2/100;
-	if(sc->data[SC_SKE])
+	if(sc_get(sc,SC_ATKPOTION))
+		batk += sc_get(sc,SC_ATKPOTION)->val1;
+	if(sc_get(sc,SC_BATKFOOD))
+		batk += sc_get(sc,SC_BATKFOOD)->val1;
+	if(sc_get(sc,SC_INCATKRATE))
+		batk += batk * sc_get(sc,SC_INCATKRATE)->val1/100;
+	if(sc_get(sc,SC_PROVOKE))
+		batk += batk * sc_get(sc,SC_PROVOKE)->val3/100;
+	if(sc_get(sc,SC_CONCENTRATION))
+		batk += batk * sc_get(sc,SC_CONCENTRATION)->val2/100;
+	if(sc_get(sc,SC_SKE))
 		batk += batk * 3;
-	if(sc->data[SC_BLOODLUST])
-		batk += batk * sc->data[SC_BLOODLUST]->val2/100;
-	if(sc->data[SC_JOINTBEAT] && sc->data[SC_JOINTBEAT]->val2&BREAK_WAIST)
+	if(sc_get(sc,SC_BLOODLUST))
+		batk += batk * sc_get(sc,SC_BLOODLUST)->val2/100;
+	if(sc_get(sc,SC_JOINTBEAT) && sc_get(sc,SC_JOINTBEAT)->val2&BREAK_WAIST)
 		batk -= batk * 25/100;
-	if(sc->data[SC_CURSE])
+	if(sc_get(sc,SC_CURSE))
 		batk -= batk * 25/100;
 //Curse shouldn't effect on this?  <- Curse OR Bleeding??
-//	if(sc->data[SC_BLEEDING])
+//	if(sc_get(sc,SC_BLEEDING))
 //		batk -= batk * 25/100;
-	if(sc->data[SC_FLEET])
-		batk += batk * sc->data[SC_FLEET]->val3/100;
-	if(sc->data[SC_GATLINGFEVER])
-		batk += sc->data[SC_GATLINGFEVER]->val3;
-	if(sc->data[SC_MADNESSCANCEL])
+	if(sc_get(sc,SC_FLEET))
+		batk += batk * sc_get(sc,SC_FLEET)->val3/100;
+	if(sc_get(sc,SC_GATLINGFEVER))
+		batk += sc_get(sc,SC_GATLINGFEVER)->val3;
+	if(sc_get(sc,SC_MADNESSCANCEL))
 		batk += 100;
 	return (unsigned short)cap_value(batk,0,USHRT_MAX);
 }
@@ -3490,42 +3490,42 @@ static unsigned short status_calc_watk(struct block_list *bl, struct status_chan
 	if(!sc || !sc->count)
 		return cap_value(watk,0,USHRT_MAX);
 
-	if(sc->data[SC_IMPOSITIO])
-		watk += sc->data[SC_IMPOSITIO]->val2;
-	if(sc->data[SC_WATKFOOD])
-		watk += sc->data[SC_WATKFOOD]->val1;
-	if(sc->data[SC_DRUMBATTLE])
-		watk += sc->data[SC_DRUMBATTLE]->val2;
-	if(sc->data[SC_VOLCANO])
-		watk += sc->data[SC_VOLCANO]->val2;
-	if(sc->data[SC_INCATKRATE])
-		watk += watk * sc->data[SC_INCATKRATE]->val1/100;
-	if(sc->data[SC_PROVOKE])
-		watk += watk * sc->data[SC_PROVOKE]->val3/100;
-	if(sc->data[SC_CONCENTRATION])
-		watk += watk * sc->data[SC_CONCENTRATION]->val2/100;
-	if(sc->data[SC_SKE])
+	if(sc_get(sc,SC_IMPOSITIO))
+		watk += sc_get(sc,SC_IMPOSITIO)->val2;
+	if(sc_get(sc,SC_WATKFOOD))
+		watk += sc_get(sc,SC_WATKFOOD)->val1;
+	if(sc_get(sc,SC_DRUMBATTLE))
+		watk += sc_get(sc,SC_DRUMBATTLE)->val2;
+	if(sc_get(sc,SC_VOLCANO))
+		watk += sc_get(sc,SC_VOLCANO)->val2;
+	if(sc_get(sc,SC_INCATKRATE))
+		watk += watk * sc_get(sc,SC_INCATKRATE)->val1/100;
+	if(sc_get(sc,SC_PROVOKE))
+		watk += watk * sc_get(sc,SC_PROVOKE)->val3/100;
+	if(sc_get(sc,SC_CONCENTRATION))
+		watk += watk * sc_get(sc,SC_CONCENTRATION)->val2/100;
+	if(sc_get(sc,SC_SKE))
 		watk += watk * 3;
-	if(sc->data[SC_NIBELUNGEN]) {
+	if(sc_get(sc,SC_NIBELUNGEN)) {
 		if (bl->type != BL_PC)
-			watk += sc->data[SC_NIBELUNGEN]->val2;
+			watk += sc_get(sc,SC_NIBELUNGEN)->val2;
 		else {
 			TBL_PC *sd = (TBL_PC*)bl;
 			int index = sd->equip_index[sd->state.lr_flag?EQI_HAND_L:EQI_HAND_R];
 			if(index >= 0 && sd->inventory_data[index] && sd->inventory_data[index]->wlv == 4)
-				watk += sc->data[SC_NIBELUNGEN]->val2;
+				watk += sc_get(sc,SC_NIBELUNGEN)->val2;
 		}
 	}
-	if(sc->data[SC_BLOODLUST])
-		watk += watk * sc->data[SC_BLOODLUST]->val2/100;
-	if(sc->data[SC_FLEET])
-		watk += watk * sc->data[SC_FLEET]->val3/100;
-	if(sc->data[SC_CURSE])
+	if(sc_get(sc,SC_BLOODLUST))
+		watk += watk * sc_get(sc,SC_BLOODLUST)->val2/100;
+	if(sc_get(sc,SC_FLEET))
+		watk += watk * sc_get(sc,SC_FLEET)->val3/100;
+	if(sc_get(sc,SC_CURSE))
 		watk -= watk * 25/100;
-	if(sc->data[SC_STRIPWEAPON])
-		watk -= watk * sc->data[SC_STRIPWEAPON]->val2/100;
-	if(sc->data[SC_MERC_ATKUP])
-		watk += sc->data[SC_MERC_ATKUP]->val2;
+	if(sc_get(sc,SC_STRIPWEAPON))
+		watk -= watk * sc_get(sc,SC_STRIPWEAPON)->val2/100;
+	if(sc_get(sc,SC_MERC_ATKUP))
+		watk += sc_get(sc,SC_MERC_ATKUP)->val2;
 
 	return (unsigned short)cap_value(watk,0,USHRT_MAX);
 }
@@ -3535,16 +3535,16 @@ static unsigned short status_calc_matk(struct block_list *bl, struct status_chan
 	if(!sc || !sc->count)
 		return cap_value(matk,0,USHRT_MAX);
 
-	if(sc->data[SC_MATKPOTION])
-		matk += sc->data[SC_MATKPOTION]->val1;
-	if(sc->data[SC_MATKFOOD])
-		matk += sc->data[SC_MATKFOOD]->val1;
-	if(sc->data[SC_MAGICPOWER])
-		matk += matk * sc->data[SC_MAGICPOWER]->val3/100;
-	if(sc->data[SC_MINDBREAKER])
-		matk += matk * sc->data[SC_MINDBREAKER]->val2/100;
-	if(sc->data[SC_INCMATKRATE])
-		matk += matk * sc->data[SC_INCMATKRATE]->val1/100;
+	if(sc_get(sc,SC_MATKPOTION))
+		matk += sc_get(sc,SC_MATKPOTION)->val1;
+	if(sc_get(sc,SC_MATKFOOD))
+		matk += sc_get(sc,SC_MATKFOOD)->val1;
+	if(sc_get(sc,SC_MAGICPOWER))
+		matk += matk * sc_get(sc,SC_MAGICPOWER)->val3/100;
+	if(sc_get(sc,SC_MINDBREAKER))
+		matk += matk * sc_get(sc,SC_MINDBREAKER)->val2/100;
+	if(sc_get(sc,SC_INCMATKRATE))
+		matk += matk * sc_get(sc,SC_INCMATKRATE)->val1/100;
 
 	return (unsigned short)cap_value(matk,0,USHRT_MAX);
 }
@@ -3554,15 +3554,15 @@ static signed short status_calc_critical(struct block_list *bl, struct status_ch
 	if(!sc || !sc->count)
 		return cap_value(critical,10,SHRT_MAX);
 
-	if (sc->data[SC_INCCRI])
-		critical += sc->data[SC_INCCRI]->val2;
-	if (sc->data[SC_EXPLOSIONSPIRITS])
-		critical += sc->data[SC_EXPLOSIONSPIRITS]->val2;
-	if (sc->data[SC_FORTUNE])
-		critical += sc->data[SC_FORTUNE]->val2;
-	if (sc->data[SC_TRUESIGHT])
-		critical += sc->data[SC_TRUESIGHT]->val2;
-	if(sc->data[SC_CLOAKING])
+	if (sc_get(sc,SC_INCCRI))
+		critical += sc_get(sc,SC_INCCRI)->val2;
+	if (sc_get(sc,SC_EXPLOSIONSPIRITS))
+		critical += sc_get(sc,SC_EXPLOSIONSPIRITS)->val2;
+	if (sc_get(sc,SC_FORTUNE))
+		critical += sc_get(sc,SC_FORTUNE)->val2;
+	if (sc_get(sc,SC_TRUESIGHT))
+		critical += sc_get(sc,SC_TRUESIGHT)->val2;
+	if(sc_get(sc,SC_CLOAKING))
 		critical += critical;
 
 	return (short)cap_value(critical,10,SHRT_MAX);
@@ -3574,26 +3574,26 @@ static signed short status_calc_hit(struct block_list *bl, struct status_change
 	if(!sc || !sc->count)
 		return cap_value(hit,1,SHRT_MAX);
 
-	if(sc->data[SC_INCHIT])
-		hit += sc->data[SC_INCHIT]->val1;
-	if(sc->data[SC_HITFOOD])
-		hit += sc->data[SC_HITFOOD]->val1;
-	if(sc->data[SC_TRUESIGHT])
-		hit += sc->data[SC_TRUESIGHT]->val3;
-	if(sc->data[SC_HUMMING])
-		hit += sc->data[SC_HUMMING]->val2;
-	if(sc->data[SC_CONCENTRATION])
-		hit += sc->data[SC_CONCENTRATION]->val3;
-	if(sc->data[SC_INCHITRATE])
-		hit += hit * sc->data[SC_INCHITRATE]->val1/100;
-	if(sc->data[SC_BLIND])
+	if(sc_get(sc,SC_INCHIT))
+		hit += sc_get(sc,SC_INCHIT)->val1;
+	if(sc_get(sc,SC_HITFOOD))
+		hit += sc_get(sc,SC_HITFOOD)->val1;
+	if(sc_get(sc,SC_TRUESIGHT))
+		hit += sc_get(sc,SC_TRUESIGHT)->val3;
+	if(sc_get(sc,SC_HUMMING))
+		hit += sc_get(sc,SC_HUMMING)->val2;
+	if(sc_get(sc,SC_CONCENTRATION))
+		hit += sc_get(sc,SC_CONCENTRATION)->val3;
+	if(sc_get(sc,SC_INCHITRATE))
+		hit += hit * sc_get(sc,SC_INCHITRATE)->val1/100;
+	if(sc_get(sc,SC_BLIND))
 		hit -= hit * 25/100;
-	if(sc->data[SC_ADJUSTMENT])
+	if(sc_get(sc,SC_ADJUSTMENT))
 		hit -= 30;
-	if(sc->data[SC_INCREASING])
+	if(sc_get(sc,SC_INCREASING))
 		hit += 20; // RockmanEXE; changed based on updated [Reddozen]
-	if(sc->data[SC_MERC_HITUP])
-		hit += sc->data[SC_MERC_HITUP]->val2;
+	if(sc_get(sc,SC_MERC_HITUP))
+		hit += sc_get(sc,SC_MERC_HITUP)->val2;
 
 	return (short)cap_value(hit,1,SHRT_MAX);
 }
@@ -3611,36 +3611,36 @@ static signed short status_calc_flee(struct block_list *bl, struct status_change
 	if(!sc || !sc->count)
 		return cap_value(flee,1,SHRT_MAX);
 
-	if(sc->data[SC_INCFLEE])
-		flee += sc->data[SC_INCFLEE]->val1;
-	if(sc->data[SC_FLEEFOOD])
-		flee += sc->data[SC_FLEEFOOD]->val1;
-	if(sc->data[SC_WHISTLE])
-		flee += sc->data[SC_WHISTLE]->val2;
-	if(sc->data[SC_WINDWALK])
-		flee += sc->data[SC_WINDWALK]->val2;
-	if(sc->data[SC_INCFLEERATE])
-		flee += flee * sc->data[SC_INCFLEERATE]->val1/100;
-	if(sc->data[SC_VIOLENTGALE])
-		flee += sc->data[SC_VIOLENTGALE]->val2;
-	if(sc->data[SC_MOON_COMFORT]) //SG skill [Komurka]
-		flee += sc->data[SC_MOON_COMFORT]->val2;
-	if(sc->data[SC_CLOSECONFINE])
+	if(sc_get(sc,SC_INCFLEE))
+		flee += sc_get(sc,SC_INCFLEE)->val1;
+	if(sc_get(sc,SC_FLEEFOOD))
+		flee += sc_get(sc,SC_FLEEFOOD)->val1;
+	if(sc_get(sc,SC_WHISTLE))
+		flee += sc_get(sc,SC_WHISTLE)->val2;
+	if(sc_get(sc,SC_WINDWALK))
+		flee += sc_get(sc,SC_WINDWALK)->val2;
+	if(sc_get(sc,SC_INCFLEERATE))
+		flee += flee * sc_get(sc,SC_INCFLEERATE)->val1/100;
+	if(sc_get(sc,SC_VIOLENTGALE))
+		flee += sc_get(sc,SC_VIOLENTGALE)->val2;
+	if(sc_get(sc,SC_MOON_COMFORT)) //SG skill [Komurka]
+		flee += sc_get(sc,SC_MOON_COMFORT)->val2;
+	if(sc_get(sc,SC_CLOSECONFINE))
 		flee += 10;
-	if(sc->data[SC_SPIDERWEB] && sc->data[SC_SPIDERWEB]->val1)
+	if(sc_get(sc,SC_SPIDERWEB) && sc_get(sc,SC_SPIDERWEB)->val1)
 		flee -= flee * 50/100;
-	if(sc->data[SC_BERSERK])
+	if(sc_get(sc,SC_BERSERK))
 		flee -= flee * 50/100;
-	if(sc->data[SC_BLIND])
+	if(sc_get(sc,SC_BLIND))
 		flee -= flee * 25/100;
-	if(sc->data[SC_ADJUSTMENT])
+	if(sc_get(sc,SC_ADJUSTMENT))
 		flee += 30;
-	if(sc->data[SC_GATLINGFEVER])
-		flee -= sc->data[SC_GATLINGFEVER]->val4;
-	if(sc->data[SC_SPEED])
-		flee += 10 + sc->data[SC_SPEED]->val1 * 10;
-	if(sc->data[SC_MERC_FLEEUP])
-		flee += sc->data[SC_MERC_FLEEUP]->val2;
+	if(sc_get(sc,SC_GATLINGFEVER))
+		flee -= sc_get(sc,SC_GATLINGFEVER)->val4;
+	if(sc_get(sc,SC_SPEED))
+		flee += 10 + sc_get(sc,SC_SPEED)->val1 * 10;
+	if(sc_get(sc,SC_MERC_FLEEUP))
+		flee += sc_get(sc,SC_MERC_FLEEUP)->val2;
 
 	return (short)cap_value(flee,1,SHRT_MAX);
 }
@@ -3650,10 +3650,10 @@ static signed short status_calc_flee2(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(flee2,10,SHRT_MAX);
 
-	if(sc->data[SC_INCFLEE2])
-		flee2 += sc->data[SC_INCFLEE2]->val2;
-	if(sc->data[SC_WHISTLE])
-		flee2 += sc->data[SC_WHISTLE]->val3*10;
+	if(sc_get(sc,SC_INCFLEE2))
+		flee2 += sc_get(sc,SC_INCFLEE2)->val2;
+	if(sc_get(sc,SC_WHISTLE))
+		flee2 += sc_get(sc,SC_WHISTLE)->val3*10;
 
 	return (short)cap_value(flee2,10,SHRT_MAX);
 }
@@ -3663,40 +3663,40 @@ static signed char status_calc_def(struct block_list *bl, struct status_change *
 	if(!sc || !sc->count)
 		return (signed char)cap_value(def,CHAR_MIN,CHAR_MAX);
 
-	if(sc->data[SC_BERSERK])
+	if(sc_get(sc,SC_BERSERK))
 		return 0;
-	if(sc->data[SC_SKA])
-		return sc->data[SC_SKA]->val3;
-	if(sc->data[SC_BARRIER])
+	if(sc_get(sc,SC_SKA))
+		return sc_get(sc,SC_SKA)->val3;
+	if(sc_get(sc,SC_BARRIER))
 		return 100;
-	if(sc->data[SC_KEEPING])
+	if(sc_get(sc,SC_KEEPING))
 		return 90;
-	if(sc->data[SC_STEELBODY])
+	if(sc_get(sc,SC_STEELBODY))
 		return 90;
-	if(sc->data[SC_ARMORCHANGE])
-		def += sc->data[SC_ARMORCHANGE]->val2;
-	if(sc->data[SC_DRUMBATTLE])
-		def += sc->data[SC_DRUMBATTLE]->val3;
-	if(sc->data[SC_DEFENCE])	//[orn]
-		def += sc->data[SC_DEFENCE]->val2 ;
-	if(sc->data[SC_INCDEFRATE])
-		def += def * sc->data[SC_INCDEFRATE]->val1/100;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc_get(sc,SC_ARMORCHANGE))
+		def += sc_get(sc,SC_ARMORCHANGE)->val2;
+	if(sc_get(sc,SC_DRUMBATTLE))
+		def += sc_get(sc,SC_DRUMBATTLE)->val3;
+	if(sc_get(sc,SC_DEFENCE))	//[orn]
+		def += sc_get(sc,SC_DEFENCE)->val2 ;
+	if(sc_get(sc,SC_INCDEFRATE))
+		def += def * sc_get(sc,SC_INCDEFRATE)->val1/100;
+	if(sc_get(sc,SC_STONE) && sc->opt1 == OPT1_STONE)
 		def >>=1;
-	if(sc->data[SC_FREEZE])
+	if(sc_get(sc,SC_FREEZE))
 		def >>=1;
-	if(sc->data[SC_SIGNUMCRUCIS])
-		def -= def * sc->data[SC_SIGNUMCRUCIS]->val2/100;
-	if(sc->data[SC_CONCENTRATION])
-		def -= def * sc->data[SC_CONCENTRATION]->val4/100;
-	if(sc->data[SC_SKE])
+	if(sc_get(sc,SC_SIGNUMCRUCIS))
+		def -= def * sc_get(sc,SC_SIGNUMCRUCIS)->val2/100;
+	if(sc_get(sc,SC_CONCENTRATION))
+		def -= def * sc_get(sc,SC_CONCENTRATION)->val4/100;
+	if(sc_get(sc,SC_SKE))
 		def >>=1;
-	if(sc->data[SC_PROVOKE] && bl->type != BL_PC) // Provoke doesn't alter player defense->
-		def -= def * sc->data[SC_PROVOKE]->val4/100;
-	if(sc->data[SC_STRIPSHIELD])
-		def -= def * sc->data[SC_STRIPSHIELD]->val2/100;
-	if (sc->data[SC_FLING])
-		def -= def * (sc->data[SC_FLING]->val2)/100;
+	if(sc_get(sc,SC_PROVOKE) && bl->type != BL_PC) // Provoke doesn't alter player defense->
+		def -= def * sc_get(sc,SC_PROVOKE)->val4/100;
+	if(sc_get(sc,SC_STRIPSHIELD))
+		def -= def * sc_get(sc,SC_STRIPSHIELD)->val2/100;
+	if (sc_get(sc,SC_FLING))
+		def -= def * (sc_get(sc,SC_FLING)->val2)/100;
 
 	return (signed char)cap_value(def,CHAR_MIN,CHAR_MAX);
 }
@@ -3706,29 +3706,29 @@ static signed short status_calc_def2(struct block_list *bl, struct status_change
 	if(!sc || !sc->count)
 		return cap_value(def2,1,SHRT_MAX);
 	
-	if(sc->data[SC_BERSERK])
+	if(sc_get(sc,SC_BERSERK))
 		return 0;
-	if(sc->data[SC_ETERNALCHAOS])
+	if(sc_get(sc,SC_ETERNALCHAOS))
 		return 0;
-	if(sc->data[SC_SUN_COMFORT])
-		def2 += sc->data[SC_SUN_COMFORT]->val2;
-	if(sc->data[SC_ANGELUS])
-		def2 += def2 * sc->data[SC_ANGELUS]->val2/100;
-	if(sc->data[SC_CONCENTRATION])
-		def2 -= def2 * sc->data[SC_CONCENTRATION]->val4/100;
-	if(sc->data[SC_POISON])
+	if(sc_get(sc,SC_SUN_COMFORT))
+		def2 += sc_get(sc,SC_SUN_COMFORT)->val2;
+	if(sc_get(sc,SC_ANGELUS))
+		def2 += def2 * sc_get(sc,SC_ANGELUS)->val2/100;
+	if(sc_get(sc,SC_CONCENTRATION))
+		def2 -= def2 * sc_get(sc,SC_CONCENTRATION)->val4/100;
+	if(sc_get(sc,SC_POISON))
 		def2 -= def2 * 25/100;
-	if(sc->data[SC_DPOISON])
+	if(sc_get(sc,SC_DPOISON))
 		def2 -= def2 * 25/100;
-	if(sc->data[SC_SKE])
+	if(sc_get(sc,SC_SKE))
 		def2 -= def2 * 50/100;
-	if(sc->data[SC_PROVOKE])
-		def2 -= def2 * sc->data[SC_PROVOKE]->val4/100;
-	if(sc->data[SC_JOINTBEAT])
-		def2 -= def2 * ( sc->data[SC_JOINTBEAT]->val2&BREAK_SHOULDER ? 50 : 0 ) / 100
-			  + def2 * ( sc->data[SC_JOINTBEAT]->val2&BREAK_WAIST ? 25 : 0 ) / 100;
-	if(sc->data[SC_FLING])
-		def2 -= def2 * (sc->data[SC_FLING]->val3)/100;
+	if(sc_get(sc,SC_PROVOKE))
+		def2 -= def2 * sc_get(sc,SC_PROVOKE)->val4/100;
+	if(sc_get(sc,SC_JOINTBEAT))
+		def2 -= def2 * ( sc_get(sc,SC_JOINTBEAT)->val2&BREAK_SHOULDER ? 50 : 0 ) / 100
+			  + def2 * ( sc_get(sc,SC_JOINTBEAT)->val2&BREAK_WAIST ? 25 : 0 ) / 100;
+	if(sc_get(sc,SC_FLING))
+		def2 -= def2 * (sc_get(sc,SC_FLING)->val3)/100;
 
 	return (short)cap_value(def2,1,SHRT_MAX);
 }
@@ -3738,23 +3738,23 @@ static signed char status_calc_mdef(struct block_list *bl, struct status_change
 	if(!sc || !sc->count)
 		return (signed char)cap_value(mdef,CHAR_MIN,CHAR_MAX);
 
-	if(sc->data[SC_BERSERK])
+	if(sc_get(sc,SC_BERSERK))
 		return 0;
-	if(sc->data[SC_BARRIER])
+	if(sc_get(sc,SC_BARRIER))
 		return 100;
-	if(sc->data[SC_STEELBODY])
+	if(sc_get(sc,SC_STEELBODY))
 		return 90;
-	if(sc->data[SC_SKA])
+	if(sc_get(sc,SC_SKA))
 		return 90;
-	if(sc->data[SC_ARMORCHANGE])
-		mdef += sc->data[SC_ARMORCHANGE]->val3;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc_get(sc,SC_ARMORCHANGE))
+		mdef += sc_get(sc,SC_ARMORCHANGE)->val3;
+	if(sc_get(sc,SC_STONE) && sc->opt1 == OPT1_STONE)
 		mdef += 25*mdef/100;
-	if(sc->data[SC_FREEZE])
+	if(sc_get(sc,SC_FREEZE))
 		mdef += 25*mdef/100;
-	if(sc->data[SC_ENDURE] && sc->data[SC_ENDURE]->val4 == 0)
-		mdef += sc->data[SC_ENDURE]->val1;
-	if(sc->data[SC_CONCENTRATION])
+	if(sc_get(sc,SC_ENDURE) && sc_get(sc,SC_ENDURE)->val4 == 0)
+		mdef += sc_get(sc,SC_ENDURE)->val1;
+	if(sc_get(sc,SC_CONCENTRATION))
 		mdef += 1; //Skill info says it adds a fixed 1 Mdef point.
 
 	return (signed char)cap_value(mdef,CHAR_MIN,CHAR_MAX);
@@ -3765,10 +3765,10 @@ static signed short status_calc_mdef2(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(mdef2,1,SHRT_MAX);
 
-	if(sc->data[SC_BERSERK])
+	if(sc_get(sc,SC_BERSERK))
 		return 0;
-	if(sc->data[SC_MINDBREAKER])
-		mdef2 -= mdef2 * sc->data[SC_MINDBREAKER]->val3/100;
+	if(sc_get(sc,SC_MINDBREAKER))
+		mdef2 -= mdef2 * sc_get(sc,SC_MINDBREAKER)->val3/100;
 
 	return (short)cap_value(mdef2,1,SHRT_MAX);
 }
@@ -3793,7 +3793,7 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		{
 			int val = 0;
 
-			if( sc->data[SC_FUSION] )
+			if( sc_get(sc,SC_FUSION) )
 				val = 25;
 			else
 			if( sd && pc_isriding(sd) )
@@ -3806,45 +3806,45 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		{
 			int val = 0;
 
-			if( sd && sc->data[SC_HIDING] && pc_checkskill(sd,RG_TUNNELDRIVE) > 0 )
+			if( sd && sc_get(sc,SC_HIDING) && pc_checkskill(sd,RG_TUNNELDRIVE) > 0 )
 				val = 120 - 6 * pc_checkskill(sd,RG_TUNNELDRIVE);
 			else
-			if( sd && sc->data[SC_CHASEWALK] && sc->data[SC_CHASEWALK]->val3 < 0 )
-				val = sc->data[SC_CHASEWALK]->val3;
+			if( sd && sc_get(sc,SC_CHASEWALK) && sc_get(sc,SC_CHASEWALK)->val3 < 0 )
+				val = sc_get(sc,SC_CHASEWALK)->val3;
 			else
 			{
 				// Longing for Freedom cancels song/dance penalty
-				if( sc->data[SC_LONGING] )
-					val = max( val, 50 - 10 * sc->data[SC_LONGING]->val1 );
+				if( sc_get(sc,SC_LONGING) )
+					val = max( val, 50 - 10 * sc_get(sc,SC_LONGING)->val1 );
 				else
-				if( sd && sc->data[SC_DANCING] )
-					val = max( val, 500 - (40 + 10 * (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER)) * pc_checkskill(sd,(sd->status.sex?BA_MUSICALLESSON:DC_DANCINGLESSON)) );
+				if( sd && sc_get(sc,SC_DANCING) )
+					val = max( val, 500 - (40 + 10 * (sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_BARDDANCER)) * pc_checkskill(sd,(sd->status.sex?BA_MUSICALLESSON:DC_DANCINGLESSON)) );
 
-				if( sc->data[SC_DECREASEAGI] )
+				if( sc_get(sc,SC_DECREASEAGI) )
 					val = max( val, 25 );
-				if( sc->data[SC_QUAGMIRE] )
+				if( sc_get(sc,SC_QUAGMIRE) )
 					val = max( val, 50 );
-				if( sc->data[SC_DONTFORGETME] )
-					val = max( val, sc->data[SC_DONTFORGETME]->val3 );
-				if( sc->data[SC_CURSE] )
+				if( sc_get(sc,SC_DONTFORGETME) )
+					val = max( val, sc_get(sc,SC_DONTFORGETME)->val3 );
+				if( sc_get(sc,SC_CURSE) )
 					val = max( val, 300 );
-				if( sc->data[SC_CHASEWALK] )
-					val = max( val, sc->data[SC_CHASEWALK]->val3 );
-				if( sc->data[SC_WEDDING] )
+				if( sc_get(sc,SC_CHASEWALK) )
+					val = max( val, sc_get(sc,SC_CHASEWALK)->val3 );
+				if( sc_get(sc,SC_WEDDING) )
 					val = max( val, 100 );
-				if( sc->data[SC_JOINTBEAT] && sc->data[SC_JOINTBEAT]->val2&(BREAK_ANKLE|BREAK_KNEE) )
-					val = max( val, (sc->data[SC_JOINTBEAT]->val2&BREAK_ANKLE ? 50 : 0) + (sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE ? 30 : 0) );
-				if( sc->data[SC_CLOAKING] && (sc->data[SC_CLOAKING]->val4&1) == 0 )
-					val = max( val, sc->data[SC_CLOAKING]->val1 < 3 ? 300 : 30 - 3 * sc->data[SC_CLOAKING]->val1 );
-				if( sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY )
+				if( sc_get(sc,SC_JOINTBEAT) && sc_get(sc,SC_JOINTBEAT)->val2&(BREAK_ANKLE|BREAK_KNEE) )
+					val = max( val, (sc_get(sc,SC_JOINTBEAT)->val2&BREAK_ANKLE ? 50 : 0) + (sc_get(sc,SC_JOINTBEAT)->val2&BREAK_KNEE ? 30 : 0) );
+				if( sc_get(sc,SC_CLOAKING) && (sc_get(sc,SC_CLOAKING)->val4&1) == 0 )
+					val = max( val, sc_get(sc,SC_CLOAKING)->val1 < 3 ? 300 : 30 - 3 * sc_get(sc,SC_CLOAKING)->val1 );
+				if( sc_get(sc,SC_GOSPEL) && sc_get(sc,SC_GOSPEL)->val4 == BCT_ENEMY )
 					val = max( val, 75 );
-				if( sc->data[SC_SLOWDOWN] ) // Slow Potion
+				if( sc_get(sc,SC_SLOWDOWN) ) // Slow Potion
 					val = max( val, 100 );
-				if( sc->data[SC_GATLINGFEVER] )
+				if( sc_get(sc,SC_GATLINGFEVER) )
 					val = max( val, 100 );
-				if( sc->data[SC_SUITON] )
-					val = max( val, sc->data[SC_SUITON]->val3 );
-				if( sc->data[SC_SWOO] )
+				if( sc_get(sc,SC_SUITON) )
+					val = max( val, sc_get(sc,SC_SUITON)->val3 );
+				if( sc_get(sc,SC_SWOO) )
 					val = max( val, 300 );
 
 				if( sd && sd->speed_rate + sd->speed_add_rate > 0 ) // permanent item-based speedup
@@ -3858,29 +3858,29 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		{
 			int val = 0;
 
-			if( sc->data[SC_SPEEDUP1] ) //FIXME: used both by NPC_AGIUP and Speed Potion script
+			if( sc_get(sc,SC_SPEEDUP1) ) //FIXME: used both by NPC_AGIUP and Speed Potion script
 				val = max( val, 50 );
-			if( sc->data[SC_INCREASEAGI] )
+			if( sc_get(sc,SC_INCREASEAGI) )
 				val = max( val, 25 );
-			if( sc->data[SC_WINDWALK] )
-				val = max( val, 2 * sc->data[SC_WINDWALK]->val1 );
-			if( sc->data[SC_CARTBOOST] )
+			if( sc_get(sc,SC_WINDWALK) )
+				val = max( val, 2 * sc_get(sc,SC_WINDWALK)->val1 );
+			if( sc_get(sc,SC_CARTBOOST) )
 				val = max( val, 20 );
 			if( sd && (sd->class_&MAPID_UPPERMASK) == MAPID_ASSASSIN && pc_checkskill(sd,TF_MISS) > 0 )
 				val = max( val, 1 * pc_checkskill(sd,TF_MISS) );
-			if( sc->data[SC_CLOAKING] && (sc->data[SC_CLOAKING]->val4&1) == 1 )
-				val = max( val, sc->data[SC_CLOAKING]->val1 >= 10 ? 25 : 3 * sc->data[SC_CLOAKING]->val1 - 3 );
-			if( sc->data[SC_BERSERK] )
+			if( sc_get(sc,SC_CLOAKING) && (sc_get(sc,SC_CLOAKING)->val4&1) == 1 )
+				val = max( val, sc_get(sc,SC_CLOAKING)->val1 >= 10 ? 25 : 3 * sc_get(sc,SC_CLOAKING)->val1 - 3 );
+			if( sc_get(sc,SC_BERSERK) )
 				val = max( val, 25 );
-			if( sc->data[SC_RUN] )
+			if( sc_get(sc,SC_RUN) )
 				val = max( val, 55 );
-			if( sc->data[SC_AVOID] )
-				val = max( val, 10 * sc->data[SC_AVOID]->val1 );
-			if( sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+			if( sc_get(sc,SC_AVOID) )
+				val = max( val, 10 * sc_get(sc,SC_AVOID)->val1 );
+			if( sc_get(sc,SC_INVINCIBLE) && !sc_get(sc,SC_INVINCIBLEOFF) )
 				val = max( val, 75 );
 
 			//FIXME: official items use a single bonus for this [ultramage]
-			if( sc->data[SC_SPEEDUP0] ) // temporary item-based speedup
+			if( sc_get(sc,SC_SPEEDUP0) ) // temporary item-based speedup
 				val = max( val, 25 );
 			if( sd && sd->speed_rate + sd->speed_add_rate < 0 ) // permanent item-based speedup
 				val = max( val, -(sd->speed_rate + sd->speed_add_rate) );
@@ -3898,12 +3898,12 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 			speed += speed * (50 - 5 * pc_checkskill(sd,MC_PUSHCART)) / 100;
 		if( speed_rate != 100 )
 			speed = speed * speed_rate / 100;
-		if( sc->data[SC_STEELBODY] )
+		if( sc_get(sc,SC_STEELBODY) )
 			speed = 200;
-		if( sc->data[SC_DEFENDER] )
+		if( sc_get(sc,SC_DEFENDER) )
 			speed = max(speed, 200);
-		if( sc->data[SC_WALKSPEED] && sc->data[SC_WALKSPEED]->val1 > 0 ) // ChangeSpeed
-			speed = speed * 100 / sc->data[SC_WALKSPEED]->val1;
+		if( sc_get(sc,SC_WALKSPEED) && sc_get(sc,SC_WALKSPEED)->val1 > 0 ) // ChangeSpeed
+			speed = speed * 100 / sc_get(sc,SC_WALKSPEED)->val1;
 	}
 
 	return (short)cap_value(speed,10,USHRT_MAX);
@@ -3913,53 +3913,52 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 /// Note that the scale of aspd_rate is 1000 = 100%.
 static short status_calc_aspd_rate(struct block_list *bl, struct status_change *sc, int aspd_rate)
 {
-	int i;
 	if(!sc || !sc->count)
 		return cap_value(aspd_rate,0,SHRT_MAX);
 
-	if(!sc->data[SC_QUAGMIRE])
+	if(!sc_get(sc,SC_QUAGMIRE))
 	{
 		int max = 0;
-		if(sc->data[SC_STAR_COMFORT])
-			max = sc->data[SC_STAR_COMFORT]->val2;
+		if(sc_get(sc,SC_STAR_COMFORT))
+			max = sc_get(sc,SC_STAR_COMFORT)->val2;
 
-		if(sc->data[SC_TWOHANDQUICKEN] &&
-			max < sc->data[SC_TWOHANDQUICKEN]->val2)
-			max = sc->data[SC_TWOHANDQUICKEN]->val2;
+		if(sc_get(sc,SC_TWOHANDQUICKEN) &&
+			max < sc_get(sc,SC_TWOHANDQUICKEN)->val2)
+			max = sc_get(sc,SC_TWOHANDQUICKEN)->val2;
 
-		if(sc->data[SC_ONEHAND] &&
-			max < sc->data[SC_ONEHAND]->val2)
-			max = sc->data[SC_ONEHAND]->val2;
+		if(sc_get(sc,SC_ONEHAND) &&
+			max < sc_get(sc,SC_ONEHAND)->val2)
+			max = sc_get(sc,SC_ONEHAND)->val2;
 
-		if(sc->data[SC_MERC_QUICKEN] &&
-			max < sc->data[SC_MERC_QUICKEN]->val2)
-			max = sc->data[SC_MERC_QUICKEN]->val2;
+		if(sc_get(sc,SC_MERC_QUICKEN) &&
+			max < sc_get(sc,SC_MERC_QUICKEN)->val2)
+			max = sc_get(sc,SC_MERC_QUICKEN)->val2;
 
-		if(sc->data[SC_ADRENALINE2] &&
-			max < sc->data[SC_ADRENALINE2]->val3)
-			max = sc->data[SC_ADRENALINE2]->val3;
+		if(sc_get(sc,SC_ADRENALINE2) &&
+			max < sc_get(sc,SC_ADRENALINE2)->val3)
+			max = sc_get(sc,SC_ADRENALINE2)->val3;
 		
-		if(sc->data[SC_ADRENALINE] &&
-			max < sc->data[SC_ADRENALINE]->val3)
-			max = sc->data[SC_ADRENALINE]->val3;
+		if(sc_get(sc,SC_ADRENALINE) &&
+			max < sc_get(sc,SC_ADRENALINE)->val3)
+			max = sc_get(sc,SC_ADRENALINE)->val3;
 		
-		if(sc->data[SC_SPEARQUICKEN] &&
-			max < sc->data[SC_SPEARQUICKEN]->val2)
-			max = sc->data[SC_SPEARQUICKEN]->val2;
+		if(sc_get(sc,SC_SPEARQUICKEN) &&
+			max < sc_get(sc,SC_SPEARQUICKEN)->val2)
+			max = sc_get(sc,SC_SPEARQUICKEN)->val2;
 
-		if(sc->data[SC_GATLINGFEVER] &&
-			max < sc->data[SC_GATLINGFEVER]->val2)
-			max = sc->data[SC_GATLINGFEVER]->val2;
+		if(sc_get(sc,SC_GATLINGFEVER) &&
+			max < sc_get(sc,SC_GATLINGFEVER)->val2)
+			max = sc_get(sc,SC_GATLINGFEVER)->val2;
 		
-		if(sc->data[SC_FLEET] &&
-			max < sc->data[SC_FLEET]->val2)
-			max = sc->data[SC_FLEET]->val2;
+		if(sc_get(sc,SC_FLEET) &&
+			max < sc_get(sc,SC_FLEET)->val2)
+			max = sc_get(sc,SC_FLEET)->val2;
 
-		if(sc->data[SC_ASSNCROS] &&
-			max < sc->data[SC_ASSNCROS]->val2)
+		if(sc_get(sc,SC_ASSNCROS) &&
+			max < sc_get(sc,SC_ASSNCROS)->val2)
 		{
 			if (bl->type!=BL_PC)
-				max = sc->data[SC_ASSNCROS]->val2;
+				max = sc_get(sc,SC_ASSNCROS)->val2;
 			else
 			switch(((TBL_PC*)bl)->status.weapon)
 			{
@@ -3971,41 +3970,44 @@ static short status_calc_aspd_rate(struct block_list *bl, struct status_change *
 				case W_GRENADE:
 					break;
 				default:
-					max = sc->data[SC_ASSNCROS]->val2;
+					max = sc_get(sc,SC_ASSNCROS)->val2;
 			}
 		}
 		aspd_rate -= max;
 
 	  	//These stack with the rest of bonuses.
-		if(sc->data[SC_BERSERK])
+		if(sc_get(sc,SC_BERSERK))
 			aspd_rate -= 300;
-		else if(sc->data[SC_MADNESSCANCEL])
+		else if(sc_get(sc,SC_MADNESSCANCEL))
 			aspd_rate -= 200;
 	}
 
-	if(sc->data[i=SC_ASPDPOTION3] ||
-		sc->data[i=SC_ASPDPOTION2] ||
-		sc->data[i=SC_ASPDPOTION1] ||
-		sc->data[i=SC_ASPDPOTION0])
-		aspd_rate -= sc->data[i]->val2;
-	if(sc->data[SC_DONTFORGETME])
-		aspd_rate += 10 * sc->data[SC_DONTFORGETME]->val2;
-	if(sc->data[SC_LONGING])
-		aspd_rate += sc->data[SC_LONGING]->val2;
-	if(sc->data[SC_STEELBODY])
+	if(sc_get(sc,SC_ASPDPOTION3))
+		aspd_rate -= sc_get(sc,SC_ASPDPOTION3)->val2;
+	else if(sc_get(sc,SC_ASPDPOTION2))
+		aspd_rate -= sc_get(sc,SC_ASPDPOTION2)->val2;
+	else if(sc_get(sc,SC_ASPDPOTION1))
+		aspd_rate -= sc_get(sc,SC_ASPDPOTION1)->val2;
+	else if(sc_get(sc,SC_ASPDPOTION0))
+		aspd_rate -= sc_get(sc,SC_ASPDPOTION0)->val2;
+	if(sc_get(sc,SC_DONTFORGETME))
+		aspd_rate += 10 * sc_get(sc,SC_DONTFORGETME)->val2;
+	if(sc_get(sc,SC_LONGING))
+		aspd_rate += sc_get(sc,SC_LONGING)->val2;
+	if(sc_get(sc,SC_STEELBODY))
 		aspd_rate += 250;
-	if(sc->data[SC_SKA])
+	if(sc_get(sc,SC_SKA))
 		aspd_rate += 250;
-	if(sc->data[SC_DEFENDER])
-		aspd_rate += sc->data[SC_DEFENDER]->val4;
-	if(sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY)
+	if(sc_get(sc,SC_DEFENDER))
+		aspd_rate += sc_get(sc,SC_DEFENDER)->val4;
+	if(sc_get(sc,SC_GOSPEL) && sc_get(sc,SC_GOSPEL)->val4 == BCT_ENEMY)
 		aspd_rate += 250;
-	if(sc->data[SC_GRAVITATION])
-		aspd_rate += sc->data[SC_GRAVITATION]->val2;
-	if(sc->data[SC_JOINTBEAT]) {
-		if( sc->data[SC_JOINTBEAT]->val2&BREAK_WRIST )
+	if(sc_get(sc,SC_GRAVITATION))
+		aspd_rate += sc_get(sc,SC_GRAVITATION)->val2;
+	if(sc_get(sc,SC_JOINTBEAT)) {
+		if( sc_get(sc,SC_JOINTBEAT)->val2&BREAK_WRIST )
 			aspd_rate += 250;
-		if( sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE )
+		if( sc_get(sc,SC_JOINTBEAT)->val2&BREAK_KNEE )
 			aspd_rate += 100;
 	}
 
@@ -4017,11 +4019,11 @@ static unsigned short status_calc_dmotion(struct block_list *bl, struct status_c
 	if( !sc || !sc->count || map_flag_gvg(bl->m) || map[bl->m].flag.battleground )
 		return cap_value(dmotion,0,USHRT_MAX);
 		
-	if( sc->data[SC_ENDURE] )
+	if( sc_get(sc,SC_ENDURE) )
 		return 0;
-	if( sc->data[SC_CONCENTRATION] )
+	if( sc_get(sc,SC_CONCENTRATION) )
 		return 0;
-	if( sc->data[SC_RUN] )
+	if( sc_get(sc,SC_RUN) )
 		return 0;
 
 	return (unsigned short)cap_value(dmotion,0,USHRT_MAX);
@@ -4032,19 +4034,19 @@ static unsigned int status_calc_maxhp(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(maxhp,1,UINT_MAX);
 
-	if(sc->data[SC_INCMHPRATE])
-		maxhp += maxhp * sc->data[SC_INCMHPRATE]->val1/100;
-	if(sc->data[SC_APPLEIDUN])
-		maxhp += maxhp * sc->data[SC_APPLEIDUN]->val2/100;
-	if(sc->data[SC_DELUGE])
-		maxhp += maxhp * sc->data[SC_DELUGE]->val2/100;
-	if(sc->data[SC_BERSERK])
+	if(sc_get(sc,SC_INCMHPRATE))
+		maxhp += maxhp * sc_get(sc,SC_INCMHPRATE)->val1/100;
+	if(sc_get(sc,SC_APPLEIDUN))
+		maxhp += maxhp * sc_get(sc,SC_APPLEIDUN)->val2/100;
+	if(sc_get(sc,SC_DELUGE))
+		maxhp += maxhp * sc_get(sc,SC_DELUGE)->val2/100;
+	if(sc_get(sc,SC_BERSERK))
 		maxhp += maxhp * 2;
-	if(sc->data[SC_MARIONETTE])
+	if(sc_get(sc,SC_MARIONETTE))
 		maxhp -= 1000;
 
-	if(sc->data[SC_MERC_HPUP])
-		maxhp += maxhp * sc->data[SC_MERC_HPUP]->val2/100;
+	if(sc_get(sc,SC_MERC_HPUP))
+		maxhp += maxhp * sc_get(sc,SC_MERC_HPUP)->val2/100;
 
 	return cap_value(maxhp,1,UINT_MAX);
 }
@@ -4054,12 +4056,12 @@ static unsigned int status_calc_maxsp(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(maxsp,1,UINT_MAX);
 
-	if(sc->data[SC_INCMSPRATE])
-		maxsp += maxsp * sc->data[SC_INCMSPRATE]->val1/100;
-	if(sc->data[SC_SERVICE4U])
-		maxsp += maxsp * sc->data[SC_SERVICE4U]->val2/100;
-	if(sc->data[SC_MERC_SPUP])
-		maxsp += maxsp * sc->data[SC_MERC_SPUP]->val2/100;
+	if(sc_get(sc,SC_INCMSPRATE))
+		maxsp += maxsp * sc_get(sc,SC_INCMSPRATE)->val1/100;
+	if(sc_get(sc,SC_SERVICE4U))
+		maxsp += maxsp * sc_get(sc,SC_SERVICE4U)->val2/100;
+	if(sc_get(sc,SC_MERC_SPUP))
+		maxsp += maxsp * sc_get(sc,SC_MERC_SPUP)->val2/100;
 
 	return cap_value(maxsp,1,UINT_MAX);
 }
@@ -4069,16 +4071,16 @@ static unsigned char status_calc_element(struct block_list *bl, struct status_ch
 	if(!sc || !sc->count)
 		return element;
 
-	if(sc->data[SC_FREEZE])
+	if(sc_get(sc,SC_FREEZE))
 		return ELE_WATER;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc_get(sc,SC_STONE) && sc->opt1 == OPT1_STONE)
 		return ELE_EARTH;
-	if(sc->data[SC_BENEDICTIO])
+	if(sc_get(sc,SC_BENEDICTIO))
 		return ELE_HOLY;
-	if(sc->data[SC_CHANGEUNDEAD])
+	if(sc_get(sc,SC_CHANGEUNDEAD))
 		return ELE_UNDEAD;
-	if(sc->data[SC_ELEMENTALCHANGE])
-		return sc->data[SC_ELEMENTALCHANGE]->val2;
+	if(sc_get(sc,SC_ELEMENTALCHANGE))
+		return sc_get(sc,SC_ELEMENTALCHANGE)->val2;
 	return (unsigned char)cap_value(element,0,UCHAR_MAX);
 }
 
@@ -4087,16 +4089,16 @@ static unsigned char status_calc_element_lv(struct block_list *bl, struct status
 	if(!sc || !sc->count)
 		return lv;
 
-	if(sc->data[SC_FREEZE])	
+	if(sc_get(sc,SC_FREEZE))	
 		return 1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc_get(sc,SC_STONE) && sc->opt1 == OPT1_STONE)
 		return 1;
-	if(sc->data[SC_BENEDICTIO])
+	if(sc_get(sc,SC_BENEDICTIO))
 		return 1;
-	if(sc->data[SC_CHANGEUNDEAD])
+	if(sc_get(sc,SC_CHANGEUNDEAD))
 		return 1;
-	if(sc->data[SC_ELEMENTALCHANGE])
-		return sc->data[SC_ELEMENTALCHANGE]->val1;
+	if(sc_get(sc,SC_ELEMENTALCHANGE))
+		return sc_get(sc,SC_ELEMENTALCHANGE)->val1;
 
 	return (unsigned char)cap_value(lv,1,4);
 }
@@ -4106,23 +4108,23 @@ unsigned char status_calc_attack_element(struct block_list *bl, struct status_ch
 {
 	if(!sc || !sc->count)
 		return element;
-	if(sc->data[SC_ENCHANTARMS])
-		return sc->data[SC_ENCHANTARMS]->val2;
-	if(sc->data[SC_WATERWEAPON])
+	if(sc_get(sc,SC_ENCHANTARMS))
+		return sc_get(sc,SC_ENCHANTARMS)->val2;
+	if(sc_get(sc,SC_WATERWEAPON))
 		return ELE_WATER;
-	if(sc->data[SC_EARTHWEAPON])
+	if(sc_get(sc,SC_EARTHWEAPON))
 		return ELE_EARTH;
-	if(sc->data[SC_FIREWEAPON])
+	if(sc_get(sc,SC_FIREWEAPON))
 		return ELE_FIRE;
-	if(sc->data[SC_WINDWEAPON])
+	if(sc_get(sc,SC_WINDWEAPON))
 		return ELE_WIND;
-	if(sc->data[SC_ENCPOISON])
+	if(sc_get(sc,SC_ENCPOISON))
 		return ELE_POISON;
-	if(sc->data[SC_ASPERSIO])
+	if(sc_get(sc,SC_ASPERSIO))
 		return ELE_HOLY;
-	if(sc->data[SC_SHADOWWEAPON])
+	if(sc_get(sc,SC_SHADOWWEAPON))
 		return ELE_DARK;
-	if(sc->data[SC_GHOSTWEAPON])
+	if(sc_get(sc,SC_GHOSTWEAPON))
 		return ELE_GHOST;
 	return (unsigned char)cap_value(element,0,UCHAR_MAX);
 }
@@ -4131,13 +4133,13 @@ static unsigned short status_calc_mode(struct block_list *bl, struct status_chan
 {
 	if(!sc || !sc->count)
 		return mode;
-	if(sc->data[SC_MODECHANGE]) {
-		if (sc->data[SC_MODECHANGE]->val2)
-			mode = sc->data[SC_MODECHANGE]->val2; //Set mode
-		if (sc->data[SC_MODECHANGE]->val3)
-			mode|= sc->data[SC_MODECHANGE]->val3; //Add mode
-		if (sc->data[SC_MODECHANGE]->val4)
-			mode&=~sc->data[SC_MODECHANGE]->val4; //Del mode
+	if(sc_get(sc,SC_MODECHANGE)) {
+		if (sc_get(sc,SC_MODECHANGE)->val2)
+			mode = sc_get(sc,SC_MODECHANGE)->val2; //Set mode
+		if (sc_get(sc,SC_MODECHANGE)->val3)
+			mode|= sc_get(sc,SC_MODECHANGE)->val3; //Add mode
+		if (sc_get(sc,SC_MODECHANGE)->val4)
+			mode&=~sc_get(sc,SC_MODECHANGE)->val4; //Del mode
 	}
 	return cap_value(mode,0,USHRT_MAX);
 }
@@ -4390,7 +4392,7 @@ int status_isdead(struct block_list *bl)
 int status_isimmune(struct block_list *bl)
 {
 	struct status_change *sc =status_get_sc(bl);
-	if (sc && sc->data[SC_HERMODE])
+	if (sc && sc_get(sc,SC_HERMODE))
 		return 100;
 
 	if (bl->type == BL_PC &&
@@ -4556,11 +4558,117 @@ struct status_change *status_get_sc(struct block_list *bl)
 	return NULL;
 }
 
+/// Looks up the slot of an active status change (binary search over the sorted slots).
+/// Returns the position where it would be inserted if it isn't there.
+static int status_sc_slot(const struct status_change* sc, enum sc_type type)
+{
+	const struct status_change_slot* slot = ( sc->slot ? sc->slot : sc->inline_slot );
+	int min = 0, max = sc->count;
+
+	while( min < max )
+	{
+		int mid = (min + max)/2;
+		if( slot[mid].type < type )
+			min = mid + 1;
+		else
+			max = mid;
+	}
+	return min;
+}
+
+/// Returns the entry of an active status change, or NULL.
+/// Normally reached through sc_get(), which checks the active bitset first.
+struct status_change_entry* status_sc_find(const struct status_change* sc, enum sc_type type)
+{
+	const struct status_change_slot* slot = ( sc->slot ? sc->slot : sc->inline_slot );
+	int i = status_sc_slot(sc, type);
+
+	if( i < sc->count && slot[i].type == type )
+		return slot[i].data;
+	return NULL;
+}
+
+/// Adds a new status change entry. The type must not be active already.
+static void status_sc_insert(struct status_change* sc, enum sc_type type, struct status_change_entry* sce)
+{
+	struct status_change_slot* slot;
+	int i = status_sc_slot(sc, type);
+
+	if( sc->slot == NULL && sc->count >= SC_INLINE_SLOTS )
+	{// spill the inline slots to the heap
+		sc->max_slot = SC_INLINE_SLOTS*2;
+		CREATE(sc->slot, struct status_change_slot, sc->max_slot);
+		memcpy(sc->slot, sc->inline_slot, sc->count*sizeof(struct status_change_slot));
+	}
+	else if( sc->slot != NULL && sc->count >= sc->max_slot )
+	{
+		sc->max_slot *= 2;
+		RECREATE(sc->slot, struct status_change_slot, sc->max_slot);
+	}
+
+	slot = ( sc->slot ? sc->slot : sc->inline_slot );
+	memmove(&slot[i+1], &slot[i], (sc->count - i)*sizeof(struct status_change_slot));
+	slot[i].type = (unsigned short)type;
+	slot[i].data = sce;
+	sc->active[type>>5] |= 1U<<(type&31);
+	++(sc->count);
+}
+
+/// Removes an active status change entry (the entry itself is not freed).
+static void status_sc_delete(struct status_change* sc, enum sc_type type)
+{
+	struct status_change_slot* slot = ( sc->slot ? sc->slot : sc->inline_slot );
+	int i = status_sc_slot(sc, type);
+
+	if( i >= sc->count || slot[i].type != type )
+		return;
+
+	memmove(&slot[i], &slot[i+1], (sc->count - i - 1)*sizeof(struct status_change_slot));
+	sc->active[type>>5] &= ~(1U<<(type&31));
+	--(sc->count);
+
+	if( sc->slot != NULL && sc->count <= SC_INLINE_SLOTS )
+	{// fits inline again, release the heap slots
+		memcpy(sc->inline_slot, sc->slot, sc->count*sizeof(struct status_change_slot));
+		aFree(sc->slot);
+		sc->slot = NULL;
+		sc->max_slot = 0;
+	}
+}
+
 void status_change_init(struct block_list *bl)
 {
 	struct status_change *sc = status_get_sc(bl);
 	nullpo_retv(sc);
 	memset(sc, 0, sizeof (struct status_change));
+	sc->timer = INVALID_TIMER;
+}
+
+/// Makes a status change entry due at the given tick.
+/// The SC timer of the unit is moved up if it would fire later than that.
+void status_change_settimer(struct block_list* bl, enum sc_type type, unsigned int tick)
+{
+	struct status_change* sc;
+	struct status_change_entry* sce;
+
+	nullpo_retv(bl);
+	sc = status_get_sc(bl);
+	if( sc == NULL || (sce = sc_get(sc,type)) == NULL )
+		return;
+
+	sce->tick = tick;
+	sce->timed = true;
+
+	if( sc->timer_running )
+		return; // rescheduled when status_change_timer is done
+	if( sc->timer != INVALID_TIMER )
+	{
+		if( DIFF_TICK(tick, sc->timer_tick) >= 0 )
+			return; // fires in time
+		delete_timer(sc->timer, status_change_timer);
+	}
+	sc->timer = add_timer(tick, status_change_timer, bl->id, 0);
+	sc->timer_tick = tick;
 }
 
 //Applies SC defense to a given status change.
@@ -4691,10 +4799,10 @@ int status_get_sc_def(struct block_list *bl, enum sc_type type, int rate, int ti
 	sc = status_get_sc(bl);
 	if (sc && sc->count)
 	{
-		if (sc->data[SC_SCRESIST])
-			sc_def += sc->data[SC_SCRESIST]->val1; //Status resist
-		else if (sc->data[SC_SIEGFRIED])
-			sc_def += sc->data[SC_SIEGFRIED]->val3; //Status resistance.
+		if (sc_get(sc,SC_SCRESIST))
+			sc_def += sc_get(sc,SC_SCRESIST)->val1; //Status resist
+		else if (sc_get(sc,SC_SIEGFRIED))
+			sc_def += sc_get(sc,SC_SIEGFRIED)->val3; //Status resistance.
 	}
 
 	//When no tick def, reduction is the same for both.
@@ -4710,8 +4818,8 @@ int status_get_sc_def(struct block_list *bl, enum sc_type type, int rate, int ti
 		{
 			if( sd->reseff[type-SC_COMMON_MIN] > 0 )
 				rate -= rate*sd->reseff[type-SC_COMMON_MIN]/10000;
-			if( sd->sc.data[SC_COMMONSC_RESIST] )
-				rate -= rate*sd->sc.data[SC_COMMONSC_RESIST]->val1/100;
+			if( sc_get(&sd->sc,SC_COMMONSC_RESIST) )
+				rate -= rate*sc_get(&sd->sc,SC_COMMONSC_RESIST)->val1/100;
 		}
 	}
 	if (!(rand()%10000 < rate))
@@ -4804,7 +4912,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 			return 0;
 	break;
 	case SC_AETERNA:
-		if( (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE) || sc->data[SC_FREEZE] )
+		if( (sc_get(sc,SC_STONE) && sc->opt1 == OPT1_STONE) || sc_get(sc,SC_FREEZE) )
 			return 0;
 	break;
 	case SC_KYRIE:
@@ -4812,29 +4920,29 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 			return 0;
 	break;
 	case SC_OVERTHRUST:
-		if (sc->data[SC_MAXOVERTHRUST])
+		if (sc_get(sc,SC_MAXOVERTHRUST))
 			return 0; //Overthrust can't take effect if under Max Overthrust. [Skotlex]
 	break;
 	case SC_ADRENALINE:
 		if(sd && !pc_check_weapontype(sd,skill_get_weapontype(BS_ADRENALINE)))
 			return 0;
-		if (sc->data[SC_QUAGMIRE] ||
-			sc->data[SC_DECREASEAGI]
+		if (sc_get(sc,SC_QUAGMIRE) ||
+			sc_get(sc,SC_DECREASEAGI)
 		)
 			return 0;
 	break;
 	case SC_ADRENALINE2:
 		if(sd && !pc_check_weapontype(sd,skill_get_weapontype(BS_ADRENALINE2)))
 			return 0;
-		if (sc->data[SC_QUAGMIRE] ||
-			sc->data[SC_DECREASEAGI]
+		if (sc_get(sc,SC_QUAGMIRE) ||
+			sc_get(sc,SC_DECREASEAGI)
 		)
 			return 0;
 	break;
 	case SC_ONEHAND:
 	case SC_MERC_QUICKEN:
 	case SC_TWOHANDQUICKEN:
-		if(sc->data[SC_DECREASEAGI])
+		if(sc_get(sc,SC_DECREASEAGI))
 			return 0;
 	case SC_CONCENTRATE:
 	case SC_INCREASEAGI:
@@ -4843,7 +4951,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 	case SC_WINDWALK:
 	case SC_CARTBOOST:
 	case SC_ASSNCROS:
-		if (sc->data[SC_QUAGMIRE])
+		if (sc_get(sc,SC_QUAGMIRE))
 			return 0;
 	break;
 	case SC_CLOAKING:
@@ -4859,17 +4967,17 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 		int mode;
 		struct status_data *bstatus = status_get_base_status(bl);
 		if (!bstatus) return 0;
-		if (sc->data[type])
+		if (sc_get(sc,type))
 		{	//Pile up with previous values.
-			if(!val2) val2 = sc->data[type]->val2;
-			val3 |= sc->data[type]->val3;
-			val4 |= sc->data[type]->val4;
+			if(!val2) val2 = sc_get(sc,type)->val2;
+			val3 |= sc_get(sc,type)->val3;
+			val4 |= sc_get(sc,type)->val4;
 		}
 		mode = val2?val2:bstatus->mode; //Base mode
 		if (val4) mode&=~val4; //Del mode
 		if (val3) mode|= val3; //Add mode
 		if (mode == bstatus->mode) { //No change.
-			if (sc->data[type]) //Abort previous status
+			if (sc_get(sc,type)) //Abort previous status
 				return status_change_end(bl, type, INVALID_TIMER);
 			return 0;
 		}
@@ -4949,51 +5057,51 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 			return 0; // Stats only for Mercenaries
 	break;
 	case SC_STRFOOD:
-		if (sc->data[SC_FOOD_STR_CASH] && sc->data[SC_FOOD_STR_CASH]->val1 > val1)
+		if (sc_get(sc,SC_FOOD_STR_CASH) && sc_get(sc,SC_FOOD_STR_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_AGIFOOD:
-		if (sc->data[SC_FOOD_AGI_CASH] && sc->data[SC_FOOD_AGI_CASH]->val1 > val1)
+		if (sc_get(sc,SC_FOOD_AGI_CASH) && sc_get(sc,SC_FOOD_AGI_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_VITFOOD:
-		if (sc->data[SC_FOOD_VIT_CASH] && sc->data[SC_FOOD_VIT_CASH]->val1 > val1)
+		if (sc_get(sc,SC_FOOD_VIT_CASH) && sc_get(sc,SC_FOOD_VIT_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_INTFOOD:
-		if (sc->data[SC_FOOD_INT_CASH] && sc->data[SC_FOOD_INT_CASH]->val1 > val1)
+		if (sc_get(sc,SC_FOOD_INT_CASH) && sc_get(sc,SC_FOOD_INT_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_DEXFOOD:
-		if (sc->data[SC_FOOD_DEX_CASH] && sc->data[SC_FOOD_DEX_CASH]->val1 > val1)
+		if (sc_get(sc,SC_FOOD_DEX_CASH) && sc_get(sc,SC_FOOD_DEX_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_LUKFOOD:
-		if (sc->data[SC_FOOD_LUK_CASH] && sc->data[SC_FOOD_LUK_CASH]->val1 > val1)
+		if (sc_get(sc,SC_FOOD_LUK_CASH) && sc_get(sc,SC_FOOD_LUK_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_FOOD_STR_CASH:
-		if (sc->data[SC_STRFOOD] && sc->data[SC_STRFOOD]->val1 > val1)
+		if (sc_get(sc,SC_STRFOOD) && sc_get(sc,SC_STRFOOD)->val1 > val1)
 			return 0;
 	break;
 	case SC_FOOD_AGI_CASH:
-		if (sc->data[SC_AGIFOOD] && sc->data[SC_AGIFOOD]->val1 > val1)
+		if (sc_get(sc,SC_AGIFOOD) && sc_get(sc,SC_AGIFOOD)->val1 > val1)
 			return 0;
 	break;
 	case SC_FOOD_VIT_CASH:
-		if (sc->data[SC_VITFOOD] && sc->data[SC_VITFOOD]->val1 > val1)
+		if (sc_get(sc,SC_VITFOOD) && sc_get(sc,SC_VITFOOD)->val1 > val1)
 			return 0;
 	break;
 	case SC_FOOD_INT_CASH:
-		if (sc->data[SC_INTFOOD] && sc->data[SC_INTFOOD]->val1 > val1)
+		if (sc_get(sc,SC_INTFOOD) && sc_get(sc,SC_INTFOOD)->val1 > val1)
 			return 0;
 	break;
 	case SC_FOOD_DEX_CASH:
-		if (sc->data[SC_DEXFOOD] && sc->data[SC_DEXFOOD]->val1 > val1)
+		if (sc_get(sc,SC_DEXFOOD) && sc_get(sc,SC_DEXFOOD)->val1 > val1)
 			return 0;
 	break;
 	case SC_FOOD_LUK_CASH:
-		if (sc->data[SC_LUKFOOD] && sc->data[SC_LUKFOOD]->val1 > val1)
+		if (sc_get(sc,SC_LUKFOOD) && sc_get(sc,SC_LUKFOOD)->val1 > val1)
 			return 0;
 	break;
 	}
@@ -5026,7 +5134,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 		//but cannot be plagiarized (this requires aegis investigation on packets and official behavior) [Brainstorm]
 		if ((!undead_flag && status->race!=RC_DEMON) || bl->type == BL_PC) {
 			status_change_end(bl, SC_CURSE, INVALID_TIMER);
-			if (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+			if (sc_get(sc,SC_STONE) && sc->opt1 == OPT1_STONE)
 				status_change_end(bl, SC_STONE, INVALID_TIMER);
 		}
 		break;
@@ -5066,11 +5174,11 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 		status_change_end(bl, SC_ASSUMPTIO, INVALID_TIMER);
 		break;
 	case SC_DELUGE:
-		if (sc->data[SC_FOGWALL] && sc->data[SC_BLIND])
+		if (sc_get(sc,SC_FOGWALL) && sc_get(sc,SC_BLIND))
 			status_change_end(bl, SC_BLIND, INVALID_TIMER);
 		break;
 	case SC_SILENCE:
-		if (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF)
+		if (sc_get(sc,SC_GOSPEL) && sc_get(sc,SC_GOSPEL)->val4 == BCT_SELF)
 			status_change_end(bl, SC_GOSPEL, INVALID_TIMER);
 		break;
 	case SC_HIDING:
@@ -5096,7 +5204,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 		status_change_end(bl, SC_ASSUMPTIO, INVALID_TIMER);
 		break;
 	case SC_CARTBOOST:
-		if(sc->data[SC_DECREASEAGI])
+		if(sc_get(sc,SC_DECREASEAGI))
 		{	//Cancel Decrease Agi, but take no further effect [Skotlex]
 			status_change_end(bl, SC_DECREASEAGI, INVALID_TIMER);
 			return 0;
@@ -5155,7 +5263,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 	}
 
 	//Check for overlapping fails
-	if( (sce = sc->data[type]) )
+	if( (sce = sc_get(sc,type)) )
 	{
 		switch( type )
 		{
@@ -5272,7 +5380,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 			break;
 		case SC_AUTOBERSERK:
 			if (status->hp < status->max_hp>>2 &&
-				(!sc->data[SC_PROVOKE] || sc->data[SC_PROVOKE]->val2==0))
+				(!sc_get(sc,SC_PROVOKE) || sc_get(sc,SC_PROVOKE)->val2==0))
 					sc_start4(bl,SC_PROVOKE,100,10,1,0,0,60000);
 			tick = -1;
 			break;
@@ -5537,7 +5645,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 		case SC_CHASEWALK:
 			val2 = tick>0?tick:10000; //Interval at which SP is drained.
 			val3 = 35 - 5 * val1; //Speed adjustment.
-			if (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_ROGUE)
+			if (sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_ROGUE)
 				val3 -= 40;
 			val4 = 10+val1*2; //SP cost.
 			if (map_flag_gvg(bl->m) || map[bl->m].flag.battleground) val4 *= 5;
@@ -5647,7 +5755,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 			break;
 
 		case SC_BERSERK:
-			if (!sc->data[SC_ENDURE] || !sc->data[SC_ENDURE]->val4)
+			if (!sc_get(sc,SC_ENDURE) || !sc_get(sc,SC_ENDURE)->val4)
 				sc_start4(bl, SC_ENDURE, 100,10,0,0,2, tick);
 			//HP healing is performing after the calc_status call.
 			//Val2 holds HP penalty
@@ -5685,7 +5793,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 			// fetch caster information
 			struct block_list *pbl = map_id2bl(val1);
 			struct status_change *psc = pbl?status_get_sc(pbl):NULL;
-			struct status_change_entry *psce = psc?psc->data[SC_MARIONETTE]:NULL;
+			struct status_change_entry *psce = psc?sc_get(psc,SC_MARIONETTE):NULL;
 			// fetch target's stats
 			struct status_data* status = status_get_status_data(bl); // battle status
 
@@ -5740,8 +5848,8 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 				while( i >= 0 )
 				{
 					type2 = types[i];
-					if( d_sc->data[type2] )
-						sc_start(bl, type2, 100, d_sc->data[type2]->val1, skill_get_time(status_sc2skill(type2),d_sc->data[type2]->val1));
+					if( sc_get(d_sc,type2) )
+						sc_start(bl, type2, 100, sc_get(d_sc,type2)->val1, skill_get_time(status_sc2skill(type2),sc_get(d_sc,type2)->val1));
 					i--;
 				}
 			}
@@ -5756,14 +5864,13 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 		{
 			struct block_list *src = val2?map_id2bl(val2):NULL;
 			struct status_change *sc2 = src?status_get_sc(src):NULL;
-			struct status_change_entry *sce2 = sc2?sc2->data[SC_CLOSECONFINE]:NULL;
+			struct status_change_entry *sce2 = sc2?sc_get(sc2,SC_CLOSECONFINE):NULL;
 			if (src && sc2) {
 				if (!sce2) //Start lock on caster.
 					sc_start4(src,SC_CLOSECONFINE,100,val1,1,0,0,tick+1000);
 				else { //Increase count of locked enemies and refresh time.
 					(sce2->val2)++;
-					delete_timer(sce2->timer, status_change_timer);
-					sce2->timer = add_timer(gettick()+tick+1000, status_change_timer, src->id, SC_CLOSECONFINE);
+					status_change_settimer(src, SC_CLOSECONFINE, gettick()+tick+1000);
 				}
 			} else //Status failed.
 				return 0;
@@ -6286,24 +6393,19 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 		clif_status_load(bl,StatusIconChangeTable[type],1);
 
 	//Don't trust the previous sce assignment, in case the SC ended somewhere between there and here.
-	if((sce=sc->data[type]))
-	{// reuse old sc
-		if( sce->timer != INVALID_TIMER )
-			delete_timer(sce->timer, status_change_timer);
-	}
-	else
+	if(!(sce=sc_get(sc,type)))
 	{// new sc
-		++(sc->count);
-		sce = sc->data[type] = ers_alloc(sc_data_ers, struct status_change_entry);
+		sce = ers_alloc(sc_data_ers, struct status_change_entry);
+		status_sc_insert(sc, type, sce);
 	}
 	sce->val1 = val1;
 	sce->val2 = val2;
 	sce->val3 = val3;
 	sce->val4 = val4;
 	if (tick >= 0)
-		sce->timer = add_timer(gettick() + tick, status_change_timer, bl->id, type);
+		status_change_settimer(bl, type, gettick() + tick);
 	else
-		sce->timer = INVALID_TIMER; //Infinite duration
+		sce->timed = false; //Infinite duration
 
 	if (calc_flag)
 		status_calc_bl(bl,calc_flag);
@@ -6379,6 +6481,7 @@ int status_change_start(struct block_list* bl,enum sc_type type,int rate,int val
 int status_change_clear(struct block_list* bl, int type)
 {
 	struct status_change* sc;
+	struct status_change_entry* sce;
 	int i;
 
 	sc = status_get_sc(bl);
@@ -6388,7 +6491,7 @@ int status_change_clear(struct block_list* bl, int type)
 
 	for(i = 0; i < SC_MAX; i++)
 	{
-		if(!sc->data[i])
+		if(!sc_get(sc,i))
 		  continue;
 
 		if(type == 0)
@@ -6425,16 +6528,19 @@ int status_change_clear(struct block_list* bl, int type)
 
 		status_change_end(bl, (sc_type)i, INVALID_TIMER);
 
-		if( type == 1 && sc->data[i] )
+		if( type == 1 && (sce = sc_get(sc,i)) != NULL )
 		{	//If for some reason status_change_end decides to still keep the status when quitting. [Skotlex]
-			(sc->count)--;
-			if (sc->data[i]->timer != INVALID_TIMER)
-				delete_timer(sc->data[i]->timer, status_change_timer);
-			ers_free(sc_data_ers, sc->data[i]);
-			sc->data[i] = NULL;
+			status_sc_delete(sc, (sc_type)i);
+			ers_free(sc_data_ers, sce);
 		}
 	}
 
+	if( type == 1 && sc->timer != INVALID_TIMER && !sc->timer_running )
+	{// nothing left to time
+		delete_timer(sc->timer, status_change_timer);
+		sc->timer = INVALID_TIMER;
+	}
+
 	sc->opt1 = 0;
 	sc->opt2 = 0;
 	sc->opt3 = 0;
@@ -6463,20 +6569,19 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 	sc = status_get_sc(bl);
 	status = status_get_status_data(bl);
 
-	if(type < 0 || type >= SC_MAX || !sc || !(sce = sc->data[type]))
+	if(type < 0 || type >= SC_MAX || !sc || !(sce = sc_get(sc,type)))
 		return 0;
 
 	sd = BL_CAST(BL_PC,bl);
 
-	if (sce->timer != tid && tid != INVALID_TIMER)
-		return 0;
+	if (tid != INVALID_TIMER && sce->timed)
+		return 0; // rescheduled since the timer picked it up
 
 	if (tid == INVALID_TIMER) {
 		if (type == SC_ENDURE && sce->val4)
 			//Do not end infinite endure.
 			return 0;
-		if (sce->timer != INVALID_TIMER) //Could be a SC with infinite duration
-			delete_timer(sce->timer,status_change_timer);
+		sce->timed = false; //The unit's SC timer skips entries that aren't timed
 		if (sc->opt1)
 		switch (type) {
 			//"Ugly workaround"  [Skotlex]
@@ -6492,14 +6597,13 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 				//since these SC are not affected by it, and it lets us know
 				//if we have already delayed this attack or not.
 				sce->val1 = 0;
-				sce->timer = add_timer(gettick()+10, status_change_timer, bl->id, type);
+				status_change_settimer(bl, type, gettick()+10);
 				return 1;
 			}
 		}
 	}
 
-	sc->data[type] = NULL;
-	(sc->count)--;
+	status_sc_delete(sc, type);
 
 	vd = status_get_viewdata(bl);
 	calc_flag = StatusChangeFlagTable[type];
@@ -6545,7 +6649,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 		}
 		break;
 		case SC_AUTOBERSERK:
-			if (sc->data[SC_PROVOKE] && sc->data[SC_PROVOKE]->val2 == 1)
+			if (sc_get(sc,SC_PROVOKE) && sc_get(sc,SC_PROVOKE)->val2 == 1)
 				status_change_end(bl, SC_PROVOKE, INVALID_TIMER);
 			break;
 
@@ -6560,14 +6664,14 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 					int i;
 					for( i = 0; i < 5; i++ )
 					{
-						if( sd->devotion[i] && (tsd = map_id2sd(sd->devotion[i])) && tsd->sc.data[type] )
+						if( sd->devotion[i] && (tsd = map_id2sd(sd->devotion[i])) && sc_get(&tsd->sc,type) )
 							status_change_end(&tsd->bl, type, INVALID_TIMER);
 					}
 				}
 				else if( bl->type == BL_MER && ((TBL_MER*)bl)->devotion_flag )
 				{ // Clear Status from Master
 					tsd = ((TBL_MER*)bl)->master;
-					if( tsd && tsd->sc.data[type] )
+					if( tsd && sc_get(&tsd->sc,type) )
 						status_change_end(&tsd->bl, type, INVALID_TIMER);
 				}
 			}
@@ -6598,9 +6702,9 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 				struct block_list *tbl = map_id2bl(tid);
 				struct status_change *tsc = status_get_sc(tbl);
 				sce->val4 = 0;
-				if(tbl && tsc && tsc->data[SC_BLADESTOP])
+				if(tbl && tsc && sc_get(tsc,SC_BLADESTOP))
 				{
-					tsc->data[SC_BLADESTOP]->val4 = 0;
+					sc_get(tsc,SC_BLADESTOP)->val4 = 0;
 					status_change_end(tbl, SC_BLADESTOP, INVALID_TIMER);
 				}
 				clif_bladestop(bl, tid, 0);
@@ -6631,7 +6735,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 
 				if(sce->val4 && sce->val4 != BCT_SELF && (dsd=map_id2sd(sce->val4)))
 				{// end status on partner as well
-					dsc = dsd->sc.data[SC_DANCING];
+					dsc = sc_get(&dsd->sc,SC_DANCING);
 					if(dsc)
 					{	//This will prevent recursive loops. 
 						dsc->val2 = dsc->val4 = 0;
@@ -6646,7 +6750,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 					if( group == NULL )
 					{
 						ShowDebug("status_change_end: SC_DANCING is missing skill unit group (val1=%d, val2=%d, val3=%d, val4=%d, timer=%d, tid=%d, char_id=%d, map=%s, x=%d, y=%d, prev=%s:%d, from=%s:%d). Please report this! (#3504)\n",
-							sce->val1, sce->val2, sce->val3, sce->val4, sce->timer, tid,
+							sce->val1, sce->val2, sce->val3, sce->val4, sce->timed, tid,
 							sd ? sd->status.char_id : 0,
 							mapindex_id2name(map_id2index(bl->m)), bl->x, bl->y,
 							prevfile, prevline,
@@ -6682,10 +6786,10 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 			{
 				struct block_list *src = sce->val2?map_id2bl(sce->val2):NULL;
 				struct status_change *sc2 = src?status_get_sc(src):NULL;
-				if (src && sc2 && sc2->data[SC_CLOSECONFINE]) {
+				if (src && sc2 && sc_get(sc2,SC_CLOSECONFINE)) {
 					//If status was already ended, do nothing.
 					//Decrease count
-					if (--(sc2->data[SC_CLOSECONFINE]->val1) <= 0) //No more holds, free him up.
+					if (--(sc_get(sc2,SC_CLOSECONFINE)->val1) <= 0) //No more holds, free him up.
 						status_change_end(src, SC_CLOSECONFINE, INVALID_TIMER);
 				}
 			}
@@ -6721,9 +6825,9 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 				struct block_list *pbl = map_id2bl(sce->val1);
 				struct status_change* sc2 = pbl?status_get_sc(pbl):NULL;
 				
-				if (sc2 && sc2->data[type2])
+				if (sc2 && sc_get(sc2,type2))
 				{
-					sc2->data[type2]->val1 = 0;
+					sc_get(sc2,type2)->val1 = 0;
 					status_change_end(pbl, type2, INVALID_TIMER);
 				}
 			}
@@ -6733,9 +6837,9 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 			//If val2 is removed, no HP penalty (dispelled?) [Skotlex]
 			if(status->hp > 100 && sce->val2)
 				status_set_hp(bl, 100, 0); 
-			if(sc->data[SC_ENDURE] && sc->data[SC_ENDURE]->val4 == 2)
+			if(sc_get(sc,SC_ENDURE) && sc_get(sc,SC_ENDURE)->val4 == 2)
 			{
-				sc->data[SC_ENDURE]->val4 = 0;
+				sc_get(sc,SC_ENDURE)->val4 = 0;
 				status_change_end(bl, SC_ENDURE, INVALID_TIMER);
 			}
 			sc_start4(bl, SC_REGENERATION, 100, 10,0,0,(RGN_HP|RGN_SP), skill_get_time(LK_BERSERK, sce->val1));
@@ -6798,7 +6902,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 			{
 				struct block_list* tbl = map_id2bl(sce->val2);
 				sce->val2 = 0;
-				if( tbl && (sc = status_get_sc(tbl)) && sc->data[SC_STOP] && sc->data[SC_STOP]->val2 == bl->id )
+				if( tbl && (sc = status_get_sc(tbl)) && sc_get(sc,SC_STOP) && sc_get(sc,SC_STOP)->val2 == bl->id )
 					status_change_end(tbl, SC_STOP, INVALID_TIMER);
 			}
 			break;
@@ -6969,7 +7073,12 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 		clif_changeoption(bl);
 
 	if (calc_flag)
-		status_calc_bl(bl,calc_flag);
+	{
+		if (tid != INVALID_TIMER && sc->timer_running)
+			sc->calc_flag |= calc_flag; //Done once the SC timer is through
+		else
+			status_calc_bl(bl,calc_flag);
+	}
 
 	if(opt_flag&4) //Out of hiding, invoke on place.
 		skill_unit_move(bl,gettick(),1);
@@ -6991,7 +7100,7 @@ int kaahi_heal_timer(int tid, unsigned int tick, int id, intptr_t data)
 
 	if(!((bl=map_id2bl(id))&&
 		(sc=status_get_sc(bl)) &&
-		(sce = sc->data[SC_KAAHI])))
+		(sce = sc_get(sc,SC_KAAHI))))
 		return 0;
 
 	if(sce->val4 != tid) {
@@ -7018,44 +7127,21 @@ int kaahi_heal_timer(int tid, unsigned int tick, int id, intptr_t data)
 /*==========================================
  * Xe[^XُI^C}[
  *------------------------------------------*/
-int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
+static int status_change_timer_entry(struct block_list* bl, struct status_change* sc, enum sc_type type, int tid, unsigned int tick)
 {
-	enum sc_type type = (sc_type)data;
-	struct block_list *bl;
 	struct map_session_data *sd;
 	struct status_data *status;
-	struct status_change *sc;
-	struct status_change_entry *sce;
+	struct status_change_entry *sce = sc_get(sc,type);
 
-	bl = map_id2bl(id);
-	if(!bl)
-	{
-		ShowDebug("status_change_timer: Null pointer id: %d data: %d\n", id, data);
-		return 0;
-	}
-	sc = status_get_sc(bl);
 	status = status_get_status_data(bl);
-	
-	if(!(sc && (sce = sc->data[type])))
-	{
-		ShowDebug("status_change_timer: Null pointer id: %d data: %d bl-type: %d\n", id, data, bl->type);
-		return 0;
-	}
-
-	if( sce->timer != tid )
-	{
-		ShowError("status_change_timer: Mismatch for type %d: %d != %d (bl id %d)\n",type,tid,sce->timer, bl->id);
-		return 0;
-	}
-
 	sd = BL_CAST(BL_PC, bl);
 
 // set the next timer of the sce (don't assume the status still exists)
-#define sc_timer_next(t,f,i,d) \
-	if( (sce=sc->data[type]) ) \
-		sce->timer = add_timer(t,f,i,d); \
+#define sc_timer_next(t) \
+	if( (sce=sc_get(sc,type)) ) \
+		status_change_settimer(bl, type, t); \
 	else \
-		ShowError("status_change_timer: Unexpected NULL status change id: %d data: %d\n", id, data)
+		ShowError("status_change_timer: Unexpected NULL status change id: %d type: %d\n", bl->id, type)
 
 	switch(type)
 	{
@@ -7063,26 +7149,26 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 	case SC_CLOAKING:
 		if(!status_charge(bl, 0, 1))
 			break; //Not enough SP to continue.
-		sc_timer_next(sce->val2+tick, status_change_timer, bl->id, data);
+		sc_timer_next(sce->val2+tick);
 		return 0;
 
 	case SC_CHASEWALK:
 		if(!status_charge(bl, 0, sce->val4))
 			break; //Not enough SP to continue.
 			
-		if (!sc->data[SC_INCSTR]) {
+		if (!sc_get(sc,SC_INCSTR)) {
 			sc_start(bl, SC_INCSTR,100,1<<(sce->val1-1),
-				(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_ROGUE?10:1) //SL bonus -> x10 duration
+				(sc_get(sc,SC_SPIRIT) && sc_get(sc,SC_SPIRIT)->val2 == SL_ROGUE?10:1) //SL bonus -> x10 duration
 				*skill_get_time2(status_sc2skill(type),sce->val1));
 		}
-		sc_timer_next(sce->val2+tick, status_change_timer, bl->id, data);
+		sc_timer_next(sce->val2+tick);
 		return 0;
 	break;
 
 	case SC_SKA:  
 		if(--(sce->val2)>0){  
 			sce->val3 = rand()%100; //Random defense.  
-			sc_timer_next(1000+tick, status_change_timer,bl->id, data);  
+			sc_timer_next(1000+tick);  
 			return 0;  
 		}  
 		break;
@@ -7093,7 +7179,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			if(sce->val2 % sce->val4 == 0 && !status_charge(bl, 0, 1))
 				break; //Fail if it's time to substract SP and there isn't.
 		
-			sc_timer_next(1000+tick, status_change_timer,bl->id, data);
+			sc_timer_next(1000+tick);
 			return 0;
 		}
 	break;
@@ -7104,14 +7190,14 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 		map_foreachinrange( status_change_timer_sub, bl, sce->val3, BL_CHAR, bl, sce, type, tick);
 
 		if( --(sce->val2)>0 ){
-			sc_timer_next(250+tick, status_change_timer, bl->id, data);
+			sc_timer_next(250+tick);
 			return 0;
 		}
 		break;
 		
 	case SC_PROVOKE:
 		if(sce->val2) { //Auto-provoke (it is ended in status_heal)
-			sc_timer_next(1000*60+tick,status_change_timer, bl->id, data );
+			sc_timer_next(1000*60+tick);
 			return 0;
 		}
 		break;
@@ -7122,14 +7208,14 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			unit_stop_walking(bl,1);
 			sc->opt1 = OPT1_STONE;
 			clif_changeoption(bl);
-			sc_timer_next(1000+tick,status_change_timer, bl->id, data );
+			sc_timer_next(1000+tick);
 			status_calc_bl(bl, StatusChangeFlagTable[type]);
 			return 0;
 		}
 		if(--(sce->val3) > 0) {
 			if(++(sce->val4)%5 == 0 && status->hp > status->max_hp/4)
 				status_percent_damage(NULL, bl, 1, 0, false);
-			sc_timer_next(1000+tick,status_change_timer, bl->id, data );
+			sc_timer_next(1000+tick);
 			return 0;
 		}
 		break;
@@ -7139,22 +7225,22 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			break;
 	case SC_DPOISON:
 		if (--(sce->val3) > 0) {
-			if (!sc->data[SC_SLOWPOISON]) {
+			if (!sc_get(sc,SC_SLOWPOISON)) {
 				bool flag;
 				map_freeblock_lock();
 				status_zap(bl, sce->val4, 0);
-				flag = !sc->data[type]; //We check for this rather than 'killed' since the target could have revived with kaizel.
+				flag = !sc_get(sc,type); //We check for this rather than 'killed' since the target could have revived with kaizel.
 				map_freeblock_unlock();
 				if (flag) return 0; //target died, SC cancelled already.
 			}
-			sc_timer_next(1000 + tick, status_change_timer, bl->id, data );
+			sc_timer_next(1000 + tick);
 			return 0;
 		}
 		break;
 
 	case SC_TENSIONRELAX:
 		if(status->max_hp > status->hp && --(sce->val3) > 0){
-			sc_timer_next(sce->val4+tick, status_change_timer, bl->id, data);
+			sc_timer_next(sce->val4+tick);
 			return 0;
 		}
 		break;
@@ -7165,7 +7251,6 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			bl->m == sd->feel_map[1].m ||
 			bl->m == sd->feel_map[2].m)
 		{	//Timeout will be handled by pc_setpos
-			sce->timer = INVALID_TIMER;
 			return 0;
 		}
 		break;
@@ -7176,11 +7261,11 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			unsigned int hp =  rand()%600 + 200;
 			map_freeblock_lock();
 			status_fix_damage(NULL, bl, ( sd || hp < status->hp ) ? hp : status->hp-1, 0);
-			flag = !sc->data[type];
+			flag = !sc_get(sc,type);
 			map_freeblock_unlock();
 			if( !flag ) {
 				if( status->hp == 1 ) break;
-				sc_timer_next(10000 + tick, status_change_timer, bl->id, data);
+				sc_timer_next(10000 + tick);
 			}
 			return 0;
 		}
@@ -7195,7 +7280,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			if( status->hp < status->max_hp )
 				hp = (sce->val1 < 0) ? (int)(sd->status.max_hp * -1 * sce->val1 / 100.) : sce->val1 ;
 			status_heal(bl, hp, 0, 2);
-			sc_timer_next((sce->val2 * 1000) + tick, status_change_timer, bl->id, data);
+			sc_timer_next((sce->val2 * 1000) + tick);
 			return 0;
 		}
 		break;
@@ -7208,7 +7293,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			{
 				clif_bossmapinfo(sd->fd, boss_md, 1); // Update X - Y on minimap
 				if (boss_md->bl.prev != NULL) {
-					sc_timer_next(5000 + tick, status_change_timer, bl->id, data);
+					sc_timer_next(5000 + tick);
 					return 0;
 				}
 			}
@@ -7258,12 +7343,12 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			}
 			if( s != 0 && sce->val3 % s == 0 )
 			{
-				if (sc->data[SC_LONGING])
+				if (sc_get(sc,SC_LONGING))
 					sp*= 3;
 				if (!status_charge(bl, 0, sp))
 					break;
 			}
-			sc_timer_next(1000+tick, status_change_timer, bl->id, data);
+			sc_timer_next(1000+tick);
 			return 0;
 		}
 		break;
@@ -7272,7 +7357,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 		// 5% every 10 seconds [DracoRPG]
 		if( --( sce->val3 ) > 0 && status_charge(bl, sce->val2, 0) && status->hp > 100 )
 		{
-			sc_timer_next(sce->val4+tick, status_change_timer, bl->id, data);
+			sc_timer_next(sce->val4+tick);
 			return 0;
 		}
 		break;
@@ -7283,7 +7368,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			pc_onstatuschanged(sd,SP_MANNER);
 			if (sd->status.manner < 0)
 			{	//Every 60 seconds your manner goes up by 1 until it gets back to 0.
-				sc_timer_next(60000+tick, status_change_timer, bl->id, data);
+				sc_timer_next(60000+tick);
 				return 0;
 			}
 		}
@@ -7297,7 +7382,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 		//	clif_message(bl, timer);
 		//}
 		if((sce->val4 -= 500) > 0) {
-			sc_timer_next(500 + tick, status_change_timer, bl->id, data);
+			sc_timer_next(500 + tick);
 			return 0;
 		}
 		break;
@@ -7308,7 +7393,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			struct block_list *pbl = map_id2bl(sce->val1);
 			if( pbl && check_distance_bl(bl, pbl, 7) )
 			{
-				sc_timer_next(1000 + tick, status_change_timer, bl->id, data);
+				sc_timer_next(1000 + tick);
 				return 0;
 			}
 		}
@@ -7322,7 +7407,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			sp = (sce->val1 > 5) ? 35 : 20;
 			if(!status_charge(bl, hp, sp))
 				break;
-			sc_timer_next(10000+tick, status_change_timer, bl->id, data);
+			sc_timer_next(10000+tick);
 			return 0;
 		}
 		break;
@@ -7332,7 +7417,7 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 			struct block_list *tbl = map_id2bl(sce->val2);
 			
 			if (tbl && battle_check_range(bl, tbl, 2)){
-				sc_timer_next(1000 + tick, status_change_timer, bl->id, data);
+				sc_timer_next(1000 + tick);
 				return 0;
 			}
 		}
@@ -7341,15 +7426,15 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 	case SC_JAILED:
 		if(sce->val1 == INT_MAX || --(sce->val1) > 0)
 		{
-			sc_timer_next(60000+tick, status_change_timer, bl->id,data);
+			sc_timer_next(60000+tick);
 			return 0;
 		}
 		break;
 
 	case SC_BLIND:
-		if(sc->data[SC_FOGWALL]) 
+		if(sc_get(sc,SC_FOGWALL)) 
 		{	//Blind lasts forever while you are standing on the fog.
-			sc_timer_next(5000+tick, status_change_timer, bl->id, data);
+			sc_timer_next(5000+tick);
 			return 0;
 		}
 		break;
@@ -7360,6 +7445,83 @@ int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
 #undef sc_timer_next
 }
 
+/*==========================================
+ * SC timer of a unit, handles all its entries that are due
+ * and is put back at the earliest entry that is left.
+ *------------------------------------------*/
+int status_change_timer(int tid, unsigned int tick, int id, intptr_t data)
+{
+	struct block_list *bl;
+	struct status_change *sc;
+	struct status_change_entry *sce;
+	unsigned short due[SC_MAX];
+	int i, count = 0;
+
+	bl = map_id2bl(id);
+	if(!bl)
+	{
+		ShowDebug("status_change_timer: Null pointer id: %d\n", id);
+		return 0;
+	}
+	sc = status_get_sc(bl);
+	if(!sc)
+	{
+		ShowDebug("status_change_timer: Null pointer id: %d bl-type: %d\n", id, bl->type);
+		return 0;
+	}
+	if( sc->timer != tid )
+	{
+		ShowError("status_change_timer: Mismatch: %d != %d (bl id %d)\n",tid,sc->timer, bl->id);
+		return 0;
+	}
+	sc->timer = INVALID_TIMER;
+
+	// the handlers add and remove entries, so pick the due types first
+	for( i = 0; i < sc->count; i++ )
+	{
+		const struct status_change_slot* slot = ( sc->slot ? sc->slot : sc->inline_slot );
+		sce = slot[i].data;
+		if( sce->timed && DIFF_TICK(sce->tick, tick) <= 0 )
+			due[count++] = slot[i].type;
+	}
+
+	map_freeblock_lock();
+	sc->timer_running = true;
+	sc->calc_flag = 0;
+	for( i = 0; i < count; i++ )
+	{
+		enum sc_type type = (sc_type)due[i];
+		if( (sce = sc_get(sc,type)) == NULL || !sce->timed || DIFF_TICK(sce->tick, tick) > 0 )
+			continue; // ended or rescheduled by an earlier handler
+		sce->timed = false;
+		status_change_timer_entry(bl, sc, type, tid, tick);
+	}
+	sc->timer_running = false;
+	if( sc->calc_flag )
+	{
+		status_calc_bl(bl, sc->calc_flag);
+		sc->calc_flag = 0;
+	}
+
+	// put the timer back at the earliest entry
+	count = 0;
+	for( i = 0; i < sc->count; i++ )
+	{
+		const struct status_change_slot* slot = ( sc->slot ? sc->slot : sc->inline_slot );
+		sce = slot[i].data;
+		if( sce->timed && (count++ == 0 || DIFF_TICK(sce->tick, tick) < 0) )
+			tick = sce->tick;
+	}
+	if( count )
+	{
+		sc->timer = add_timer(tick, status_change_timer, bl->id, 0);
+		sc->timer_tick = tick;
+	}
+	map_freeblock_unlock();
+
+	return 0;
+}
+
 /*==========================================
  * Xe[^Xُ^C}[͈͏
  *------------------------------------------*/
@@ -7385,7 +7547,7 @@ int status_change_timer_sub(struct block_list* bl, va_list ap)
 		status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 		break;
 	case SC_RUWACH:	/* At */
-		if (tsc && (tsc->data[SC_HIDING] || tsc->data[SC_CLOAKING])) {
+		if (tsc && (sc_get(tsc,SC_HIDING) || sc_get(tsc,SC_CLOAKING))) {
 			status_change_end(bl, SC_HIDING, INVALID_TIMER);
 			status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 			if(battle_check_target( src, bl, BCT_ENEMY ) > 0)
@@ -7402,8 +7564,8 @@ int status_change_timer_sub(struct block_list* bl, va_list ap)
 		break;
 	case SC_CLOSECONFINE:
 		//Lock char has released the hold on everyone...
-		if (tsc && tsc->data[SC_CLOSECONFINE2] && tsc->data[SC_CLOSECONFINE2]->val2 == src->id) {
-			tsc->data[SC_CLOSECONFINE2]->val2 = 0;
+		if (tsc && sc_get(tsc,SC_CLOSECONFINE2) && sc_get(tsc,SC_CLOSECONFINE2)->val2 == src->id) {
+			sc_get(tsc,SC_CLOSECONFINE2)->val2 = 0;
 			status_change_end(bl, SC_CLOSECONFINE2, INVALID_TIMER);
 		}
 		break;
@@ -7431,7 +7593,7 @@ int status_change_clear_buffs (struct block_list* bl, int type)
 
 	for( i = SC_COMMON_MAX+1; i < SC_MAX; i++ )
 	{
-		if(!sc->data[i])
+		if(!sc_get(sc,i))
 			continue;
 		
 		switch (i) {
@@ -7495,7 +7657,7 @@ int status_change_clear_buffs (struct block_list* bl, int type)
 			case SC_BERSERK:
 				if (!(type&1))
 					continue;
-			  	sc->data[i]->val2 = 0;
+			  	sc_get(sc,i)->val2 = 0;
 				break;
 			default:
 				if (!(type&1))
@@ -1219,10 +1219,18 @@ struct regen_data {
 };
 
 struct status_change_entry {
-	int timer;
+	unsigned int tick; // when the entry is due, if it's timed
+	bool timed; // whether the entry waits on the SC timer of its unit (false for infinite duration)
 	int val1,val2,val3,val4;
 };
 
+#define SC_INLINE_SLOTS 4
+
+struct status_change_slot {
+	unsigned short type;
+	struct status_change_entry* data;
+};
+
 struct status_change {
 	unsigned int option;// effect state (bitfield)
 	unsigned int opt3;// skill state (bitfield)
@@ -1234,9 +1242,28 @@ struct status_change {
 	unsigned short mp_matk_min, mp_matk_max; //Previous matk min/max for ground spells (Amplify magic power)
 	int sg_id; //ID of the previous Storm gust that hit you
 	unsigned char sg_counter; //Storm gust counter (previous hits from storm gust)
-	struct status_change_entry *data[SC_MAX];
+	// Active status changes, kept sparse since most units carry only a handful.
+	// 'active' has one bit per sc_type, the slots are sorted by type and live in
+	// 'inline_slot' until more than SC_INLINE_SLOTS are active at the same time.
+	// Use sc_get() to read an entry; status.c is the only place that adds/removes them.
+	uint32 active[(SC_MAX+31)/32];
+	unsigned short max_slot; // capacity of 'slot' (0 while inline_slot is in use)
+	struct status_change_slot* slot;
+	struct status_change_slot inline_slot[SC_INLINE_SLOTS];
+	// One timer per unit serves all its timed entries, it is due at the earliest
+	// entry tick (see status_change_settimer). While it runs, the recalculations of
+	// the entries it ends are merged into 'calc_flag' and done once at the end.
+	int timer;
+	unsigned int timer_tick;
+	bool timer_running;
+	int calc_flag;
 };
 
+/// Returns the status_change_entry of the given type, or NULL if it isn't active.
+/// Arguments are evaluated more than once.
+#define sc_get(sc, type) ( ((sc)->active[(type)>>5]&(1U<<((type)&31))) ? status_sc_find((sc),(enum sc_type)(type)) : (struct status_change_entry*)NULL )
+struct status_change_entry* status_sc_find(const struct status_change* sc, enum sc_type type);
+
 // for looking up associated data
 sc_type status_skill2sc(int skill);
 int status_sc2skill(sc_type sc);
@@ -1330,6 +1357,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 #define status_change_end(bl,type,tid) status_change_end_(bl,type,tid,__FILE__,__LINE__)
 int kaahi_heal_timer(int tid, unsigned int tick, int id, intptr_t data);
 int status_change_timer(int tid, unsigned int tick, int id, intptr_t data);
+void status_change_settimer(struct block_list* bl, enum sc_type type, unsigned int tick);
 int status_change_timer_sub(struct block_list* bl, va_list ap);
 int status_change_clear(struct block_list* bl, int type);
 int status_change_clear_buffs(struct block_list* bl, int type);
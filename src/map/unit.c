@@ -65,7 +65,12 @@ int unit_walktoxy_sub(struct block_list *bl)
 	ud = unit_bl2ud(bl);
 	if(ud == NULL) return 0;
 
-	if( !path_search(&wpd,bl->m,bl->x,bl->y,ud->to_x,ud->to_y,ud->state.walk_easy,CELL_CHKNOPASS) )
+	if( ud->target && !ud->state.walk_easy )
+	{// chasing, other units are likely heading the same way
+		if( !path_search_flow(&wpd,bl->m,bl->x,bl->y,ud->to_x,ud->to_y,CELL_CHKNOPASS) )
+			return 0;
+	}
+	else if( !path_search(&wpd,bl->m,bl->x,bl->y,ud->to_x,ud->to_y,ud->state.walk_easy,CELL_CHKNOPASS) )
 		return 0;
 
 	memcpy(&ud->walkpath,&wpd,sizeof(wpd));
@@ -312,7 +317,7 @@ int unit_walktoxy( struct block_list *bl, short x, short y, int flag)
 	ud->to_y = y;
 	
 	sc = status_get_sc(bl);
-	if (sc && sc->data[SC_CONFUSION]) //Randomize the target position
+	if (sc && sc_get(sc,SC_CONFUSION)) //Randomize the target position
 		map_random_dir(bl, &ud->to_x, &ud->to_y);
 
 	if(ud->walktimer != INVALID_TIMER) {
@@ -384,7 +389,7 @@ int unit_walktobl(struct block_list *bl, struct block_list *tbl, int range, int
 	ud->state.attack_continue = flag&2?1:0; //Chase to attack.
 
 	sc = status_get_sc(bl);
-	if (sc && sc->data[SC_CONFUSION]) //Randomize the target position
+	if (sc && sc_get(sc,SC_CONFUSION)) //Randomize the target position
 		map_random_dir(bl, &ud->to_x, &ud->to_y);
 
 	if(ud->walktimer != INVALID_TIMER) {
@@ -422,7 +427,7 @@ int unit_run(struct block_list *bl)
 	int lv;
 	int i;
 
-	if (!(sc && sc->data[SC_RUN]))
+	if (!(sc && sc_get(sc,SC_RUN)))
 		return 0;
 	
 	if (!unit_can_move(bl)) {
@@ -430,9 +435,9 @@ int unit_run(struct block_list *bl)
 		return 0;
 	}
 	
-	lv = sc->data[SC_RUN]->val1;
-	dir_x = dirx[sc->data[SC_RUN]->val2];
-	dir_y = diry[sc->data[SC_RUN]->val2];
+	lv = sc_get(sc,SC_RUN)->val1;
+	dir_x = dirx[sc_get(sc,SC_RUN)->val2];
+	dir_y = diry[sc_get(sc,SC_RUN)->val2];
 
 	// determine destination cell
 	to_x = bl->x;
@@ -443,7 +448,7 @@ int unit_run(struct block_list *bl)
 			break;
 
 		//if sprinting and there's a PC/Mob/NPC, block the path [Kevin]
-		if(sc->data[SC_RUN] && map_count_oncell(bl->m, to_x+dir_x, to_y+dir_y, BL_PC|BL_MOB|BL_NPC))
+		if(sc_get(sc,SC_RUN) && map_count_oncell(bl->m, to_x+dir_x, to_y+dir_y, BL_PC|BL_MOB|BL_NPC))
 			break;
 			
 		to_x += dir_x;
@@ -828,26 +833,26 @@ int unit_can_move(struct block_list *bl)
 			return 0;
 
 		if (sc->count && (
-			sc->data[SC_ANKLE]
-			|| sc->data[SC_AUTOCOUNTER]
-			|| sc->data[SC_TRICKDEAD]
-			|| sc->data[SC_BLADESTOP]
-			|| sc->data[SC_BLADESTOP_WAIT]
-			|| (sc->data[SC_SPIDERWEB] && sc->data[SC_SPIDERWEB]->val1)
-			|| (sc->data[SC_DANCING] && sc->data[SC_DANCING]->val4 && (
-				!sc->data[SC_LONGING] ||
-				(sc->data[SC_DANCING]->val1&0xFFFF) == CG_MOONLIT ||
-				(sc->data[SC_DANCING]->val1&0xFFFF) == CG_HERMODE
+			sc_get(sc,SC_ANKLE)
+			|| sc_get(sc,SC_AUTOCOUNTER)
+			|| sc_get(sc,SC_TRICKDEAD)
+			|| sc_get(sc,SC_BLADESTOP)
+			|| sc_get(sc,SC_BLADESTOP_WAIT)
+			|| (sc_get(sc,SC_SPIDERWEB) && sc_get(sc,SC_SPIDERWEB)->val1)
+			|| (sc_get(sc,SC_DANCING) && sc_get(sc,SC_DANCING)->val4 && (
+				!sc_get(sc,SC_LONGING) ||
+				(sc_get(sc,SC_DANCING)->val1&0xFFFF) == CG_MOONLIT ||
+				(sc_get(sc,SC_DANCING)->val1&0xFFFF) == CG_HERMODE
 			))
-			|| (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF)	// cannot move while gospel is in effect
-			|| (sc->data[SC_BASILICA] && sc->data[SC_BASILICA]->val4 == bl->id) // Basilica caster cannot move
-			|| sc->data[SC_STOP]
-			|| sc->data[SC_CLOSECONFINE]
-			|| sc->data[SC_CLOSECONFINE2]
-			|| (sc->data[SC_CLOAKING] && //Need wall at level 1-2
-				sc->data[SC_CLOAKING]->val1 < 3 && !(sc->data[SC_CLOAKING]->val4&1))
-			|| sc->data[SC_MADNESSCANCEL]
-			|| (sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF)
+			|| (sc_get(sc,SC_GOSPEL) && sc_get(sc,SC_GOSPEL)->val4 == BCT_SELF)	// cannot move while gospel is in effect
+			|| (sc_get(sc,SC_BASILICA) && sc_get(sc,SC_BASILICA)->val4 == bl->id) // Basilica caster cannot move
+			|| sc_get(sc,SC_STOP)
+			|| sc_get(sc,SC_CLOSECONFINE)
+			|| sc_get(sc,SC_CLOSECONFINE2)
+			|| (sc_get(sc,SC_CLOAKING) && //Need wall at level 1-2
+				sc_get(sc,SC_CLOAKING)->val1 < 3 && !(sc_get(sc,SC_CLOAKING)->val4&1))
+			|| sc_get(sc,SC_MADNESSCANCEL)
+			|| (sc_get(sc,SC_GRAVITATION) && sc_get(sc,SC_GRAVITATION)->val3 == BCT_SELF)
 		))
 			return 0;
 	}
@@ -938,10 +943,10 @@ int unit_skilluse_id2(struct block_list *src, int target_id, short skill_num, sh
 		sc = NULL; //Unneeded
 
 	//temp: used to signal combo-skills right now.
-	if (sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill_num)
+	if (sc && sc_get(sc,SC_COMBO) && sc_get(sc,SC_COMBO)->val1 == skill_num)
 	{
-		if (sc->data[SC_COMBO]->val2)
-			target_id = sc->data[SC_COMBO]->val2;
+		if (sc_get(sc,SC_COMBO)->val2)
+			target_id = sc_get(sc,SC_COMBO)->val2;
 		else
 			target_id = ud->target;
 		temp = 1;
@@ -962,8 +967,8 @@ int unit_skilluse_id2(struct block_list *src, int target_id, short skill_num, sh
 		switch(skill_num)
 		{	//Check for skills that auto-select target
 		case MO_CHAINCOMBO:
-			if (sc && sc->data[SC_BLADESTOP]){
-				if ((target=map_id2bl(sc->data[SC_BLADESTOP]->val4)) == NULL)
+			if (sc && sc_get(sc,SC_BLADESTOP)){
+				if ((target=map_id2bl(sc_get(sc,SC_BLADESTOP)->val4)) == NULL)
 					return 0;
 			}
 			break;
@@ -1100,10 +1105,10 @@ int unit_skilluse_id2(struct block_list *src, int target_id, short skill_num, sh
 			casttime += casttime * min(skill_lv, sd->spiritball);
 	break;
 	case MO_EXTREMITYFIST:
-		if (sc && sc->data[SC_COMBO] &&
-		   (sc->data[SC_COMBO]->val1 == MO_COMBOFINISH ||
-			sc->data[SC_COMBO]->val1 == CH_TIGERFIST ||
-			sc->data[SC_COMBO]->val1 == CH_CHAINCRUSH))
+		if (sc && sc_get(sc,SC_COMBO) &&
+		   (sc_get(sc,SC_COMBO)->val1 == MO_COMBOFINISH ||
+			sc_get(sc,SC_COMBO)->val1 == CH_TIGERFIST ||
+			sc_get(sc,SC_COMBO)->val1 == CH_CHAINCRUSH))
 			casttime = 0;
 		temp = 1;
 	break;
@@ -1111,15 +1116,15 @@ int unit_skilluse_id2(struct block_list *src, int target_id, short skill_num, sh
 		temp = 1;
 	break;
 	case ST_CHASEWALK:
-		if (sc && sc->data[SC_CHASEWALK])
+		if (sc && sc_get(sc,SC_CHASEWALK))
 			casttime = 0;
 	break;
 	case TK_RUN:
-		if (sc && sc->data[SC_RUN])
+		if (sc && sc_get(sc,SC_RUN))
 			casttime = 0;
 	break;
 	case HP_BASILICA:
-		if( sc && sc->data[SC_BASILICA] )
+		if( sc && sc_get(sc,SC_BASILICA) )
 			casttime = 0; // No Casting time on basilica cancel
 	break;
 	case KN_CHARGEATK:
@@ -1193,7 +1198,7 @@ int unit_skilluse_id2(struct block_list *src, int target_id, short skill_num, sh
 	ud->skillid      = skill_num;
 	ud->skilllv      = skill_lv;
 
- 	if( sc && sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4&4) && skill_num != AS_CLOAKING )
+ 	if( sc && sc_get(sc,SC_CLOAKING) && !(sc_get(sc,SC_CLOAKING)->val4&4) && skill_num != AS_CLOAKING )
 	{
 		status_change_end(src, SC_CLOAKING, INVALID_TIMER);
 		if (!src->prev) return 0; //Warped away!
@@ -1298,7 +1303,7 @@ int unit_skilluse_pos2( struct block_list *src, short skill_x, short skill_y, sh
 	ud->skilly       = skill_y;
 	ud->skilltarget  = 0;
 
-	if (sc && sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4&4))
+	if (sc && sc_get(sc,SC_CLOAKING) && !(sc_get(sc,SC_CLOAKING)->val4&4))
 	{
 		status_change_end(src, SC_CLOAKING, INVALID_TIMER);
 		if (!src->prev) return 0; //Warped away!
@@ -1480,7 +1485,9 @@ bool unit_can_reach_bl(struct block_list *bl,struct block_list *tbl, int range,
 
 	if (x) *x = tbl->x-dx;
 	if (y) *y = tbl->y-dy;
-	return path_search(NULL,bl->m,bl->x,bl->y,tbl->x-dx,tbl->y-dy,easy,CELL_CHKNOREACH);
+	if (easy)
+		return path_search(NULL,bl->m,bl->x,bl->y,tbl->x-dx,tbl->y-dy,1,CELL_CHKNOREACH);
+	return path_search_flow(NULL,bl->m,bl->x,bl->y,tbl->x-dx,tbl->y-dy,CELL_CHKNOREACH);
 }
 /*==========================================
  * Calculates position of Pet/Mercenary/Homunculus
@@ -1866,7 +1873,7 @@ int unit_remove_map_(struct block_list *bl, clr_type clrtype, const char* file,
 			status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 		}
 		status_change_end(bl, SC_CHASEWALK, INVALID_TIMER);
-		if (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF)
+		if (sc_get(sc,SC_GOSPEL) && sc_get(sc,SC_GOSPEL)->val4 == BCT_SELF)
 			status_change_end(bl, SC_GOSPEL, INVALID_TIMER);
 		status_change_end(bl, SC_CHANGE, INVALID_TIMER);
 		status_change_end(bl, SC_STOP, INVALID_TIMER);
@@ -1951,8 +1958,12 @@ int unit_remove_map_(struct block_list *bl, clr_type clrtype, const char* file,
 				sd->debug_file, sd->debug_line, sd->debug_func, file, line, func);
 		}
 		else
-		if (--map[bl->m].users == 0 && battle_config.dynamic_mobs)	//[Skotlex]
-			map_removemobs(bl->m);
+		if (--map[bl->m].users == 0)
+		{
+			map[bl->m].idle_tick = gettick();
+			if (battle_config.dynamic_mobs)	//[Skotlex]
+				map_removemobs(bl->m);
+		}
 		if( map[bl->m].instance_id )
 		{
 			instance[map[bl->m].instance_id].users--;
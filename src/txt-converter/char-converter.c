@@ -10,6 +10,7 @@
 #include "../common/utils.h"
 
 #include "../char/char.h"
+#include "../char/char_bin.h"
 #include "../char/int_storage.h"
 #include "../char/int_pet.h"
 #include "../char/int_party.h"
@@ -284,6 +285,65 @@ int convert_init(void)
 		fclose(fp);
 	}
 
+	while(getchar() != '\n');
+	ShowMessage("\n");
+	ShowNotice("Do you wish to convert your Character Database to the TXT binary store (char_bin_enable)? (y/n) : ");
+	input=getchar();
+	if(input == 'y' || input == 'Y')
+	{
+		static struct character_data cd; // too big for the stack
+		FILE* bin;
+		int next_char_id = START_CHAR_NUM;
+
+		ShowMessage("\n");
+		ShowStatus("Converting Character Database to %s...\n", char_bin);
+		if( (fp = fopen(char_txt, "r")) == NULL )
+		{
+			ShowError("Unable to open file [%s]!\n", char_txt);
+			return 0;
+		}
+		if( (bin = charbin_create(char_bin)) == NULL )
+		{
+			ShowError("Unable to create file [%s]!\n", char_bin);
+			fclose(fp);
+			return 0;
+		}
+		lineno = count = 0;
+		while(fgets(line, sizeof(line), fp))
+		{
+			lineno++;
+			if( line[0] == '/' && line[1] == '/' )
+				continue;
+			tmp_int[1] = 0;
+			if( sscanf(line, "%d\t%%newid%%%n", &tmp_int[0], &tmp_int[1]) == 1 && tmp_int[1] > 0 )
+			{
+				if( next_char_id < tmp_int[0] )
+					next_char_id = tmp_int[0];
+				continue;
+			}
+			memset(&cd, 0, sizeof(cd));
+			ret=mmo_char_fromstr(line, &cd.status, cd.global, &cd.global_num);
+			if(ret > 0) {
+				parse_friend_txt(&cd.status);
+				parse_hotkey_txt(&cd.status);
+				if( !charbin_write(bin, count, &cd) )
+				{
+					ShowError("Failed to write character %d to %s!\n", cd.status.char_id, char_bin);
+					break;
+				}
+				count++;
+				if( next_char_id <= cd.status.char_id )
+					next_char_id = cd.status.char_id + 1;
+			} else {
+				ShowError("Error %d converting character line [%s] (at %s:%d).\n", ret, line, char_txt, lineno);
+			}
+		}
+		if( !charbin_close(bin, count, next_char_id) )
+			ShowError("Failed to complete %s!\n", char_bin);
+		ShowStatus("Converted %d characters.\n", count);
+		fclose(fp);
+	}
+
 	return 0;
 }
 
@@ -90,10 +90,18 @@ SOURCE=..\src\char\char.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\char\char_bin.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\char\char.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\char\char_bin.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\char\int_guild.c
 # End Source File
 # Begin Source File
@@ -318,6 +318,21 @@ SOURCE=..\src\char\char.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\char\char_bin.c
+
+!IF  "$(CFG)" == "txt_converter_char - Win32 Release"
+
+# PROP Intermediate_Dir "tmp\txt_converter_char\Release\char_txt"
+
+!ELSEIF  "$(CFG)" == "txt_converter_char - Win32 Debug"
+
+# PROP Intermediate_Dir "tmp\txt_converter_char\Debug\char_txt"
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\char\char.h
 
 !IF  "$(CFG)" == "txt_converter_char - Win32 Release"
@@ -333,6 +348,21 @@ SOURCE=..\src\char\char.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\char\char_bin.h
+
+!IF  "$(CFG)" == "txt_converter_char - Win32 Release"
+
+# PROP Intermediate_Dir "tmp\txt_converter_char\Release\char_txt"
+
+!ELSEIF  "$(CFG)" == "txt_converter_char - Win32 Debug"
+
+# PROP Intermediate_Dir "tmp\txt_converter_char\Debug\char_txt"
+
+!ENDIF 
+
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\char\int_guild.c
 
 !IF  "$(CFG)" == "txt_converter_char - Win32 Release"